@@ -0,0 +1,135 @@
+/**
+ * @file event_bus_bench.cpp
+ * @brief Microbenchmark: EventBus publish throughput with 1, 8 and 64 publishing threads
+ *
+ * Compares the snapshot-based bus against a replica of the previous design,
+ * which held one mutex for the whole publish and filtered typed listeners with
+ * `std::get_if` on every event.
+ */
+
+#include "frqs-widget.hpp"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <print>
+#include <thread>
+#include <vector>
+
+using namespace frqs;
+using namespace frqs::event;
+
+namespace {
+
+constexpr size_t EVENTS_PER_RUN = 2'000'000;
+constexpr size_t TYPED_LISTENERS = 4;     // Per subscribed event type
+constexpr size_t THREAD_COUNTS[] = {1, 8, 64};
+
+std::atomic<uint64_t> g_sink{0};
+
+/**
+ * @brief The previous EventBus: one sorted list, lock held during callbacks.
+ */
+class LockedBus {
+private:
+    std::mutex mutex_;
+    std::vector<EventListener> listeners_;
+
+public:
+    template <typename T, typename Callable>
+    void subscribeType(Callable&& callback) {
+        std::lock_guard lock(mutex_);
+        listeners_.emplace_back([cb = std::forward<Callable>(callback)](const Event& event) -> bool {
+            if (auto* evt = std::get_if<T>(&event)) return cb(*evt);
+            return false;
+        });
+    }
+
+    void broadcast(const Event& event) {
+        std::lock_guard lock(mutex_);
+        for (const auto& listener : listeners_) {
+            listener(event);
+        }
+    }
+};
+
+/**
+ * @brief Subscribes listeners on several event types, as an application would.
+ */
+template <typename Bus>
+void populate(Bus& bus) {
+    for (size_t i = 0; i < TYPED_LISTENERS; ++i) {
+        (void)bus.template subscribeType<MouseMoveEvent>([](const MouseMoveEvent& e) {
+            g_sink.fetch_add(static_cast<uint64_t>(e.position.x), std::memory_order_relaxed);
+            return false;
+        });
+        (void)bus.template subscribeType<KeyEvent>([](const KeyEvent& e) {
+            g_sink.fetch_add(e.keyCode, std::memory_order_relaxed);
+            return false;
+        });
+        (void)bus.template subscribeType<ResizeEvent>([](const ResizeEvent& e) {
+            g_sink.fetch_add(e.newSize.w, std::memory_order_relaxed);
+            return false;
+        });
+    }
+}
+
+/**
+ * @brief Publishes EVENTS_PER_RUN events split across `threads` threads.
+ * @return Millions of events per second.
+ */
+template <typename Bus>
+double measure(Bus& bus, size_t threads) {
+    size_t perThread = EVENTS_PER_RUN / threads;
+    std::atomic<bool> go{false};
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (size_t i = 0; i < perThread; ++i) {
+                if (i % 4 == 3) {
+                    bus.broadcast(Event(KeyEvent{.keyCode = static_cast<uint32_t>(i)}));
+                } else {
+                    bus.broadcast(Event(MouseMoveEvent{.position = Point(static_cast<int32_t>(t), 0)}));
+                }
+            }
+        });
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    return static_cast<double>(perThread * threads) / seconds / 1e6;
+}
+
+} // anonymous namespace
+
+int main() {
+    std::println("EventBus publish throughput ({} events, {} listeners per type)",
+                 EVENTS_PER_RUN, TYPED_LISTENERS);
+    std::println("{:>8} {:>16} {:>16} {:>9}", "threads", "locked (M/s)", "snapshot (M/s)", "speedup");
+
+    for (size_t threads : THREAD_COUNTS) {
+        LockedBus locked;
+        populate(locked);
+        double lockedRate = measure(locked, threads);
+
+        EventBus snapshot;
+        populate(snapshot);
+        double snapshotRate = measure(snapshot, threads);
+
+        std::println("{:>8} {:>16.2f} {:>16.2f} {:>8.2f}x",
+                     threads, lockedRate, snapshotRate, snapshotRate / lockedRate);
+    }
+
+    std::println("(sink {})", g_sink.load());
+    return 0;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file hit_test_bench.cpp
+ * @brief Microbenchmark: linear child scan vs. spatial-index hit-testing
+ */
+
+#include "frqs-widget.hpp"
+#include <chrono>
+#include <print>
+#include <random>
+
+using namespace frqs;
+using namespace frqs::widget;
+
+namespace {
+
+constexpr int32_t CANVAS_W = 8000;
+constexpr int32_t CANVAS_H = 6000;
+constexpr size_t QUERIES = 100'000;
+constexpr size_t MOVES = 10'000;
+
+volatile uintptr_t g_sink = 0;
+
+template <typename Fn>
+double measureNs(size_t iterations, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(iterations);
+}
+
+/**
+ * @brief A node-graph-like canvas: an AbsoluteLayout container with `count` small nodes.
+ */
+std::shared_ptr<Container> makeCanvas(size_t count, size_t threshold) {
+    auto canvas = std::make_shared<Container>();   // AbsoluteLayout by default
+    canvas->setRect(Rect(0, 0, static_cast<uint32_t>(CANVAS_W), static_cast<uint32_t>(CANVAS_H)));
+    canvas->setHitIndexThreshold(threshold);
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int32_t> xs(0, CANVAS_W - 80);
+    std::uniform_int_distribution<int32_t> ys(0, CANVAS_H - 40);
+    for (size_t i = 0; i < count; ++i) {
+        auto node = std::make_shared<Widget>();
+        node->setRect(Rect(xs(rng), ys(rng), 80u, 40u));
+        canvas->addChild(node);
+    }
+    return canvas;
+}
+
+void run(size_t count) {
+    std::println("--- {} children ---", count);
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int32_t> px(0, CANVAS_W - 1);
+    std::uniform_int_distribution<int32_t> py(0, CANVAS_H - 1);
+    std::vector<Point<int32_t>> points(QUERIES);
+    for (auto& p : points) p = Point(px(rng), py(rng));
+
+    auto linear = makeCanvas(count, SIZE_MAX);
+    auto indexed = makeCanvas(count, Widget::DEFAULT_HIT_INDEX_THRESHOLD);
+
+    double linearNs = measureNs(QUERIES, [&] {
+        for (const auto& p : points) g_sink = g_sink + reinterpret_cast<uintptr_t>(linear->hitTest(p));
+    });
+
+    // The first query builds the index; time it separately.
+    double buildNs = measureNs(1, [&] { g_sink = g_sink + reinterpret_cast<uintptr_t>(indexed->hitTest(points[0])); });
+
+    double indexedNs = measureNs(QUERIES, [&] {
+        for (const auto& p : points) g_sink = g_sink + reinterpret_cast<uintptr_t>(indexed->hitTest(p));
+    });
+
+    // Dragging nodes around: incremental index updates on setRect.
+    const auto& children = indexed->getChildren();
+    std::uniform_int_distribution<size_t> pick(0, children.size() - 1);
+    double moveNs = measureNs(MOVES, [&] {
+        for (size_t i = 0; i < MOVES; ++i) {
+            auto& child = children[pick(rng)];
+            auto r = child->getRect();
+            child->setRect(Rect(r.x + 3 < CANVAS_W - 80 ? r.x + 3 : 0, r.y, r.w, r.h));
+        }
+    });
+
+    std::println("  hitTest linear:   {:10.1f} ns", linearNs);
+    std::println("  hitTest indexed:  {:10.1f} ns   ({:.1f}x)", indexedNs,
+                 indexedNs > 0.0 ? linearNs / indexedNs : 0.0);
+    std::println("  index build:      {:10.1f} us", buildNs / 1000.0);
+    std::println("  setRect (indexed):{:10.1f} ns", moveNs);
+}
+
+} // anonymous namespace
+
+int main() {
+    std::println("=== Hit-Test: Linear Scan vs. Spatial Index ===\n");
+    run(10'000);
+    run(100'000);
+    std::println("\n{} queries per case", QUERIES);
+    return 0;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file rtti_bench.cpp
+ * @brief Microbenchmark: dynamic_cast vs. capability struct / kind tags
+ */
+
+#include "frqs-widget.hpp"
+#include "render/display_list.hpp"
+#include <chrono>
+#include <print>
+
+using namespace frqs;
+
+namespace {
+
+constexpr size_t ITERATIONS = 10'000'000;
+constexpr size_t CHILD_COUNT = 1'000;
+
+volatile uintptr_t g_sink = 0;
+
+template <typename Fn>
+double measureNs(size_t iterations, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(iterations);
+}
+
+void report(const char* name, double before, double after) {
+    std::println("  {:<32} dynamic_cast: {:6.2f} ns   tag: {:6.2f} ns   ({:.1f}x)",
+                 name, before, after, after > 0.0 ? before / after : 0.0);
+}
+
+} // anonymous namespace
+
+int main() {
+    std::println("=== RTTI vs. Tag Dispatch ===\n");
+
+    // --- Renderer capability probe (once per widget per frame) ---
+    render::DisplayListRecorder recorder;
+    widget::Renderer* renderer = &recorder;
+
+    double rendererRtti = measureNs(ITERATIONS, [&] {
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            g_sink = g_sink + reinterpret_cast<uintptr_t>(dynamic_cast<render::IExtendedRenderer*>(renderer));
+        }
+    });
+    double rendererCaps = measureNs(ITERATIONS, [&] {
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            g_sink = g_sink + reinterpret_cast<uintptr_t>(renderer->getCaps().extended);
+        }
+    });
+    report("Renderer -> IExtendedRenderer", rendererRtti, rendererCaps);
+
+    // --- IWidget -> Widget (per child in layout / invalidation) ---
+    auto container = widget::createFlexRow();
+    for (size_t i = 0; i < CHILD_COUNT; ++i) {
+        container->addChild(std::make_shared<widget::Label>(L"Item"));
+    }
+    const auto& children = container->getChildren();
+    size_t passes = ITERATIONS / CHILD_COUNT;
+
+    double widgetRtti = measureNs(ITERATIONS, [&] {
+        for (size_t p = 0; p < passes; ++p) {
+            for (const auto& child : children) {
+                g_sink = g_sink + reinterpret_cast<uintptr_t>(dynamic_cast<widget::Widget*>(child.get()));
+            }
+        }
+    });
+    double widgetTag = measureNs(ITERATIONS, [&] {
+        for (size_t p = 0; p < passes; ++p) {
+            for (const auto& child : children) {
+                g_sink = g_sink + reinterpret_cast<uintptr_t>(widget::asWidget(child.get()));
+            }
+        }
+    });
+    report("IWidget -> Widget", widgetRtti, widgetTag);
+
+    double labelRtti = measureNs(ITERATIONS, [&] {
+        for (size_t p = 0; p < passes; ++p) {
+            for (const auto& child : children) {
+                g_sink = g_sink + reinterpret_cast<uintptr_t>(dynamic_cast<widget::Label*>(child.get()));
+            }
+        }
+    });
+    double labelTag = measureNs(ITERATIONS, [&] {
+        for (size_t p = 0; p < passes; ++p) {
+            for (const auto& child : children) {
+                g_sink = g_sink + reinterpret_cast<uintptr_t>(widget::widgetCast<widget::Label>(child.get()));
+            }
+        }
+    });
+    report("IWidget -> Label", labelRtti, labelTag);
+
+    std::println("\n{} iterations per case", ITERATIONS);
+    return 0;
+}
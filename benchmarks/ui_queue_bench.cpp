@@ -0,0 +1,79 @@
+/**
+ * @file ui_queue_bench.cpp
+ * @brief Microbenchmark: UI task queue throughput with 1 to 32 producer threads
+ *
+ * Producers post small tasks while one consumer drains them in batches, as the
+ * UI loop does. Compares the mutex + condition variable `MessageQueue` (which
+ * relocks once per message while draining) against the lock-free `MpscQueue`.
+ */
+
+#include "frqs-widget.hpp"
+#include <atomic>
+#include <chrono>
+#include <print>
+#include <thread>
+#include <vector>
+
+using namespace frqs;
+using namespace frqs::platform;
+
+namespace {
+
+constexpr size_t TASKS_PER_RUN = 1'000'000;
+constexpr size_t PRODUCER_COUNTS[] = {1, 2, 4, 8, 16, 32};
+
+/**
+ * @brief Pushes TASKS_PER_RUN tasks from `producers` threads and drains them on this thread.
+ * @return Millions of tasks per second, producer start to last task run.
+ */
+template <typename Queue>
+double measure(size_t producers) {
+    Queue queue;
+    size_t perProducer = TASKS_PER_RUN / producers;
+    size_t total = perProducer * producers;
+
+    std::atomic<bool> go{false};
+    uint64_t executed = 0;
+    std::vector<std::thread> workers;
+    workers.reserve(producers);
+
+    for (size_t p = 0; p < producers; ++p) {
+        workers.emplace_back([&] {
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (size_t i = 0; i < perProducer; ++i) {
+                queue.push(UiTask([&executed] { ++executed; }));
+            }
+        });
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    while (executed < total) {
+        queue.processAll([](UiTask&& task) { task(); });
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    return static_cast<double>(total) / seconds / 1e6;
+}
+
+} // anonymous namespace
+
+int main() {
+    std::println("UI task queue throughput ({} tasks, one draining consumer)", TASKS_PER_RUN);
+    std::println("{:>10} {:>16} {:>16} {:>9}", "producers", "mutex (M/s)", "lock-free (M/s)", "speedup");
+
+    for (size_t producers : PRODUCER_COUNTS) {
+        double lockedRate = measure<MessageQueue<UiTask>>(producers);
+        double lockFreeRate = measure<MpscQueue<UiTask>>(producers);
+        std::println("{:>10} {:>16.2f} {:>16.2f} {:>8.2f}x",
+                     producers, lockedRate, lockFreeRate, lockFreeRate / lockedRate);
+    }
+    return 0;
+}
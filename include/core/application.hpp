@@ -11,14 +11,83 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <optional>
 #include <chrono>
+#include <functional>
+#include <string_view>
 #include "window.hpp"
 #include "window_registry.hpp"
+#include "ui_task_scheduler.hpp"
+#include "timer_wheel.hpp"
+#include "frame_pacer.hpp"
+#include "latency_monitor.hpp"
+#include "platform/event_loop_backend.hpp"
 #include "platform/message_queue.hpp"
+#include "platform/update_channel.hpp"
 
 namespace frqs::core {
 
+/**
+ * @struct MainLoopStats
+ * @brief Counters of the main loop since `run()` (or the last `resetLoopStats()`).
+ */
+struct MainLoopStats {
+    uint64_t iterations = 0;    ///< Loop passes run.
+    uint64_t idleWaits = 0;     ///< Sleeps with nothing to do until input, a task, or the next timer.
+    uint64_t frameWaits = 0;    ///< Sleeps towards the next frame deadline (tasks carried over or an animation frame requested).
+    uint64_t wakeups = 0;       ///< Sleeps ended by input, a task, or `quit()` rather than their deadline.
+    uint64_t layouts = 0;       ///< Container layouts run by the frame pipeline's layout phase.
+    uint64_t paints = 0;        ///< Window frames drawn and presented by the paint phase.
+};
+
+// ============================================================================
+// FRAME PIPELINE
+// ============================================================================
+
+/**
+ * @enum FramePhase
+ * @brief The phases every pass of the main loop runs through, in order.
+ */
+enum class FramePhase : uint8_t {
+    Input,      ///< Native messages, then each window's coalesced mouse move.
+    Tasks,      ///< Posted tasks, update channels, due timers, deferred bus events.
+    Animate,    ///< Frame tickers, at the pacer's frame time.
+    Layout,     ///< One layout pass over the containers that requested it.
+    Paint,      ///< Windows with invalidated regions draw them.
+    Present     ///< Drawn frames are shown.
+};
+
+/** @brief The number of `FramePhase` values. */
+inline constexpr size_t FRAME_PHASE_COUNT = 6;
+
+/** @brief Gets the display name of a phase (e.g. for traces). */
+[[nodiscard]] constexpr std::string_view getFramePhaseName(FramePhase phase) noexcept {
+    constexpr std::array<std::string_view, FRAME_PHASE_COUNT> NAMES = {
+        "Input", "Tasks", "Animate", "Layout", "Paint", "Present"
+    };
+    return NAMES[static_cast<size_t>(phase)];
+}
+
+/**
+ * @brief Called after each phase with when it started and how long it took.
+ * @details Runs on the UI thread, inside the frame; keep it cheap.
+ */
+using FramePhaseHook = std::function<void(FramePhase phase,
+                                          std::chrono::steady_clock::time_point start,
+                                          std::chrono::nanoseconds duration)>;
+
+/**
+ * @brief Advances time-based state (animations) once per frame.
+ * @return `true` to have another frame scheduled at the target rate.
+ */
+using FrameTicker = std::function<bool(FramePacer::Clock::time_point frameTime)>;
+
+/** @brief Identifies a registered `FrameTicker`. 0 is never used. */
+using FrameTickerId = uint64_t;
+
 // ============================================================================
 // APPLICATION (Singleton Lifecycle Manager)
 // ============================================================================
@@ -43,8 +112,8 @@ private:
     struct Impl;  // PImpl to hide platform details
     std::unique_ptr<Impl> pImpl_;
     
-    bool running_ = false;
-    platform::UiTaskQueue taskQueue_;  // Worker->UI communication
+    std::atomic<bool> running_{false};
+    UiTaskScheduler taskScheduler_;  // Worker->UI communication, by priority lane
 
     Application();
 
@@ -100,7 +169,23 @@ public:
      * @brief Checks if the application's main loop is currently running.
      * @return `true` if the application is running, `false` otherwise.
      */
-    [[nodiscard]] bool isRunning() const noexcept { return running_; }
+    [[nodiscard]] bool isRunning() const noexcept { return running_.load(); }
+
+    /**
+     * @brief Sets whether the loop stops once the last window is closed (the default).
+     * @note Turn it off for tray or headless applications that run without windows.
+     */
+    void setQuitOnLastWindowClosed(bool quit) noexcept;
+
+    /**
+     * @brief Replaces the native message source the loop dispatches from and sleeps on.
+     * @details E.g. a `platform::HeadlessEventLoopBackend` for tests.
+     * @note Call before `run()` and before other threads post tasks.
+     */
+    void setEventLoopBackend(std::unique_ptr<platform::EventLoopBackend> backend);
+
+    /** @brief Gets the native message source of the loop. */
+    [[nodiscard]] platform::EventLoopBackend& getEventLoopBackend() noexcept;
 
     // ========================================================================
     // WINDOW MANAGEMENT
@@ -153,39 +238,92 @@ public:
      * UI elements or application state that is not thread-safe.
      *
      * @param task A callable object (e.g., lambda) to be executed.
+     * @param lane The task's priority. Only `TaskLane::Critical` tasks are
+     *             guaranteed to run in the next frame; the other lanes share
+     *             the per-frame budget and may be carried over.
      */
-    void postToUiThread(platform::UiTask task) {
-        taskQueue_.push(std::move(task));
+    void postToUiThread(platform::UiTask task, TaskLane lane = TaskLane::Normal) {
+        taskScheduler_.post(std::move(task), lane);
     }
 
+    /**
+     * @brief Gets the UI task scheduler, e.g. to set the frame budget or read lane metrics.
+     * @note Configure and read it on the UI thread.
+     */
+    [[nodiscard]] UiTaskScheduler& getTaskScheduler() noexcept { return taskScheduler_; }
+
     /**
      * @brief Posts a task to be executed on the UI thread after a specified delay.
      * @tparam Rep The representation type of the duration.
      * @tparam Period The period type of the duration.
      * @param task A callable object to be executed.
      * @param delay The `std::chrono::duration` to wait before execution.
+     * @note This method is thread-safe; the delay counts from the call.
      */
     template <typename Rep, typename Period>
     void postDelayed(
         platform::UiTask task,
         const std::chrono::duration<Rep, Period>& delay
-    );
+    ) {
+        postAt(std::move(task), TimerWheel::Clock::now() +
+                                std::chrono::ceil<TimerWheel::Clock::duration>(delay));
+    }
+
+    /**
+     * @brief Posts a task to be executed on the UI thread at a point in time.
+     * @note This method is thread-safe.
+     */
+    void postAt(platform::UiTask task, TimerWheel::Clock::time_point deadline);
+
+    /**
+     * @brief Gets the UI thread's timers, for cancellable, periodic, or debounced work.
+     * @note UI thread only; other threads use `postDelayed`.
+     */
+    [[nodiscard]] TimerWheel& getTimers() noexcept;
+
+    /**
+     * @brief Has the event loop deliver a channel's latest values once per frame.
+     *
+     * Use a channel instead of `postToUiThread` for high-rate feeds (progress,
+     * prices, sensor readings): the UI sees only the newest value per key, and
+     * memory stays bounded when it falls behind. The first publish after each
+     * delivery wakes the loop.
+     *
+     * @param channel The channel; its pending callback is replaced.
+     * @note Call on the UI thread, before producers start publishing.
+     */
+    void attachUpdateChannel(std::shared_ptr<platform::UpdateChannelBase> channel);
+
+    /**
+     * @brief Stops delivering a channel and clears its pending callback.
+     * @details Undelivered values stay in the channel; producers may keep publishing.
+     * @note Call on the UI thread.
+     */
+    void detachUpdateChannel(const std::shared_ptr<platform::UpdateChannelBase>& channel);
 
     // ========================================================================
     // EVENT LOOP CONTROL
     // ========================================================================
 
     /**
-     * @brief Processes all pending tasks in the UI task queue.
+     * @brief Runs this frame's share of the posted UI tasks (see `UiTaskScheduler`).
      * @note This is called internally by the event loop.
      */
     void processPendingTasks();
 
+    /**
+     * @brief Delivers the newest value of every key of every attached update channel.
+     * @return The number of values delivered.
+     * @note This is called internally by the event loop, once per frame.
+     */
+    size_t deliverUpdates();
+
     /**
      * @brief Processes a single iteration of the event loop.
      *
      * Useful for integrating into a custom or external event loop.
-     * Processes window messages and pending tasks.
+     * Runs one frame of the pipeline without sleeping, then releases the
+     * frame's `FrameArena` scratch memory.
      *
      * @return `true` if the application should continue running, `false` otherwise.
      */
@@ -206,10 +344,63 @@ public:
      */
     void requestRender(WindowId id);
 
+    /**
+     * @brief Keeps the loop running one more frame at the target frame rate.
+     *
+     * Without pending work the loop sleeps until input, a posted task, or the
+     * next timer. Call this every frame while animating; the loop goes back
+     * to sleep once no frame was requested.
+     *
+     * @note UI thread only.
+     */
+    void requestAnimationFrame() noexcept;
+
+    /**
+     * @brief Registers a ticker run in every frame's animate phase.
+     * @details A ticker returning `true` keeps frames coming, exactly like
+     *          calling `requestAnimationFrame()`; it stays registered either way.
+     * @param window The window the ticker animates, if any: while the ticker
+     *        asks for frames, that window paints at full rate even unfocused
+     *        (see `Window::requestAnimationFrame()`).
+     * @return An id for `removeFrameTicker()`.
+     * @note UI thread only.
+     */
+    FrameTickerId addFrameTicker(FrameTicker ticker, std::optional<WindowId> window = std::nullopt);
+
+    /**
+     * @brief Unregisters a ticker. Safe to call from a ticker, including the one removed.
+     * @note UI thread only.
+     */
+    void removeFrameTicker(FrameTickerId id) noexcept;
+
+    /**
+     * @brief Sets the hook called after each phase of the frame pipeline (nullptr removes it).
+     * @note UI thread only.
+     */
+    void setFramePhaseHook(FramePhaseHook hook);
+
+    /**
+     * @brief Gets the durations of one phase over recent loop passes.
+     * @note UI thread only.
+     */
+    [[nodiscard]] const LatencyHistogram& getFramePhaseTimes(FramePhase phase) const noexcept;
+
+    /**
+     * @brief Gets the main loop's iteration and sleep counters.
+     * @note UI thread only.
+     */
+    [[nodiscard]] MainLoopStats getLoopStats() const noexcept;
+
+    /** @brief Zeroes the main loop counters and phase timings. UI thread only. */
+    void resetLoopStats() noexcept;
+
     /**
      * @brief Sets the target frame rate for the application's render loop.
      * @param fps The target frames per second. Set to 0 for unlimited FPS.
      * @note The actual frame rate may be lower depending on system performance.
+     *       It only applies while there is work; an idle loop does not wake at all.
+     *       Windows out of focus paint at the lower rate of their
+     *       `Window::setFrameRatePolicy()`; minimized or covered ones not at all.
      */
     void setTargetFps(uint32_t fps) noexcept;
 
@@ -219,6 +410,12 @@ public:
      */
     [[nodiscard]] uint32_t getTargetFps() const noexcept;
 
+    /**
+     * @brief Gets the frame pacer, for frame-interval percentiles and the animation clock.
+     * @note UI thread only.
+     */
+    [[nodiscard]] FramePacer& getFramePacer() noexcept;
+
 private:
     /**
      * @brief The core implementation of the main event loop.
@@ -226,17 +423,42 @@ private:
      */
     void runMainLoop();
 
+    /**
+     * @brief Runs one frame of the pipeline: input, tasks, animate, layout, paint, present.
+     * @internal
+     */
+    void runFrame();
+
+    /**
+     * @brief Runs every frame ticker at `frameTime`.
+     * @internal
+     */
+    void tickAnimations(FramePacer::Clock::time_point frameTime);
+
+    /**
+     * @brief Sleeps until input, a task, `quit()`, the next timer, or (if work remains) the next frame.
+     * @internal
+     */
+    void waitForWork(std::chrono::steady_clock::time_point frameStart);
+
     /**
      * @brief Processes platform-specific window messages.
+     * @return `false` if the platform asked the application to quit.
+     * @internal
+     */
+    bool processWindowMessages();
+
+    /**
+     * @brief Checks if the caller runs on the UI thread (the one that runs the loop).
      * @internal
      */
-    void processWindowMessages();
+    [[nodiscard]] bool isUiThread() const noexcept;
 
     /**
-     * @brief Renders all windows that have been marked as "dirty" (requiring a redraw).
+     * @brief Dispatches each window's coalesced mouse move, once per frame.
      * @internal
      */
-    void renderWindows();
+    void flushWindowInput();
 };
 
 } // namespace frqs::core
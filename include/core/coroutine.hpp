@@ -0,0 +1,419 @@
+/**
+ * @file coroutine.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Defines `Task<T>` coroutines and awaitables that hop between the UI thread and the thread pool.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Async flows such as "load, transform off-thread, update the widget" used
+ * to be written as nested `postToThreadPool`/`postToUiThread` callbacks, each
+ * copying its captures along. With these types they read top to bottom:
+ *
+ * @code
+ * core::Task<> refresh(std::shared_ptr<Label> label) {
+ *     co_await core::resumeOnPool();
+ *     std::string text = loadAndFormat();            // Worker thread
+ *     co_await core::resumeOnUi();
+ *     label->setText(text);                          // UI thread
+ * }
+ * core::spawn(refresh(label), core::CancellationToken::forOwner(label));
+ * @endcode
+ *
+ * A hop stores just the coroutine handle in a `UiTask`, so it never allocates.
+ * At every hop the coroutine's cancellation token is checked; if it was
+ * cancelled (or its owning widget was destroyed) the whole coroutine chain
+ * is destroyed instead of resumed, running the destructors of its locals.
+ * The same happens when a hop is dropped without running (its queue or pool
+ * shut down), so a suspended chain is never leaked.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include "core/ui_task_scheduler.hpp"
+#include "platform/unique_task.hpp"
+
+namespace frqs::core {
+
+// ============================================================================
+// CANCELLATION
+// ============================================================================
+
+/**
+ * @class CancellationToken
+ * @brief Tells a coroutine to stop at its next hop.
+ *
+ * A token is cancelled when its `CancellationSource` cancels, or when the
+ * object passed to `forOwner()` is destroyed. A default-constructed token is
+ * never cancelled. Tokens are cheap to copy and safe to read from any thread.
+ */
+class CancellationToken {
+private:
+    std::shared_ptr<const std::atomic<bool>> flag_;
+    std::weak_ptr<const void> owner_;
+    bool hasOwner_ = false;
+
+    friend class CancellationSource;
+
+public:
+    CancellationToken() = default;
+
+    /**
+     * @brief Makes a token that is cancelled once `owner` (e.g. a widget) is destroyed.
+     * @details Only the last `shared_ptr` going away counts; test the token on
+     *          the thread that owns the object (the UI thread for widgets).
+     */
+    template <typename T>
+    [[nodiscard]] static CancellationToken forOwner(const std::shared_ptr<T>& owner) {
+        CancellationToken token;
+        token.owner_ = std::static_pointer_cast<const void>(owner);
+        token.hasOwner_ = true;
+        return token;
+    }
+
+    /** @brief Returns a copy that is also cancelled once `owner` is destroyed. */
+    template <typename T>
+    [[nodiscard]] CancellationToken withOwner(const std::shared_ptr<T>& owner) const {
+        CancellationToken token = *this;
+        token.owner_ = std::static_pointer_cast<const void>(owner);
+        token.hasOwner_ = true;
+        return token;
+    }
+
+    /** @brief Checks if the token was cancelled. */
+    [[nodiscard]] bool isCancelled() const noexcept {
+        return (flag_ && flag_->load(std::memory_order_acquire)) || (hasOwner_ && owner_.expired());
+    }
+
+    /** @brief Checks if the token can ever be cancelled. */
+    [[nodiscard]] bool canBeCancelled() const noexcept { return flag_ || hasOwner_; }
+};
+
+/**
+ * @class CancellationSource
+ * @brief Cancels every token it handed out.
+ */
+class CancellationSource {
+private:
+    std::shared_ptr<std::atomic<bool>> flag_ = std::make_shared<std::atomic<bool>>(false);
+
+public:
+    /** @brief Cancels all tokens of this source. Thread-safe. */
+    void cancel() noexcept { flag_->store(true, std::memory_order_release); }
+
+    /** @brief Checks if `cancel()` was called. */
+    [[nodiscard]] bool isCancelled() const noexcept { return flag_->load(std::memory_order_acquire); }
+
+    /** @brief Gets a token observing this source. */
+    [[nodiscard]] CancellationToken getToken() const {
+        CancellationToken token;
+        token.flag_ = flag_;
+        return token;
+    }
+};
+
+template <typename T = void>
+class Task;
+
+/**
+ * @brief Starts a task on the calling thread and lets it run to completion on its own.
+ * @param task The coroutine; it owns its frame from now on.
+ * @param token Cancels the task (and every task it awaits) at its next hop.
+ * @note An exception escaping a spawned task goes to the handler set with
+ *       `setTaskExceptionHandler()`.
+ */
+void spawn(Task<void> task, CancellationToken token = {});
+
+/** @brief Receives the exceptions escaping spawned tasks, on the thread the task finished on. */
+using TaskExceptionHandler = std::function<void(std::exception_ptr)>;
+
+/**
+ * @brief Sets where exceptions escaping spawned tasks go (nullptr restores the default).
+ * @details By default the exception is rethrown from a critical UI task, so
+ *          it leaves `Application::run()` like any other UI-thread error.
+ *          Thread-safe.
+ */
+void setTaskExceptionHandler(TaskExceptionHandler handler);
+
+namespace detail {
+
+// ============================================================================
+// PROMISE BASE
+// ============================================================================
+
+/**
+ * @brief Hands the exception of a finished spawned task to the task exception handler.
+ * @internal
+ */
+void reportDetachedException(std::exception_ptr error) noexcept;
+
+/**
+ * @struct TaskPromiseBase
+ * @brief The part of every `Task` promise the hop awaitables need.
+ * @internal
+ */
+struct TaskPromiseBase {
+    std::coroutine_handle<> self;               ///< This promise's coroutine.
+    std::coroutine_handle<> continuation;       ///< The awaiting coroutine, if any.
+    TaskPromiseBase* parent = nullptr;          ///< The awaiting coroutine's promise.
+    CancellationToken token;                    ///< Inherited from the awaiting coroutine.
+    std::exception_ptr error;
+    bool detached = false;                      ///< Started by `spawn()`: owns its own frame.
+
+    /** @brief Sent to the awaiting coroutine, or frees a finished detached frame. */
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+            TaskPromiseBase& promise = handle.promise();
+            if (promise.continuation) {
+                return promise.continuation;
+            }
+            if (promise.detached) {
+                if (promise.error) {
+                    reportDetachedException(std::move(promise.error));
+                }
+                handle.destroy();
+            }
+            return std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+    void unhandled_exception() noexcept { error = std::current_exception(); }
+};
+
+/**
+ * @brief Resumes a coroutine after a hop, or destroys its chain if it was cancelled.
+ * @internal
+ */
+void resumeOrCancel(std::coroutine_handle<> handle, TaskPromiseBase& promise) noexcept;
+
+template <typename T>
+struct TaskPromise : TaskPromiseBase {
+    std::optional<T> value;
+
+    Task<T> get_return_object() noexcept;
+
+    template <typename U>
+        requires std::is_convertible_v<U&&, T>
+    void return_value(U&& result) { value.emplace(std::forward<U>(result)); }
+
+    T takeResult() {
+        if (error) std::rethrow_exception(error);
+        return std::move(*value);
+    }
+};
+
+template <>
+struct TaskPromise<void> : TaskPromiseBase {
+    Task<void> get_return_object() noexcept;
+
+    void return_void() const noexcept {}
+
+    void takeResult() const {
+        if (error) std::rethrow_exception(error);
+    }
+};
+
+/** @brief Checks whether a promise type takes part in hops and cancellation. */
+template <typename Promise>
+concept HopPromise = std::is_base_of_v<TaskPromiseBase, Promise>;
+
+} // namespace detail
+
+// ============================================================================
+// TASK
+// ============================================================================
+
+/**
+ * @class Task
+ * @brief A lazily started, move-only coroutine producing a `T`.
+ *
+ * A task runs when it is `co_await`ed (the awaiting coroutine resumes when it
+ * finishes, with its result or exception) or when it is handed to `spawn()`.
+ * An awaited task inherits the awaiting coroutine's cancellation token.
+ */
+template <typename T>
+class [[nodiscard]] Task {
+public:
+    using promise_type = detail::TaskPromise<T>;
+
+private:
+    std::coroutine_handle<promise_type> handle_;
+
+    friend struct detail::TaskPromise<T>;
+    friend void spawn(Task<void> task, CancellationToken token);
+
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+
+public:
+    Task() noexcept = default;
+
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (handle_) handle_.destroy();
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() {
+        if (handle_) handle_.destroy();
+    }
+
+    /** @brief Checks if the task holds a coroutine. */
+    explicit operator bool() const noexcept { return static_cast<bool>(handle_); }
+
+    /**
+     * @struct Awaiter
+     * @brief Starts the task and suspends the awaiting coroutine until it finishes.
+     */
+    struct Awaiter {
+        std::coroutine_handle<promise_type> handle;
+
+        bool await_ready() const noexcept { return !handle || handle.done(); }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> awaiting) noexcept {
+            promise_type& promise = handle.promise();
+            promise.continuation = awaiting;
+            if constexpr (detail::HopPromise<Promise>) {
+                promise.parent = &awaiting.promise();
+                promise.token = awaiting.promise().token;
+            }
+            return handle;      // Symmetric transfer: start the task without growing the stack
+        }
+
+        T await_resume() { return handle.promise().takeResult(); }
+    };
+
+    Awaiter operator co_await() && noexcept { return Awaiter{handle_}; }
+};
+
+namespace detail {
+
+template <typename T>
+Task<T> TaskPromise<T>::get_return_object() noexcept {
+    auto handle = std::coroutine_handle<TaskPromise<T>>::from_promise(*this);
+    self = handle;
+    return Task<T>(handle);
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+    auto handle = std::coroutine_handle<TaskPromise<void>>::from_promise(*this);
+    self = handle;
+    return Task<void>(handle);
+}
+
+} // namespace detail
+
+// ============================================================================
+// HOP AWAITABLES
+// ============================================================================
+
+namespace detail {
+
+/**
+ * @brief Wraps `resumeOrCancel(handle)` in a task for a queue.
+ * @details A task destroyed without having run destroys the suspended chain
+ *          instead, so a queue or pool that shuts down does not leak it.
+ */
+[[nodiscard]] platform::UniqueTask makeResumeTask(std::coroutine_handle<> handle, TaskPromiseBase& promise);
+/** @brief Posts `resumeOrCancel(handle)` to the UI thread. */
+void postResumeToUi(std::coroutine_handle<> handle, TaskPromiseBase& promise, TaskLane lane);
+/** @brief Posts `resumeOrCancel(handle)` to the global thread pool. */
+void postResumeToPool(std::coroutine_handle<> handle, TaskPromiseBase& promise);
+/** @brief Posts `resumeOrCancel(handle)` to the UI thread after `delay`. */
+void postResumeDelayed(std::coroutine_handle<> handle, TaskPromiseBase& promise,
+                       std::chrono::milliseconds delay);
+
+} // namespace detail
+
+/**
+ * @struct UiHop
+ * @brief Awaitable returned by `resumeOnUi()`.
+ */
+struct UiHop {
+    TaskLane lane;
+
+    bool await_ready() const noexcept { return false; }
+    template <detail::HopPromise Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle) {
+        detail::postResumeToUi(handle, handle.promise(), lane);
+    }
+    void await_resume() const noexcept {}
+};
+
+/**
+ * @struct PoolHop
+ * @brief Awaitable returned by `resumeOnPool()`.
+ */
+struct PoolHop {
+    bool await_ready() const noexcept { return false; }
+    template <detail::HopPromise Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle) {
+        detail::postResumeToPool(handle, handle.promise());
+    }
+    void await_resume() const noexcept {}
+};
+
+/**
+ * @struct DelayHop
+ * @brief Awaitable returned by `delay()`.
+ */
+struct DelayHop {
+    std::chrono::milliseconds duration;
+
+    bool await_ready() const noexcept { return false; }
+    template <detail::HopPromise Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle) {
+        detail::postResumeDelayed(handle, handle.promise(), duration);
+    }
+    void await_resume() const noexcept {}
+};
+
+/**
+ * @brief Continues the coroutine on the UI thread, through `Application::postToUiThread`.
+ * @param lane The priority of the resumption.
+ */
+[[nodiscard]] inline UiHop resumeOnUi(TaskLane lane = TaskLane::Normal) noexcept {
+    return UiHop{lane};
+}
+
+/**
+ * @brief Continues the coroutine on a worker of the global thread pool.
+ */
+[[nodiscard]] inline PoolHop resumeOnPool() noexcept {
+    return PoolHop{};
+}
+
+/**
+ * @brief Continues the coroutine on the UI thread once `duration` has elapsed.
+ * @details Rounded up to whole milliseconds; backed by `Application::postDelayed`.
+ */
+template <typename Rep, typename Period>
+[[nodiscard]] DelayHop delay(const std::chrono::duration<Rep, Period>& duration) noexcept {
+    return DelayHop{std::chrono::ceil<std::chrono::milliseconds>(duration)};
+}
+
+} // namespace frqs::core
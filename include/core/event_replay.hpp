@@ -0,0 +1,113 @@
+/**
+ * @file event_replay.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Replays recorded input traces against live windows and measures frame times.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * @example
+ * auto recorder = std::make_shared<event::EventRecorder>();
+ * window->setEventRecorder(recorder);
+ * recorder->start();
+ * // ... user scrolls the list ...
+ * recorder->getTrace().save("scroll.frqt");
+ *
+ * auto trace = event::EventTrace::load("scroll.frqt");
+ * auto report = core::replayTrace(*trace, *window, {.speed = core::ReplaySpeed::AsFastAsPossible});
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "window.hpp"
+#include "event/event_trace.hpp"
+
+namespace frqs::core {
+
+// ============================================================================
+// REPLAY OPTIONS
+// ============================================================================
+
+/**
+ * @enum ReplaySpeed
+ * @brief How recorded time maps to replay time.
+ */
+enum class ReplaySpeed : uint8_t {
+    RealTime,          ///< Each frame waits until its recorded time, like the original session.
+    AsFastAsPossible   ///< Frames run back to back; for throughput benchmarks.
+};
+
+/**
+ * @struct ReplayOptions
+ * @brief Parameters of `replayTrace()`.
+ */
+struct ReplayOptions {
+    /** @brief Whether to keep the recorded pacing. */
+    ReplaySpeed speed = ReplaySpeed::RealTime;
+    /** @brief Recorded events are grouped into frames of this much trace time. */
+    std::chrono::nanoseconds frameInterval = std::chrono::nanoseconds(16'666'667);
+    /**
+     * @brief If `true`, every frame paints its windows' damage as the application
+     *        loop does (layout, paint, present) and the paint is timed.
+     */
+    bool render = true;
+    /**
+     * @brief Maps a recorded window id to the window that replays it.
+     * @details Defaults to looking the id up in the `WindowRegistry`. Records
+     *          whose window cannot be resolved are skipped.
+     */
+    std::function<std::shared_ptr<Window>(uint64_t recordedId)> resolveWindow;
+};
+
+// ============================================================================
+// REPLAY REPORT
+// ============================================================================
+
+/**
+ * @struct ReplayReport
+ * @brief What a replay did and how long each frame took.
+ */
+struct ReplayReport {
+    size_t eventsDispatched = 0;       ///< Events delivered to a window.
+    size_t eventsSkipped = 0;          ///< Events whose window could not be resolved.
+    std::vector<double> frameTimesMs;  ///< Dispatch + render time of each frame, in order.
+    double totalMs = 0.0;              ///< Wall time of the whole replay.
+
+    /** @brief Gets the number of frames replayed. */
+    [[nodiscard]] size_t getFrameCount() const noexcept { return frameTimesMs.size(); }
+
+    /**
+     * @brief Gets a frame-time percentile.
+     * @param percentile In [0, 100]; 50 is the median.
+     * @return The frame time in milliseconds, or 0 if no frame was replayed.
+     */
+    [[nodiscard]] double getPercentile(double percentile) const;
+};
+
+// ============================================================================
+// REPLAY
+// ============================================================================
+
+/**
+ * @brief Replays a trace on the UI thread, frame by frame.
+ *
+ * Each frame dispatches the events recorded within one `frameInterval` to
+ * their windows, flushes the coalesced input, and paints what changed in
+ * the windows it touched. Events are stamped with the replay's own clock,
+ * and dropped files are restored into the `PayloadArena` for the duration
+ * of their dispatch.
+ */
+[[nodiscard]] ReplayReport replayTrace(const event::EventTrace& trace, const ReplayOptions& options = {});
+
+/**
+ * @brief Replays every record of a trace into one window, whatever window recorded it.
+ */
+[[nodiscard]] ReplayReport replayTrace(const event::EventTrace& trace, Window& window, ReplayOptions options = {});
+
+} // namespace frqs::core
@@ -0,0 +1,204 @@
+/**
+ * @file frame_arena.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Per-frame bump allocator for transient layout and render data.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Scratch containers that only live for the duration of a layout pass or a
+ * frame are allocated from a thread-local `FrameArena` instead of the global
+ * heap. The arena is rewound by `FrameArena::Scope` (stack discipline) and
+ * reset by the main loop once per frame. When a frame overflows the main
+ * block, the overflow is served from the heap and the block is grown to the
+ * observed peak on the next reset, so steady-state frames never allocate.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace frqs::core {
+
+// ============================================================================
+// FRAME ARENA
+// ============================================================================
+
+/**
+ * @class FrameArena
+ * @brief A monotonic bump allocator that is reset once per frame.
+ * @note Not thread-safe. Use `forCurrentThread()` to get the calling thread's arena.
+ */
+class FrameArena {
+private:
+    std::byte* buffer_ = nullptr;
+    size_t capacity_ = 0;
+    size_t offset_ = 0;
+    size_t overflowBytes_ = 0;      ///< Bytes served from the heap this frame.
+    size_t peak_ = 0;               ///< Highest usage (buffer + overflow) since the last reset.
+    size_t growCount_ = 0;          ///< Number of times the main block was grown.
+    std::vector<void*> overflow_;   ///< Heap blocks to release on reset.
+
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 64 * 1024;
+
+    explicit FrameArena(size_t capacity = DEFAULT_CAPACITY)
+        : buffer_(static_cast<std::byte*>(::operator new(capacity)))
+        , capacity_(capacity) {
+        overflow_.reserve(16);
+    }
+
+    ~FrameArena() noexcept {
+        releaseOverflow();
+        ::operator delete(buffer_);
+    }
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    /**
+     * @brief Returns the arena of the calling thread.
+     */
+    static FrameArena& forCurrentThread() {
+        thread_local FrameArena arena;
+        return arena;
+    }
+
+    /**
+     * @brief Allocates `size` bytes aligned to `alignment`.
+     * @details Never returns nullptr; falls back to the heap when the main block is full.
+     */
+    [[nodiscard]] void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+        auto base = reinterpret_cast<uintptr_t>(buffer_);
+        auto aligned = (base + offset_ + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+        size_t newOffset = static_cast<size_t>(aligned - base) + size;
+
+        if (newOffset <= capacity_) {
+            offset_ = newOffset;
+            peak_ = std::max(peak_, offset_ + overflowBytes_);
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        // Overflow: serve from the heap, remember the demand for the next reset.
+        void* block = ::operator new(size + alignment);
+        overflow_.push_back(block);
+        overflowBytes_ += size + alignment;
+        peak_ = std::max(peak_, offset_ + overflowBytes_);
+        auto raw = reinterpret_cast<uintptr_t>(block);
+        return reinterpret_cast<void*>((raw + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1));
+    }
+
+    /**
+     * @brief Allocates uninitialized storage for `count` objects of type T.
+     */
+    template <typename T>
+    [[nodiscard]] T* allocateArray(size_t count) {
+        return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    /** @brief Returns the current position, for use with `rewind()`. */
+    [[nodiscard]] size_t mark() const noexcept { return offset_; }
+
+    /** @brief Releases everything allocated from the main block after `position`. */
+    void rewind(size_t position) noexcept {
+        if (position <= offset_) offset_ = position;
+    }
+
+    /**
+     * @brief Releases all allocations. Called once per frame by the main loop.
+     * @details If the previous frame overflowed, the main block is regrown to
+     *          the peak so the same workload fits without overflow next time.
+     */
+    void reset() {
+        bool overflowed = !overflow_.empty();
+        releaseOverflow();
+        offset_ = 0;
+
+        if (overflowed && peak_ > capacity_) {
+            size_t newCapacity = std::max(capacity_ * 2, peak_ + peak_ / 4);
+            ::operator delete(buffer_);
+            buffer_ = static_cast<std::byte*>(::operator new(newCapacity));
+            capacity_ = newCapacity;
+            ++growCount_;
+        }
+        peak_ = 0;
+    }
+
+    [[nodiscard]] size_t getUsed() const noexcept { return offset_ + overflowBytes_; }
+    [[nodiscard]] size_t getCapacity() const noexcept { return capacity_; }
+    [[nodiscard]] size_t getGrowCount() const noexcept { return growCount_; }
+
+    // ========================================================================
+    // SCOPE GUARD (RAII)
+    // ========================================================================
+
+    /**
+     * @class Scope
+     * @brief Rewinds the arena to its position at construction when destroyed.
+     * @details Nested scopes must be destroyed in reverse order (stack discipline),
+     *          which holds naturally for recursive layout passes.
+     */
+    class Scope {
+    private:
+        FrameArena& arena_;
+        size_t mark_;
+
+    public:
+        explicit Scope(FrameArena& arena) noexcept
+            : arena_(arena), mark_(arena.mark()) {}
+        ~Scope() noexcept { arena_.rewind(mark_); }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+private:
+    void releaseOverflow() noexcept {
+        for (void* block : overflow_) {
+            ::operator delete(block);
+        }
+        overflow_.clear();
+        overflowBytes_ = 0;
+    }
+};
+
+// ============================================================================
+// STL ALLOCATOR ADAPTER
+// ============================================================================
+
+/**
+ * @class ArenaAllocator
+ * @brief A standard allocator that draws from a `FrameArena`. Deallocation is a no-op.
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    FrameArena* arena;
+
+    explicit ArenaAllocator(FrameArena& a) noexcept : arena(&a) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {}
+
+    [[nodiscard]] T* allocate(size_t n) { return arena->allocateArray<T>(n); }
+    void deallocate(T*, size_t) noexcept {}
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept { return arena == other.arena; }
+};
+
+/**
+ * @brief A vector whose storage comes from a `FrameArena`.
+ */
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+} // namespace frqs::core
@@ -0,0 +1,168 @@
+/**
+ * @file frame_pacer.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Defines deadline-based frame pacing with a hybrid sleep/spin wait.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Sleeping "one frame" after each frame drifts: every OS wakeup overshoots
+ * a little, and the overshoot adds up, so 60 fps lands near 58 with uneven
+ * steps. The pacer instead keeps an absolute schedule (one deadline per
+ * period, in phase with the first frame). The loop sleeps until a margin
+ * before the deadline, so input and tasks can still wake it. It then yields
+ * the rest of the way. The margin follows the measured oversleep of the OS
+ * wait, so the spin stays as short as the platform allows.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace frqs::core {
+
+// ============================================================================
+// FRAME PACER
+// ============================================================================
+
+/**
+ * @struct FramePacingStats
+ * @brief Counters of the pacer since the target rate was set (or the last `resetStats()`).
+ */
+struct FramePacingStats {
+    uint64_t frames = 0;                    ///< Paced frames started on (or after) their deadline.
+    uint64_t missedFrames = 0;              ///< Deadlines skipped because a frame started a whole period late.
+    uint64_t spins = 0;                     ///< Waits finished by yielding up to the deadline.
+    std::chrono::nanoseconds spinMargin{};  ///< Current margin before a deadline where sleeping stops.
+    std::chrono::nanoseconds maxOversleep{};///< Largest overshoot of a coarse sleep.
+};
+
+/**
+ * @class FramePacer
+ * @brief Schedules frames at absolute deadlines and measures the intervals achieved.
+ *
+ * The loop calls `beginFrame()` when a pass starts, `scheduleNextFrame()` when
+ * it wants another frame, sleeps (interruptibly) until `getSleepUntil()`, and
+ * calls `finishWait()` if that sleep ran its course. When the loop goes idle
+ * it calls `stop()`, so the next burst starts a fresh schedule instead of
+ * counting the idle time as a late frame.
+ *
+ * @note Used from the UI thread only.
+ */
+class FramePacer {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /** @brief The number of recent frame intervals kept for percentiles. */
+    static constexpr size_t HISTORY_SIZE = 256;
+
+private:
+    Clock::duration period_{};                      ///< 0 = unlimited.
+    uint32_t targetFps_ = 0;
+    std::optional<Clock::time_point> deadline_;     ///< Start of the next paced frame.
+    std::optional<Clock::time_point> lastFrame_;    ///< Start of the previous paced frame.
+    Clock::time_point frameTime_{};                 ///< See `getFrameTime()`.
+    Clock::duration spinMargin_ = std::chrono::milliseconds(2);
+    Clock::duration oversleep_{};                   ///< Decaying maximum of recent oversleeps.
+
+    std::array<int64_t, HISTORY_SIZE> intervals_{}; ///< Ring of interval nanoseconds.
+    size_t intervalCount_ = 0;
+    size_t intervalNext_ = 0;
+    FramePacingStats stats_;
+
+public:
+    /** @brief Constructs a pacer targeting `fps` frames per second (0 = unlimited). */
+    explicit FramePacer(uint32_t fps = 60) noexcept { setTargetFps(fps); }
+
+    // ========================================================================
+    // CONFIGURATION
+    // ========================================================================
+
+    /** @brief Sets the target rate (0 = unlimited) and restarts the schedule. */
+    void setTargetFps(uint32_t fps) noexcept;
+
+    /** @brief Gets the target rate (0 = unlimited). */
+    [[nodiscard]] uint32_t getTargetFps() const noexcept { return targetFps_; }
+
+    /** @brief Gets the exact frame period (0 when unlimited). */
+    [[nodiscard]] Clock::duration getPeriod() const noexcept { return period_; }
+
+    // ========================================================================
+    // LOOP INTERFACE
+    // ========================================================================
+
+    /**
+     * @brief Notes that a loop pass starts at `now`.
+     * @details A pass on or after the deadline is a paced frame: its interval
+     *          is recorded and the deadline moves on by whole periods, keeping
+     *          the schedule's phase. An earlier pass (woken by input or a task)
+     *          leaves the schedule alone.
+     */
+    void beginFrame(Clock::time_point now) noexcept;
+
+    /**
+     * @brief Gets the deadline of the next paced frame, starting a schedule if there is none.
+     * @param frameStart When the current pass started.
+     * @return Nothing when the rate is unlimited.
+     */
+    std::optional<Clock::time_point> scheduleNextFrame(Clock::time_point frameStart) noexcept;
+
+    /** @brief Gets when an interruptible sleep towards `deadline` should end. */
+    [[nodiscard]] Clock::time_point getSleepUntil(Clock::time_point deadline) const noexcept {
+        return deadline - spinMargin_;
+    }
+
+    /**
+     * @brief Finishes a sleep that ran to `getSleepUntil(deadline)`.
+     * @details Measures how far the OS overslept to adapt the margin, then
+     *          yields until the deadline.
+     * @param woke When the sleep actually ended.
+     */
+    void finishWait(Clock::time_point deadline, Clock::time_point woke = Clock::now()) noexcept;
+
+    /** @brief Yields until `deadline`, without measuring anything (e.g. the sleep was skipped). */
+    void spinUntil(Clock::time_point deadline) noexcept;
+
+    /** @brief Drops the schedule because the loop goes idle. */
+    void stop() noexcept;
+
+    /**
+     * @brief Gets the timestamp animations should use for the current frame.
+     * @details The deadline a paced frame was scheduled for, so animation steps
+     *          are exactly one period apart whatever the wakeup jitter; the
+     *          actual start of any other pass.
+     */
+    [[nodiscard]] Clock::time_point getFrameTime() const noexcept { return frameTime_; }
+
+    // ========================================================================
+    // METRICS
+    // ========================================================================
+
+    /** @brief Gets the counters. */
+    [[nodiscard]] FramePacingStats getStats() const noexcept;
+
+    /**
+     * @brief Gets a percentile of the recent intervals between paced frames.
+     * @param percentile In [0, 100]; 50 is the median, 99 shows the hitches.
+     * @return 0 if no interval was recorded yet.
+     */
+    [[nodiscard]] std::chrono::nanoseconds getIntervalPercentile(double percentile) const noexcept;
+
+    /** @brief Gets the mean of the recent intervals between paced frames. */
+    [[nodiscard]] std::chrono::nanoseconds getMeanInterval() const noexcept;
+
+    /** @brief Gets the number of intervals the percentiles are computed from. */
+    [[nodiscard]] size_t getIntervalCount() const noexcept { return intervalCount_; }
+
+    /** @brief Zeroes the counters and forgets the recorded intervals. */
+    void resetStats() noexcept;
+
+private:
+    void recordInterval(Clock::duration interval) noexcept;
+};
+
+} // namespace frqs::core
@@ -0,0 +1,147 @@
+/**
+ * @file frame_throttle.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Defines per-window frame-rate policies and the throttle that applies them.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * The loop runs at one rate for all windows, but a window the user is not
+ * looking at does not need every frame. Each window classifies itself once
+ * per frame: the focused window, and any window running an animation, paints
+ * at full rate, other visible windows at a reduced rate, and minimized,
+ * hidden or fully covered windows not at all. Damage held back by the
+ * throttle is kept, not lost: the window paints it in its next admitted frame.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace frqs::core {
+
+// ============================================================================
+// POLICY
+// ============================================================================
+
+/**
+ * @enum FrameRateTier
+ * @brief How often a window paints, from its state in the current frame.
+ */
+enum class FrameRateTier : uint8_t {
+    Full,       ///< Focused or animating: `FrameRatePolicy::focusedFps`.
+    Reduced,    ///< Visible, unfocused and not animating: `FrameRatePolicy::backgroundFps`.
+    Occluded,   ///< Completely covered by other windows: no frames, probed for uncovering.
+    Hidden      ///< Minimized or hidden: no frames until the OS shows it again.
+};
+
+/**
+ * @struct FrameRatePolicy
+ * @brief The paint rates of one window per tier. A rate of 0 means every frame of the loop.
+ */
+struct FrameRatePolicy {
+    uint32_t focusedFps = 0;        ///< Paint rate while focused (0 = the loop's target rate).
+    uint32_t backgroundFps = 15;    ///< Paint rate while visible, unfocused and not animating (0 = the loop's target rate).
+    /** @brief How often an occluded window with pending damage checks if it was uncovered. */
+    std::chrono::milliseconds occlusionProbe{250};
+};
+
+/**
+ * @struct WindowFrameStats
+ * @brief Per-window frame counters since creation (or the last reset).
+ */
+struct WindowFrameStats {
+    uint64_t presented = 0;     ///< Frames drawn and shown (loop paints and OS paint requests).
+    uint64_t fullRate = 0;      ///< Of those, frames not limited to the reduced rate.
+    uint64_t reducedRate = 0;   ///< Of those, frames painted in the `Reduced` tier.
+    uint64_t throttled = 0;     ///< Frames with damage held back by the reduced rate.
+    uint64_t occluded = 0;      ///< Frames with damage skipped while fully covered.
+    uint64_t hidden = 0;        ///< Frames with damage skipped while minimized or hidden.
+    uint64_t damagedArea = 0;   ///< Pixels in the damage of presented frames (overlaps counted twice).
+};
+
+// ============================================================================
+// FRAME THROTTLE
+// ============================================================================
+
+/**
+ * @class FrameThrottle
+ * @brief Decides, frame by frame, whether a window with damage paints now.
+ *
+ * Reduced rates keep an absolute schedule, like the `FramePacer`: at 15 fps
+ * under a 60 fps loop the window paints every fourth frame, not "at least
+ * 66 ms after the last paint", which would round up to every fifth.
+ *
+ * @note Used from the UI thread only.
+ */
+class FrameThrottle {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    FrameRatePolicy policy_;
+    FrameRateTier tier_ = FrameRateTier::Full;
+    std::optional<Clock::time_point> nextPaint_;    ///< Earliest paint of a throttled tier.
+    std::optional<Clock::time_point> retryAt_;      ///< When held-back damage wants the loop back.
+    WindowFrameStats stats_;
+
+public:
+    /**
+     * @brief Classifies a window's state into a tier.
+     * @param occluded Only looked at for visible windows; pass `false` if unknown.
+     * @param animating A frame was requested for the window, or it has running
+     *        tweens or tickers: an animation is not slowed down by losing focus.
+     */
+    [[nodiscard]] static constexpr FrameRateTier classify(bool visible, bool minimized, bool occluded,
+                                                          bool focused, bool animating) noexcept {
+        if (!visible || minimized) return FrameRateTier::Hidden;
+        if (occluded) return FrameRateTier::Occluded;
+        return focused || animating ? FrameRateTier::Full : FrameRateTier::Reduced;
+    }
+
+    /** @brief Replaces the policy; the next frame is admitted at the new rate. */
+    void setPolicy(const FrameRatePolicy& policy) noexcept {
+        policy_ = policy;
+        nextPaint_.reset();
+    }
+
+    /** @brief Gets the policy. */
+    [[nodiscard]] const FrameRatePolicy& getPolicy() const noexcept { return policy_; }
+
+    /**
+     * @brief Decides whether a window with damage paints in the frame at `frameTime`.
+     * @param tier The window's tier in this frame (see `classify()`).
+     * @return `true` to paint now; otherwise `getRetryTime()` says when to try again.
+     */
+    bool admit(FrameRateTier tier, Clock::time_point frameTime) noexcept;
+
+    /** @brief Notes a frame with nothing to paint: no retry is needed. */
+    void noteIdle() noexcept { retryAt_.reset(); }
+
+    /** @brief Notes a presented frame (counted in the tier of the last `admit()`). */
+    void notePresented() noexcept;
+
+    /** @brief Adds the area of a presented frame's damage to the counters. */
+    void noteDamage(uint64_t area) noexcept { stats_.damagedArea += area; }
+
+    /**
+     * @brief Gets when held-back damage should be tried again.
+     * @return Nothing if the last frame painted, had no damage, or waits for the OS
+     *         (a hidden window is shown again by a message that wakes the loop anyway).
+     */
+    [[nodiscard]] std::optional<Clock::time_point> getRetryTime() const noexcept { return retryAt_; }
+
+    /** @brief Gets the tier of the last frame with damage. */
+    [[nodiscard]] FrameRateTier getTier() const noexcept { return tier_; }
+
+    /** @brief Gets the counters. */
+    [[nodiscard]] const WindowFrameStats& getStats() const noexcept { return stats_; }
+
+    /** @brief Zeroes the counters. */
+    void resetStats() noexcept { stats_ = WindowFrameStats{}; }
+};
+
+} // namespace frqs::core
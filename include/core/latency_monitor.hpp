@@ -0,0 +1,164 @@
+/**
+ * @file latency_monitor.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Measures input-to-present latency per event type.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * When a dispatched event causes an invalidation, the window remembers the
+ * event's creation timestamp until the next frame is presented. At present
+ * time the latency (present - creation) is added to the histogram of the
+ * event's type, and a callback fires if it exceeds the configured budget.
+ * Users notice this latency long before they notice a lower frame rate.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include "event/event.hpp"
+
+namespace frqs::core {
+
+// ============================================================================
+// LATENCY HISTOGRAM
+// ============================================================================
+
+/**
+ * @class LatencyHistogram
+ * @brief A fixed-size, log-scale histogram of durations.
+ *
+ * Buckets split every power of two (from 1 µs) into four steps, so a
+ * percentile is accurate to within about 19% at any scale. Recording is
+ * O(1) and never allocates.
+ */
+class LatencyHistogram {
+public:
+    static constexpr size_t SUB_BUCKETS = 4;      ///< Buckets per power of two.
+    static constexpr size_t OCTAVES = 28;         ///< 1 µs .. ~4.5 minutes.
+    static constexpr size_t BUCKET_COUNT = SUB_BUCKETS * OCTAVES;
+
+private:
+    std::array<uint64_t, BUCKET_COUNT> buckets_{};
+    uint64_t count_ = 0;
+    uint64_t sumNs_ = 0;
+    uint64_t minNs_ = UINT64_MAX;
+    uint64_t maxNs_ = 0;
+
+public:
+    /** @brief Adds one sample. */
+    void record(std::chrono::nanoseconds latency) noexcept;
+
+    /** @brief Removes all samples. */
+    void reset() noexcept;
+
+    /** @brief Gets the number of samples. */
+    [[nodiscard]] uint64_t getCount() const noexcept { return count_; }
+    /** @brief Gets the smallest sample (0 if empty). */
+    [[nodiscard]] std::chrono::nanoseconds getMin() const noexcept;
+    /** @brief Gets the largest sample. */
+    [[nodiscard]] std::chrono::nanoseconds getMax() const noexcept { return std::chrono::nanoseconds(maxNs_); }
+    /** @brief Gets the mean sample (0 if empty). */
+    [[nodiscard]] std::chrono::nanoseconds getMean() const noexcept;
+
+    /**
+     * @brief Gets a percentile, resolved to the upper bound of its bucket.
+     * @param percentile In [0, 100]; 50 is the median.
+     */
+    [[nodiscard]] std::chrono::nanoseconds getPercentile(double percentile) const noexcept;
+
+    /** @brief Gets the raw bucket counts. */
+    [[nodiscard]] const std::array<uint64_t, BUCKET_COUNT>& getBuckets() const noexcept { return buckets_; }
+    /** @brief Gets the exclusive upper bound of a bucket. */
+    [[nodiscard]] static std::chrono::nanoseconds getBucketUpperBound(size_t bucket) noexcept;
+
+private:
+    [[nodiscard]] static size_t bucketFor(uint64_t ns) noexcept;
+};
+
+// ============================================================================
+// LATENCY MONITOR
+// ============================================================================
+
+/**
+ * @struct LatencySample
+ * @brief One measured input-to-present latency, as passed to the budget callback.
+ */
+struct LatencySample {
+    size_t eventIndex;                    ///< `Event::index()` of the originating event.
+    std::chrono::nanoseconds latency;     ///< Time from event creation to present.
+};
+
+/**
+ * @class LatencyMonitor
+ * @brief Per-window input-to-present latency tracking.
+ *
+ * For every event type, the oldest unpresented input is kept: if a frame
+ * answers several events of one type, the latency reported is that of the
+ * user's first action, which is what they waited for.
+ *
+ * @note Used from the UI thread only.
+ */
+class LatencyMonitor {
+public:
+    using BudgetCallback = std::function<void(const LatencySample&)>;
+
+private:
+    static constexpr size_t EVENT_TYPE_COUNT = std::variant_size_v<event::Event>;
+
+    std::array<LatencyHistogram, EVENT_TYPE_COUNT> histograms_{};
+    std::array<uint64_t, EVENT_TYPE_COUNT> pending_{};   ///< Oldest unpresented timestamp per type (0 = none).
+    bool hasPending_ = false;
+    std::chrono::nanoseconds budget_ = std::chrono::milliseconds(50);
+    BudgetCallback overBudget_;
+    uint64_t overBudgetCount_ = 0;
+
+public:
+    LatencyMonitor() = default;
+
+    /**
+     * @brief Notes that an event with the given creation timestamp changed what is on screen.
+     * @param eventIndex `Event::index()` of the event.
+     * @param timestamp The event's `timestamp` (see `event::eventTimestampNow()`).
+     */
+    void notePending(size_t eventIndex, uint64_t timestamp) noexcept;
+
+    /**
+     * @brief Closes out every pending input at present time.
+     * @param presentTimestamp When the frame was presented, on the event clock.
+     */
+    void notePresented(uint64_t presentTimestamp);
+
+    /** @brief Checks if an input is waiting for the next present. */
+    [[nodiscard]] bool hasPending() const noexcept { return hasPending_; }
+
+    /**
+     * @brief Sets the latency budget and the callback fired for every sample above it.
+     * @details The callback runs on the UI thread right after present; keep it short.
+     */
+    void setBudget(std::chrono::nanoseconds budget, BudgetCallback callback = {});
+    /** @brief Gets the latency budget. */
+    [[nodiscard]] std::chrono::nanoseconds getBudget() const noexcept { return budget_; }
+    /** @brief Gets the number of samples that exceeded the budget. */
+    [[nodiscard]] uint64_t getOverBudgetCount() const noexcept { return overBudgetCount_; }
+
+    /** @brief Gets the histogram of events with the given `Event::index()`. */
+    [[nodiscard]] const LatencyHistogram& getHistogram(size_t eventIndex) const noexcept {
+        return histograms_[eventIndex < EVENT_TYPE_COUNT ? eventIndex : 0];
+    }
+
+    /** @brief Gets the histogram of event type `T`. */
+    template <event::EventType T>
+    [[nodiscard]] const LatencyHistogram& getHistogram() const noexcept {
+        return histograms_[event::eventIndex<T>];
+    }
+
+    /** @brief Clears all histograms and counters. Pending inputs are kept. */
+    void reset() noexcept;
+};
+
+} // namespace frqs::core
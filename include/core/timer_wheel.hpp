@@ -0,0 +1,264 @@
+/**
+ * @file timer_wheel.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Defines a hierarchical timer wheel and debounce/throttle helpers for the UI thread.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Caret blink, tooltips, key auto-repeat and polling refreshes need many
+ * cheap timers. The wheel has four levels of 64 slots with 1 ms ticks: a timer
+ * lands in the level whose span covers its distance, and moves down a level
+ * each time the wheel reaches its slot. Adding, rescheduling and cancelling a
+ * timer are O(1); finding the next deadline is O(levels), using one occupancy
+ * bitmap per level.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include "platform/message_queue.hpp"
+
+namespace frqs::core {
+
+// ============================================================================
+// TIMER WHEEL
+// ============================================================================
+
+/**
+ * @brief Identifies a scheduled timer. 0 is never a valid id.
+ * @details Ids are not reused while their timer lives, so cancelling an id
+ *          whose timer already fired is harmless.
+ */
+using TimerId = uint64_t;
+
+/** @brief The id returned for "no timer". */
+inline constexpr TimerId INVALID_TIMER = 0;
+
+/**
+ * @class TimerWheel
+ * @brief One-shot and periodic timers driven by the UI loop.
+ *
+ * Timers never fire early. They fire from `advance()`, on the thread that
+ * calls it (the UI thread for `Application::getTimers()`), in deadline order
+ * at 1 ms resolution. Timers further than about 4.6 hours out are parked in
+ * the top level and re-placed when it comes round.
+ *
+ * @note Not thread-safe. Other threads schedule through `Application::postDelayed`.
+ */
+class TimerWheel {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t LEVELS = 4;
+    static constexpr size_t SLOT_BITS = 6;
+    static constexpr size_t SLOTS = size_t{1} << SLOT_BITS;     ///< Slots per level.
+
+private:
+    static constexpr uint32_t NIL = UINT32_MAX;
+
+    enum class State : uint8_t { Free, Armed, Running, Cancelled };
+
+    /**
+     * @struct Node
+     * @brief A timer; linked into its slot by index so the pool can grow.
+     * @internal
+     */
+    struct Node {
+        platform::UniqueTask task;
+        uint64_t expiry = 0;        ///< Tick at which it fires.
+        uint64_t period = 0;        ///< Ticks between firings; 0 = one-shot.
+        uint32_t prev = NIL;
+        uint32_t next = NIL;
+        uint32_t generation = 1;
+        uint8_t level = 0;
+        uint8_t slot = 0;
+        State state = State::Free;
+    };
+
+    std::vector<Node> nodes_;
+    uint32_t freeHead_ = NIL;                                   ///< Free nodes, linked through `next`.
+    std::array<std::array<uint32_t, SLOTS>, LEVELS> heads_;
+    std::array<uint64_t, LEVELS> occupied_{};                   ///< Bit s set = slot s non-empty.
+    size_t armed_ = 0;
+    uint64_t now_ = 0;                                          ///< Current tick (ms since epoch_).
+    Clock::time_point epoch_;
+
+public:
+    /** @brief Constructs an empty wheel whose tick 0 is `start`. */
+    explicit TimerWheel(Clock::time_point start = Clock::now());
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    // ========================================================================
+    // SCHEDULING
+    // ========================================================================
+
+    /**
+     * @brief Runs `task` once at `deadline` (or at the next tick if it has passed).
+     * @return The timer's id, for `cancel()` and `reschedule()`.
+     */
+    TimerId scheduleAt(Clock::time_point deadline, platform::UiTask task);
+
+    /** @brief Runs `task` once after `delay`. */
+    TimerId schedule(Clock::duration delay, platform::UiTask task) {
+        return scheduleAt(Clock::now() + delay, std::move(task));
+    }
+
+    /**
+     * @brief Runs `task` every `interval`, first after `firstDelay` (default: one interval).
+     * @details If the loop falls behind, missed periods are skipped rather than
+     *          run back to back.
+     */
+    TimerId schedulePeriodic(Clock::duration interval, platform::UiTask task,
+                             std::optional<Clock::duration> firstDelay = std::nullopt) {
+        return schedulePeriodicAt(Clock::now() + firstDelay.value_or(interval), interval, std::move(task));
+    }
+
+    /** @brief Runs `task` at `firstDeadline`, then every `interval` after it. */
+    TimerId schedulePeriodicAt(Clock::time_point firstDeadline, Clock::duration interval,
+                               platform::UiTask task);
+
+    /**
+     * @brief Moves a pending timer to a new deadline.
+     * @return `false` if the timer already fired or was cancelled.
+     */
+    bool reschedule(TimerId id, Clock::time_point deadline);
+
+    /**
+     * @brief Cancels a timer. A periodic timer may cancel itself from its own task.
+     * @return `false` if the id is unknown, fired, or already cancelled.
+     */
+    bool cancel(TimerId id);
+
+    /** @brief Checks if a timer is still going to fire. */
+    [[nodiscard]] bool isPending(TimerId id) const noexcept;
+
+    // ========================================================================
+    // DRIVING THE WHEEL
+    // ========================================================================
+
+    /**
+     * @brief Fires every timer due at or before `now`.
+     * @return The number of tasks run.
+     */
+    size_t advance(Clock::time_point now = Clock::now());
+
+    /**
+     * @brief Gets when `advance()` next has work, or nothing if no timer is armed.
+     * @details Far timers may report an earlier time, when they move down a
+     *          level; the loop then wakes once without running anything.
+     */
+    [[nodiscard]] std::optional<Clock::time_point> getNextDeadline() const noexcept;
+
+    /** @brief Gets the number of armed timers. */
+    [[nodiscard]] size_t size() const noexcept { return armed_; }
+
+    /** @brief Checks if no timer is armed. */
+    [[nodiscard]] bool empty() const noexcept { return armed_ == 0; }
+
+private:
+    [[nodiscard]] uint64_t toTick(Clock::time_point time, bool roundUp) const noexcept;
+    [[nodiscard]] std::optional<uint64_t> nextEventTick() const noexcept;
+
+    [[nodiscard]] static TimerId makeId(uint32_t index, uint32_t generation) noexcept {
+        return (static_cast<uint64_t>(generation) << 32) | index;
+    }
+    [[nodiscard]] Node* resolve(TimerId id) noexcept;
+    [[nodiscard]] const Node* resolve(TimerId id) const noexcept;
+
+    uint32_t allocate();
+    void release(uint32_t index) noexcept;
+    void link(uint32_t index) noexcept;
+    void unlink(uint32_t index) noexcept;
+    uint32_t popSlot(size_t level, size_t slot) noexcept;
+    size_t fireSlot(size_t slot, uint64_t target);
+};
+
+// ============================================================================
+// DEBOUNCE / THROTTLE
+// ============================================================================
+
+/**
+ * @class Debouncer
+ * @brief Runs the latest triggered task once triggers have paused for `delay`.
+ *
+ * Each `trigger()` replaces the pending task and restarts the delay (an O(1)
+ * reschedule), e.g. to search only after the user stops typing.
+ *
+ * @note Must outlive its pending timer; the destructor cancels it.
+ */
+class Debouncer {
+private:
+    TimerWheel& wheel_;
+    TimerWheel::Clock::duration delay_;
+    platform::UiTask pending_;
+    TimerId timer_ = INVALID_TIMER;
+
+public:
+    Debouncer(TimerWheel& wheel, TimerWheel::Clock::duration delay) noexcept
+        : wheel_(wheel), delay_(delay) {}
+    ~Debouncer() { cancel(); }
+
+    Debouncer(const Debouncer&) = delete;
+    Debouncer& operator=(const Debouncer&) = delete;
+
+    /** @brief Replaces the pending task and restarts the delay from `now`. */
+    void trigger(platform::UiTask task, TimerWheel::Clock::time_point now = TimerWheel::Clock::now());
+
+    /** @brief Drops the pending task. */
+    void cancel();
+
+    /** @brief Checks if a task is waiting for the delay to pass. */
+    [[nodiscard]] bool isPending() const noexcept { return wheel_.isPending(timer_); }
+};
+
+/**
+ * @class Throttler
+ * @brief Runs triggered tasks at most once per `interval`.
+ *
+ * A trigger outside the interval runs at once. Triggers inside it collapse
+ * into one trailing run of the latest task at the end of the interval, so
+ * the final state is never lost.
+ *
+ * @note Must outlive its pending timer; the destructor cancels it.
+ */
+class Throttler {
+private:
+    TimerWheel& wheel_;
+    TimerWheel::Clock::duration interval_;
+    platform::UiTask pending_;
+    TimerId timer_ = INVALID_TIMER;
+    std::optional<TimerWheel::Clock::time_point> lastRun_;
+
+public:
+    Throttler(TimerWheel& wheel, TimerWheel::Clock::duration interval) noexcept
+        : wheel_(wheel), interval_(interval) {}
+    ~Throttler() { cancel(); }
+
+    Throttler(const Throttler&) = delete;
+    Throttler& operator=(const Throttler&) = delete;
+
+    /**
+     * @brief Runs `task` now if the interval allows, otherwise keeps it as the trailing run.
+     * @param now The trigger time; the interval is measured from the last run's.
+     */
+    void trigger(platform::UiTask task, TimerWheel::Clock::time_point now = TimerWheel::Clock::now());
+
+    /** @brief Drops the trailing run, if any. */
+    void cancel();
+
+    /** @brief Checks if a trailing run is scheduled. */
+    [[nodiscard]] bool isPending() const noexcept { return wheel_.isPending(timer_); }
+
+private:
+    void runPending();
+};
+
+} // namespace frqs::core
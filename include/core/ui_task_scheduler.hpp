@@ -0,0 +1,193 @@
+/**
+ * @file ui_task_scheduler.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Defines priority lanes and a per-frame time budget for UI tasks.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Draining every posted task in FIFO order lets one burst of background work
+ * delay input handling and rendering for as long as the burst takes. The
+ * scheduler gives tasks a lane: critical tasks always run in full, and the
+ * other lanes share a per-frame time budget in priority order. Whatever does
+ * not fit stays queued for the next frame, so frame times stay flat while
+ * workers flood the UI.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "core/latency_monitor.hpp"
+#include "platform/message_queue.hpp"
+
+namespace frqs::core {
+
+// ============================================================================
+// TASK LANES
+// ============================================================================
+
+/**
+ * @enum TaskLane
+ * @brief The priority of a UI task, highest first.
+ */
+enum class TaskLane : uint8_t {
+    Critical,       ///< Input handling and anything the user is waiting on; never budgeted.
+    Animation,      ///< Work the next frame needs (animation steps, layout for visible content).
+    Normal,         ///< Default for `postToUiThread`.
+    Idle            ///< Background work that may wait several frames (prefetch, cache trimming).
+};
+
+/** @brief The number of task lanes. */
+inline constexpr size_t TASK_LANE_COUNT = 4;
+
+/**
+ * @struct TaskLaneStats
+ * @brief Counters of one lane since construction (or the last `resetStats()`).
+ */
+struct TaskLaneStats {
+    uint64_t posted = 0;            ///< Tasks posted to the lane.
+    uint64_t executed = 0;          ///< Tasks run.
+    size_t depth = 0;               ///< Tasks currently queued.
+    size_t maxDepth = 0;            ///< Largest depth seen at the start of a frame.
+    uint64_t carriedFrames = 0;     ///< Frames that ended with tasks left in the lane.
+    uint64_t guaranteedRuns = 0;    ///< Tasks run past the budget by starvation protection.
+};
+
+// ============================================================================
+// UI TASK SCHEDULER
+// ============================================================================
+
+/**
+ * @class UiTaskScheduler
+ * @brief Multi-lane UI task queue drained under a per-frame time budget.
+ *
+ * Any thread may post; the UI thread calls `runFrame()` once per loop
+ * iteration. Each frame runs, in order:
+ * 1. every critical task posted before the frame started;
+ * 2. animation, normal and idle tasks, in that order, until the frame budget
+ *    is spent;
+ * 3. starvation protection: each lower lane that is still waiting runs up to
+ *    `getMinTasksPerLane()` tasks even if the budget is gone, so a flooded
+ *    higher lane cannot stall it forever.
+ *
+ * The time every task waited in its queue is recorded per lane.
+ */
+class UiTaskScheduler {
+private:
+    /**
+     * @struct Entry
+     * @brief A queued task and the time it was posted.
+     * @internal
+     */
+    struct Entry {
+        platform::UiTask task;
+        uint64_t postedAt = 0;          ///< steady_clock nanoseconds.
+    };
+
+    /**
+     * @struct Lane
+     * @brief One priority level.
+     * @internal
+     */
+    struct Lane {
+        platform::MpscQueue<Entry> queue;
+        alignas(64) std::atomic<uint64_t> posted{0};   ///< Bumped after each push; the wake publication.
+        uint64_t executed = 0;
+        size_t maxDepth = 0;
+        uint64_t carriedFrames = 0;
+        uint64_t guaranteedRuns = 0;
+        uint64_t postedBase = 0;                        ///< `posted` at the last resetStats().
+        uint64_t executedBase = 0;
+        LatencyHistogram wait;
+    };
+
+    std::array<Lane, TASK_LANE_COUNT> lanes_;
+    platform::WakeSignal wake_;
+    uint64_t postedAtLastFrame_ = 0;    ///< Sum of `posted` when the last frame started.
+    std::chrono::nanoseconds frameBudget_ = std::chrono::milliseconds(4);
+    size_t minTasksPerLane_ = 1;
+
+public:
+    UiTaskScheduler() = default;
+
+    UiTaskScheduler(const UiTaskScheduler&) = delete;
+    UiTaskScheduler& operator=(const UiTaskScheduler&) = delete;
+
+    /**
+     * @brief Queues a task and wakes the UI loop if it sleeps.
+     * @note This method is thread-safe.
+     */
+    void post(platform::UiTask task, TaskLane lane = TaskLane::Normal);
+
+    /**
+     * @brief Runs one frame's worth of tasks (see the class description).
+     * @return The number of tasks run.
+     * @note UI thread only.
+     */
+    size_t runFrame();
+
+    /**
+     * @brief Sleeps until a task is posted or `timeout` elapses. UI thread only.
+     * @details Tasks carried over from the previous frame do not end the
+     *          sleep; they wait for the next frame as intended.
+     * @return `true` if woken by a new task.
+     */
+    template <typename Rep, typename Period>
+    bool waitFor(const std::chrono::duration<Rep, Period>& timeout) {
+        return wake_.waitFor(timeout, [this] { return hasNewTasks(); });
+    }
+
+    /**
+     * @brief Checks if a task was posted since the last frame started.
+     * @details Reads the lanes' publication with seq_cst loads, so it can serve
+     *          as (part of) the `ready` predicate of a `WakeSignal` wait.
+     */
+    [[nodiscard]] bool hasNewTasks() const noexcept { return getPostedTotal() != postedAtLastFrame_; }
+
+    /** @brief Gets the wakeup signal, e.g. to install a native wake handler. */
+    [[nodiscard]] platform::WakeSignal& getWakeSignal() noexcept { return wake_; }
+
+    /** @brief Checks if any lane holds a task. UI thread only. */
+    [[nodiscard]] bool hasPending() const noexcept;
+
+    // ========================================================================
+    // CONFIGURATION
+    // ========================================================================
+
+    /** @brief Sets the time non-critical lanes may use per frame. */
+    void setFrameBudget(std::chrono::nanoseconds budget) noexcept { frameBudget_ = budget; }
+    /** @brief Gets the time non-critical lanes may use per frame. */
+    [[nodiscard]] std::chrono::nanoseconds getFrameBudget() const noexcept { return frameBudget_; }
+
+    /** @brief Sets how many tasks each waiting lane runs per frame regardless of the budget (0 disables). */
+    void setMinTasksPerLane(size_t count) noexcept { minTasksPerLane_ = count; }
+    /** @brief Gets how many tasks each waiting lane runs per frame regardless of the budget. */
+    [[nodiscard]] size_t getMinTasksPerLane() const noexcept { return minTasksPerLane_; }
+
+    // ========================================================================
+    // METRICS
+    // ========================================================================
+
+    /** @brief Gets the counters of a lane. UI thread only. */
+    [[nodiscard]] TaskLaneStats getLaneStats(TaskLane lane) const noexcept;
+
+    /** @brief Gets the distribution of time tasks of a lane spent queued. UI thread only. */
+    [[nodiscard]] const LatencyHistogram& getWaitHistogram(TaskLane lane) const noexcept {
+        return lanes_[static_cast<size_t>(lane)].wait;
+    }
+
+    /** @brief Zeroes all counters and histograms. Queued tasks are kept. UI thread only. */
+    void resetStats() noexcept;
+
+private:
+    [[nodiscard]] uint64_t getPostedTotal() const noexcept;
+
+    /** @brief Runs one entry and records its wait. */
+    void runEntry(Lane& lane, Entry& entry, uint64_t now);
+};
+
+} // namespace frqs::core
@@ -11,9 +11,13 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <string>
 #include "window_id.hpp"
+#include "frame_throttle.hpp"
+#include "latency_monitor.hpp"
 #include "unit/rect.hpp"
 #include "widget/iwidget.hpp"
 #include "event/event.hpp"
@@ -23,6 +27,10 @@ namespace frqs::platform {
     class Win32WindowClass;
 }
 
+namespace frqs::event {
+    class EventRecorder;
+}
+
 namespace frqs::core {
 
 // Forward declarations
@@ -176,6 +184,71 @@ public:
     void invalidateRect(const widget::Rect<int32_t, uint32_t>& rect) noexcept;
     /** @brief Forces an immediate, synchronous redraw of the window's invalid regions. */
     void forceRedraw() noexcept;
+    /**
+     * @brief Hands all invalidations queued since the last flush to the OS.
+     * @details Called by the application loop once per frame. Overlapping
+     *          requests are merged, so a layout pass yields few OS calls.
+     */
+    void flushInvalidations() noexcept;
+
+    /**
+     * @brief Lays out every container that asked for it since the last pass, parents first.
+     * @details Called by the application loop once per frame; painting runs
+     *          it too, so a frame is never drawn with a stale layout.
+     * @return The number of layouts run.
+     */
+    size_t runLayoutPass();
+    /**
+     * @brief Draws the regions invalidated since the last frame, without a WM_PAINT round trip.
+     * @details Called by the application loop once per frame, after the
+     *          layout pass. Nothing is drawn if nothing was invalidated, or
+     *          if the frame-rate policy holds the damage back for a later frame.
+     * @param frameTime The loop's frame time, for the reduced-rate schedule.
+     * @return `true` if the window drew a frame; `present()` shows it.
+     */
+    bool paint(std::chrono::steady_clock::time_point frameTime);
+    /** @brief Presents the frame drawn by `paint()`, if any. */
+    void present();
+
+    /**
+     * @brief Gets when damage held back by the frame-rate policy should be painted.
+     * @return Nothing if no damage is waiting, or it waits for the window to be shown.
+     */
+    std::optional<std::chrono::steady_clock::time_point> getNextPaintTime() const noexcept;
+
+    // --- Frame Rate ---
+
+    /**
+     * @brief Sets the window's paint rates while focused and while in the background.
+     * @details Minimized, hidden and fully covered windows never paint. The
+     *          default paints background windows at 15 fps.
+     */
+    void setFrameRatePolicy(const FrameRatePolicy& policy) noexcept;
+    /** @brief Gets the window's frame-rate policy. */
+    const FrameRatePolicy& getFrameRatePolicy() const noexcept;
+    /**
+     * @brief Keeps the loop running one more frame, and this window at full rate in it.
+     * @details Like `Application::requestAnimationFrame()`, for an animation drawn
+     *          in this window: unfocused, it would otherwise paint at the background
+     *          rate. Tweens of the window's widgets count without calling this.
+     */
+    void requestAnimationFrame() noexcept;
+    /** @brief Gets the tier the window painted (or was held back) in, in its last frame with damage. */
+    FrameRateTier getFrameRateTier() const noexcept;
+    /** @brief Gets the window's frame counters. */
+    const WindowFrameStats& getFrameStats() const noexcept;
+    /** @brief Zeroes the window's frame counters. */
+    void resetFrameStats() noexcept;
+
+    /**
+     * @brief Enables automatic damage tracking via display-list diffing.
+     * @details Each frame is recorded first and diffed per widget against the
+     *          previous one; only regions whose drawing commands changed are
+     *          repainted, regardless of how widgets invalidated themselves.
+     */
+    void setAutoDamage(bool enabled) noexcept;
+    /** @brief Checks if automatic damage tracking is enabled. */
+    bool isAutoDamageEnabled() const noexcept;
 	
     /**
      * @brief Dispatches an event to the window's widget hierarchy.
@@ -183,6 +256,44 @@ public:
      */
 	void dispatchEvent(const event::Event& event);
 
+    /**
+     * @brief Dispatches the mouse move coalesced since the last frame, if any.
+     * @details Called by the application loop once per frame. The dispatched
+     *          event exposes every raw sample it replaces via `getSamples()`.
+     */
+    void flushPendingInput();
+
+    /**
+     * @brief Gets the leaf widget currently under the cursor.
+     * @return The hovered widget, or nullptr if the cursor is outside the tree.
+     */
+    widget::IWidget* getHoveredWidget() const noexcept;
+
+    /**
+     * @brief Moves keyboard focus to `widget` (nullptr clears it).
+     * @return `true` if focus changed; `false` if `widget` is not in this window's tree.
+     */
+    bool setFocusedWidget(widget::IWidget* widget);
+
+    /** @brief Gets the widget that receives keyboard input, or nullptr. */
+    widget::IWidget* getFocusedWidget() const noexcept;
+
+    /**
+     * @brief Records every event passed to `dispatchEvent` into `recorder` (nullptr detaches).
+     * @details One recorder can be shared by several windows; records carry the window id.
+     */
+    void setEventRecorder(std::shared_ptr<event::EventRecorder> recorder) noexcept;
+    /** @brief Gets the attached recorder, or nullptr. */
+    std::shared_ptr<event::EventRecorder> getEventRecorder() const noexcept;
+
+    /**
+     * @brief Gets the window's input-to-present latency histograms.
+     * @details Configure the budget and its callback with `LatencyMonitor::setBudget()`.
+     */
+    LatencyMonitor& getLatencyMonitor() noexcept;
+    /** @brief Gets the window's input-to-present latency histograms. */
+    const LatencyMonitor& getLatencyMonitor() const noexcept;
+
     /**
      * @brief Gets the window's unique identifier.
      * @return The `WindowId` assigned by the `WindowRegistry`.
@@ -207,6 +318,12 @@ private:
      * @internal This is the private implementation of the unsafe backdoor.
      */
     void* getNativeHandleUnsafe() const noexcept;
+
+    /**
+     * @brief Delivers an event to the widget tree (hit test, focus, or broadcast).
+     * @internal Called by `dispatchEvent` after its bookkeeping.
+     */
+    void routeEvent(const event::Event& event);
 };
 
 } // namespace frqs::core
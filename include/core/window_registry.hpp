@@ -149,6 +149,23 @@ public:
         return result;
     }
 
+    /**
+     * @brief Fills `out` with all registered windows, sorted by Z-order (top-most first).
+     * @details Reuses the caller's buffer, so per-frame callers that keep the
+     *          vector around do not allocate once its capacity has settled.
+     * @param out Receives the windows; its previous contents are discarded.
+     */
+    void getAllWindows(std::vector<WindowPtr>& out) const {
+        std::lock_guard lock(mutex_);
+        out.clear();
+        
+        for (const auto& id : zOrder_) {
+            if (auto it = windows_.find(id); it != windows_.end()) {
+                out.push_back(it->second);
+            }
+        }
+    }
+
     /**
      * @brief Gets the current number of registered windows.
      * @return The number of windows in the registry.
@@ -0,0 +1,149 @@
+/**
+ * @file deferred_event_queue.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Defines a bounded multi-producer ring buffer for events delivered later in one batch.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Worker threads publish status events far faster than the UI can usefully
+ * show them. `DeferredEventQueue` stores `Event` values in a fixed ring (no
+ * allocation per event, no lock for unkeyed events) and hands them to the UI
+ * thread in one batch per frame. Events published with a coalescing key
+ * replace an undelivered event with the same key instead of queueing again.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "event.hpp"
+
+namespace frqs::event {
+
+// ============================================================================
+// DEFERRED EVENT STATISTICS
+// ============================================================================
+
+/**
+ * @struct DeferredEventStats
+ * @brief Counters of a `DeferredEventQueue` since construction.
+ */
+struct DeferredEventStats {
+    uint64_t published = 0;   ///< Events accepted (including coalesced ones).
+    uint64_t delivered = 0;   ///< Events handed to the drain handler.
+    uint64_t dropped = 0;     ///< Events rejected because the ring was full.
+    uint64_t coalesced = 0;   ///< Events that replaced a pending event with the same key.
+};
+
+// ============================================================================
+// DEFERRED EVENT QUEUE (Bounded MPMC ring)
+// ============================================================================
+
+/**
+ * @class DeferredEventQueue
+ * @brief A bounded, lock-free multi-producer ring buffer of events.
+ *
+ * Unkeyed events take one CAS to enqueue. Keyed events go through a small
+ * table that holds the latest value per key; the ring only carries a marker
+ * at the position of the key's first pending publish, so a coalesced event
+ * keeps its original place in the delivery order but arrives with the newest
+ * payload. When the ring is full, new events are dropped and counted.
+ */
+class DeferredEventQueue {
+public:
+    /** @brief Key value meaning "never coalesce". */
+    static constexpr uint64_t NO_KEY = 0;
+    /** @brief Default ring capacity, in events. */
+    static constexpr size_t DEFAULT_CAPACITY = 4096;
+
+private:
+    /**
+     * @struct Cell
+     * @brief One ring slot, stamped with a sequence number (Vyukov's scheme).
+     * @internal
+     */
+    struct Cell {
+        std::atomic<size_t> sequence;
+        Event event;
+        uint64_t key = NO_KEY;
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_;
+    alignas(64) std::atomic<size_t> enqueuePos_{0};
+    alignas(64) std::atomic<size_t> dequeuePos_{0};
+
+    /// @brief Latest undelivered value per coalescing key.
+    std::mutex keyedMutex_;
+    std::unordered_map<uint64_t, Event> keyed_;
+
+    alignas(64) std::atomic<uint64_t> published_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> coalesced_{0};
+    std::atomic<uint64_t> delivered_{0};
+
+public:
+    /**
+     * @brief Constructs the queue.
+     * @param capacity Maximum number of pending events; rounded up to a power of two.
+     */
+    explicit DeferredEventQueue(size_t capacity = DEFAULT_CAPACITY);
+
+    DeferredEventQueue(const DeferredEventQueue&) = delete;
+    DeferredEventQueue& operator=(const DeferredEventQueue&) = delete;
+
+    /**
+     * @brief Queues an event for the next drain. Safe from any thread.
+     * @details Only the event record is stored: a `MouseMoveEvent` loses its
+     *          dispatch-time samples, and a payload handle (`FileDropEvent`)
+     *          resolves to nothing if its payload is released before the drain.
+     * @param event The event to queue.
+     * @param key A coalescing key; a pending event with the same key is
+     *            replaced. `NO_KEY` always queues.
+     * @return `false` if the ring was full and the event was dropped.
+     */
+    bool publish(const Event& event, uint64_t key = NO_KEY);
+
+    /**
+     * @brief Delivers the events queued before this call, oldest first.
+     * @details Events published while draining (including from the handler)
+     *          wait for the next drain, so one call is bounded.
+     * @param handler Called with each event; typically `EventBus::broadcast`.
+     * @param maxEvents Upper bound on events delivered by this call.
+     * @return The number of events delivered.
+     */
+    template <typename Handler>
+    size_t drain(Handler&& handler, size_t maxEvents = SIZE_MAX) {
+        size_t end = enqueuePos_.load(std::memory_order_acquire);
+        size_t count = 0;
+        Event event;
+        while (count < maxEvents && dequeuePos_.load(std::memory_order_relaxed) != end) {
+            if (!tryPop(event)) break;    // Producer still writing this slot
+            handler(static_cast<const Event&>(event));
+            ++count;
+        }
+        delivered_.fetch_add(count, std::memory_order_relaxed);
+        return count;
+    }
+
+    /** @brief Gets the ring capacity. */
+    [[nodiscard]] size_t getCapacity() const noexcept { return mask_ + 1; }
+
+    /** @brief Gets an approximate count of pending events. */
+    [[nodiscard]] size_t getPendingCount() const noexcept;
+
+    /** @brief Reads the counters. Each value is individually consistent. */
+    [[nodiscard]] DeferredEventStats getStats() const noexcept;
+
+private:
+    bool tryPush(const Event& event, uint64_t key) noexcept;
+    bool tryPop(Event& out);
+};
+
+} // namespace frqs::event
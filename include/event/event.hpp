@@ -11,6 +11,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 #include <variant>
 #include "event_types.hpp"
 
@@ -28,7 +31,7 @@ namespace frqs::event {
  * performance for frequently occurring ("hot") events and flexibility for
  * less frequent ("cold") events.
  *
- * @see MouseMoveEvent, MouseButtonEvent, KeyEvent, ResizeEvent, PaintEvent, FileDropEvent, MouseWheelEvent
+ * @see MouseMoveEvent, MouseButtonEvent, KeyEvent, ResizeEvent, PaintEvent, FileDropEvent, MouseWheelEvent, MouseHoverEvent, FocusEvent
  */
 using Event = std::variant<
     std::monostate,        ///< Represents an empty or null event.
@@ -37,13 +40,29 @@ using Event = std::variant<
     KeyEvent,              ///< Event for keyboard key presses/releases. (Hot path)
     ResizeEvent,           ///< Event for window resizing. (Hot path)
     PaintEvent,            ///< Event signaling a need to repaint a region. (Hot path)
-    FileDropEvent,         ///< Event for files dropped onto a window. (Cold path, variable size)
-    MouseWheelEvent        ///< Event for mouse wheel scrolling. (Hot path)
+    FileDropEvent,         ///< Event for files dropped onto a window. (Cold path, payload out of line)
+    MouseWheelEvent,       ///< Event for mouse wheel scrolling. (Hot path)
+    MouseHoverEvent,       ///< Event for the cursor entering or leaving a widget. (Hot path)
+    FocusEvent             ///< Event for a widget gaining or losing keyboard focus.
 >;
 
-// Static assertion to ensure the Event variant's size stays within a reasonable
-// limit for performance-critical paths.
-static_assert(sizeof(Event) <= 128, "Event variant too large for hot path");
+// Every event is a small, trivially copyable record: copying an `Event` is a
+// memcpy and destroying one is a no-op, so events can sit in lock-free rings
+// and be moved between threads in batches. Heavy payloads (file lists) live
+// out of line in the `PayloadArena` and are referenced by handle.
+namespace detail {
+template <typename Variant>
+struct AllCompactRecords;
+
+template <typename... Ts>
+struct AllCompactRecords<std::variant<Ts...>> {
+    static constexpr bool value = ((std::is_trivially_copyable_v<Ts> && sizeof(Ts) <= 40) && ...);
+};
+} // namespace detail
+
+static_assert(detail::AllCompactRecords<Event>::value, "Event alternatives must be trivially copyable records of at most 40 bytes");
+static_assert(std::is_trivially_copyable_v<Event>, "Event must be trivially copyable");
+static_assert(sizeof(Event) <= 48, "Event variant too large for hot path");
 
 // ============================================================================
 // EVENT VISITOR HELPERS
@@ -102,6 +121,64 @@ concept EventType = std::is_same_v<T, MouseMoveEvent> ||
                     std::is_same_v<T, ResizeEvent> ||
                     std::is_same_v<T, PaintEvent> ||
                     std::is_same_v<T, FileDropEvent> ||
-                    std::is_same_v<T, MouseWheelEvent>;
+                    std::is_same_v<T, MouseWheelEvent> ||
+                    std::is_same_v<T, MouseHoverEvent> ||
+                    std::is_same_v<T, FocusEvent>;
+
+// ============================================================================
+// EVENT INTEREST MASKS
+// ============================================================================
+
+/**
+ * @brief A bitmask with one bit per `Event` alternative (bit = `Event::index()`).
+ *
+ * Widgets declare the event types they handle with a mask; dispatch skips
+ * widgets, and whole subtrees, whose mask does not contain the event's bit.
+ */
+using EventMask = uint32_t;
+
+static_assert(std::variant_size_v<Event> <= sizeof(EventMask) * 8, "EventMask too narrow for Event");
+
+namespace detail {
+
+template <typename T, typename Variant>
+struct VariantIndex;
+
+template <typename T, typename... Ts>
+struct VariantIndex<T, std::variant<Ts...>> {
+    static constexpr size_t value = [] {
+        size_t index = 0;
+        ((std::is_same_v<T, Ts> ? false : (++index, true)) && ...);
+        return index;
+    }();
+};
+
+} // namespace detail
+
+/**
+ * @brief The `Event::index()` of event type `T`, usable as a `case` label.
+ * @tparam T One of the event types held by `Event`.
+ */
+template <EventType T>
+inline constexpr size_t eventIndex = detail::VariantIndex<T, Event>::value;
+
+/**
+ * @brief The mask containing exactly the given event types.
+ * @example eventMask<MouseButtonEvent, MouseMoveEvent>
+ */
+template <EventType... Ts>
+inline constexpr EventMask eventMask = ((EventMask{1} << eventIndex<Ts>) | ... | EventMask{0});
+
+/** @brief Interested in no events. */
+inline constexpr EventMask EVENT_MASK_NONE = 0;
+/** @brief Interested in every event (the default for widgets that do not declare a mask). */
+inline constexpr EventMask EVENT_MASK_ALL = ~EventMask{0};
+
+/**
+ * @brief Returns the mask bit of the event's current alternative.
+ */
+[[nodiscard]] constexpr EventMask eventMaskOf(const Event& event) noexcept {
+    return EventMask{1} << event.index();
+}
 
-} // namespace frqs::event
\ No newline at end of file
+} // namespace frqs::event
@@ -10,10 +10,15 @@
 
 #pragma once
 
-#include <functional>
-#include <vector>
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <vector>
+#include "deferred_event_queue.hpp"
 #include "event.hpp"
 
 namespace frqs::event {
@@ -46,6 +51,23 @@ using ListenerId = uint64_t;
  * of execution.
  *
  * This implementation is thread-safe for all public methods.
+ *
+ * Listeners are kept in one channel per `Event` alternative, indexed by
+ * `Event::index()`. All channels form an immutable, priority-sorted snapshot:
+ * subscribing or unsubscribing builds a new snapshot under the lock and bumps
+ * a version counter (RCU-style). Publishing threads cache the snapshot
+ * thread-locally and only revalidate it with one atomic load, so the hot path
+ * takes no lock and writes no shared memory. Callbacks never run under the
+ * lock: listeners may subscribe, unsubscribe or publish re-entrantly.
+ *
+ * Each snapshot counts the publishes reading it. `unsubscribe()` waits until
+ * no publish still reads a snapshot that contained the listener, then
+ * destroys the callback: once it returns, the listener is not running and
+ * never runs again, and its captures are released even though other threads
+ * still cache the old snapshot. Called from inside a listener (on any bus),
+ * it does not wait, since the caller may itself be one of those readers; the
+ * removed listener may then still receive the events already being published.
+ * Do not unsubscribe while holding a lock that a listener takes.
  */
 class EventBus {
 private:
@@ -57,23 +79,76 @@ private:
     struct ListenerInfo {
         /// @brief The unique ID of the listener.
         ListenerId id;
-        /// @brief The callable function to be executed.
-        EventListener callback;
+        /// @brief The callable function to be executed; destroyed by a quiescent unsubscribe.
+        mutable EventListener callback;
         /// @brief The priority of the listener. Higher values are executed first.
         int priority;
+        /// @brief The channels (event types) the listener is registered on.
+        EventMask channels;
     };
 
-    /// @brief Mutex to protect concurrent access to the listeners list.
+    static constexpr size_t CHANNEL_COUNT = std::variant_size_v<Event>;
+
+    /// @brief A priority-sorted listener list for one event type.
+    using Channel = std::vector<std::shared_ptr<const ListenerInfo>>;
+
+    /**
+     * @struct Snapshot
+     * @brief An immutable set of channels, indexed by `Event::index()`.
+     * @internal
+     */
+    struct Snapshot {
+        std::array<Channel, CHANNEL_COUNT> channels;
+        /// @brief The publishes currently iterating this snapshot.
+        mutable std::atomic<uint32_t> readers{0};
+    };
+
+    /**
+     * @brief Pins the current snapshot for the duration of one publish.
+     * @internal
+     */
+    class ReadScope {
+    public:
+        explicit ReadScope(const EventBus& bus) : snapshot_(bus.beginRead()) {}
+        ~ReadScope() { EventBus::endRead(snapshot_); }
+        ReadScope(const ReadScope&) = delete;
+        ReadScope& operator=(const ReadScope&) = delete;
+
+        [[nodiscard]] const Channel& channel(size_t index) const noexcept {
+            return snapshot_->channels[index];
+        }
+
+    private:
+        const Snapshot* snapshot_;
+    };
+
+    /// @brief Serializes writers (subscribe/unsubscribe). Never held during callbacks.
     mutable std::mutex mutex_;
-    /// @brief The list of all registered listeners.
-    std::vector<ListenerInfo> listeners_;
+    /// @brief All registered listeners in subscription order; guarded by `mutex_`.
+    std::vector<std::shared_ptr<const ListenerInfo>> listeners_;
+    /// @brief The current snapshot; guarded by `mutex_`, never null.
+    std::shared_ptr<const Snapshot> snapshot_;
+    /// @brief Replaced snapshots that may still be read; guarded by `mutex_`.
+    std::vector<std::weak_ptr<const Snapshot>> retired_;
+    /// @brief Bumped whenever `snapshot_` is replaced; readers revalidate against it.
+    std::atomic<uint64_t> version_{1};
+    /// @brief One bit per channel with at least one listener; lets publish skip empty channels.
+    std::atomic<EventMask> activeChannels_{EVENT_MASK_NONE};
+    /// @brief Identifies this bus in the per-thread snapshot caches.
+    const uint64_t busId_;
     /// @brief A counter to generate unique listener IDs.
     ListenerId nextId_ = 1;
-    /// @brief A flag to indicate if the listeners vector needs to be re-sorted by priority.
-    bool sorted_ = true;
+    /// @brief Events published with `publishDeferred`, waiting for `drainDeferred`.
+    DeferredEventQueue deferred_;
+    /// @brief Run after each successful `publishDeferred`, e.g. to wake a sleeping UI loop.
+    std::function<void()> deferredWakeHandler_;
 
 public:
-    EventBus() = default;
+    /**
+     * @brief Constructs an EventBus.
+     * @param deferredCapacity Maximum number of events waiting in the deferred queue.
+     */
+    explicit EventBus(size_t deferredCapacity = DeferredEventQueue::DEFAULT_CAPACITY);
 
     // The EventBus is a central manager, so it's non-copyable and non-movable.
     EventBus(const EventBus&) = delete;
@@ -94,24 +169,14 @@ public:
      */
     template <typename Callable>
     [[nodiscard]] ListenerId subscribe(Callable&& callback, int priority = 0) {
-        std::lock_guard lock(mutex_);
-        
-        ListenerId id = nextId_++;
-        listeners_.push_back(ListenerInfo{
-            .id = id,
-            .callback = std::forward<Callable>(callback),
-            .priority = priority
-        });
-        
-        sorted_ = false;  // Mark for re-sorting before the next dispatch.
-        return id;
+        return addListener(EventListener(std::forward<Callable>(callback)), priority, EVENT_MASK_ALL);
     }
 
     /**
      * @brief Subscribes a callback to listen for a specific event type.
      *
-     * This is a convenience wrapper around `subscribe`. It creates a listener
-     * that checks the event type before invoking the provided callback.
+     * The listener is stored only in `EventType`'s channel, so it is never
+     * invoked (or type-checked) for other events.
      *
      * @tparam EventType The specific event type (e.g., `MouseMoveEvent`) to listen for.
      * @tparam Callable The type of the callable object.
@@ -121,12 +186,12 @@ public:
      */
     template <typename EventType, typename Callable>
     [[nodiscard]] ListenerId subscribeType(Callable&& callback, int priority = 0) {
-        return subscribe([cb = std::forward<Callable>(callback)](const Event& event) -> bool {
-            if (auto* evt = std::get_if<EventType>(&event)) {
-                return cb(*evt);
-            }
-            return false; // Event was not of the subscribed type, so not "handled".
-        }, priority);
+        return addListener(
+            EventListener([cb = std::forward<Callable>(callback)](const Event& event) -> bool {
+                // Only ever called for this channel's alternative.
+                return cb(*std::get_if<EventType>(&event));
+            }),
+            priority, eventMask<EventType>);
     }
 
     // ========================================================================
@@ -135,29 +200,17 @@ public:
 
     /**
      * @brief Removes a listener using its ID.
+     * @details Outside a listener, waits for publishes still calling it on other threads.
      * @param id The `ListenerId` returned by `subscribe` or `subscribeType`.
      * @return `true` if the listener was found and removed, `false` otherwise.
      */
-    bool unsubscribe(ListenerId id) {
-        std::lock_guard lock(mutex_);
-        
-        auto it = std::find_if(listeners_.begin(), listeners_.end(),
-            [id](const ListenerInfo& info) { return info.id == id; });
-        
-        if (it != listeners_.end()) {
-            listeners_.erase(it);
-            return true;
-        }
-        return false;
-    }
+    bool unsubscribe(ListenerId id);
 
     /**
      * @brief Removes all registered listeners from the event bus.
+     * @details Waits for in-flight publishes like `unsubscribe()`.
      */
-    void unsubscribeAll() {
-        std::lock_guard lock(mutex_);
-        listeners_.clear();
-    }
+    void unsubscribeAll();
 
     // ========================================================================
     // DISPATCH EVENTS
@@ -172,21 +225,15 @@ public:
      * @param event The event to dispatch.
      * @return `true` if the event was handled by any listener, `false` otherwise.
      */
-    bool dispatch(const Event& event) {
-        std::lock_guard lock(mutex_);
-        
-        // Sort listeners by priority if a new one has been added.
-        if (!sorted_) {
-            std::sort(listeners_.begin(), listeners_.end(),
-                [](const ListenerInfo& a, const ListenerInfo& b) {
-                    return a.priority > b.priority; // Higher priority first
-                });
-            sorted_ = true;
+    bool dispatch(const Event& event) const {
+        if ((activeChannels_.load(std::memory_order_acquire) & eventMaskOf(event)) == 0) {
+            return false;  // Nobody listens to this type
         }
 
+        ReadScope scope(*this);
         // Call listeners until one handles the event.
-        for (const auto& listener : listeners_) {
-            if (listener.callback(event)) {
+        for (const auto& listener : scope.channel(event.index())) {
+            if (listener->callback(event)) {
                 return true;  // Event handled, stop propagation.
             }
         }
@@ -202,23 +249,70 @@ public:
      *
      * @param event The event to broadcast.
      */
-    void broadcast(const Event& event) {
-        std::lock_guard lock(mutex_);
-        
-        if (!sorted_) {
-            std::sort(listeners_.begin(), listeners_.end(),
-                [](const ListenerInfo& a, const ListenerInfo& b) {
-                    return a.priority > b.priority;
-                });
-            sorted_ = true;
+    void broadcast(const Event& event) const {
+        if ((activeChannels_.load(std::memory_order_acquire) & eventMaskOf(event)) == 0) {
+            return;
         }
 
+        ReadScope scope(*this);
         // Call all listeners, ignoring their return value.
-        for (const auto& listener : listeners_) {
-            listener.callback(event);
+        for (const auto& listener : scope.channel(event.index())) {
+            listener->callback(event);
         }
     }
 
+    // ========================================================================
+    // DEFERRED PUBLICATION
+    // ========================================================================
+
+    /**
+     * @brief Queues an event for broadcast on the thread that drains the bus.
+     *
+     * Use this from worker threads: listeners then run on the UI thread, where
+     * the application drains the global bus once per frame. No allocation or
+     * lock is taken for unkeyed events.
+     *
+     * @param event The event to queue.
+     * @param coalesceKey Events with the same non-zero key replace each other
+     *                    until drained (e.g. one key per progress indicator).
+     * @return `false` if the queue was full and the event was dropped.
+     */
+    bool publishDeferred(const Event& event, uint64_t coalesceKey = DeferredEventQueue::NO_KEY) {
+        if (!deferred_.publish(event, coalesceKey)) return false;
+        if (deferredWakeHandler_) {
+            deferredWakeHandler_();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Broadcasts the deferred events queued so far, in publish order.
+     * @param maxEvents Upper bound on events delivered by this call.
+     * @return The number of events delivered.
+     */
+    size_t drainDeferred(size_t maxEvents = SIZE_MAX) {
+        return deferred_.drain([this](const Event& event) { broadcast(event); }, maxEvents);
+    }
+
+    /** @brief Gets an approximate count of deferred events waiting for `drainDeferred`. */
+    [[nodiscard]] size_t getDeferredPendingCount() const noexcept {
+        return deferred_.getPendingCount();
+    }
+
+    /**
+     * @brief Sets a callback run after each successful `publishDeferred`.
+     * @details The thread that drains the bus uses it to wake up when it sleeps.
+     *          Set it before producers start.
+     */
+    void setDeferredWakeHandler(std::function<void()> handler) {
+        deferredWakeHandler_ = std::move(handler);
+    }
+
+    /** @brief Gets the published/delivered/dropped/coalesced counters of the deferred queue. */
+    [[nodiscard]] DeferredEventStats getDeferredStats() const noexcept {
+        return deferred_.getStats();
+    }
+
     // ========================================================================
     // QUERY
     // ========================================================================
@@ -234,8 +328,43 @@ public:
         std::lock_guard lock(mutex_);
         return !listeners_.empty();
     }
+
+    /** @brief Checks if any listener would receive events of type `T`. Lock-free. */
+    template <typename T>
+    [[nodiscard]] bool hasListenersFor() const noexcept {
+        return (activeChannels_.load(std::memory_order_acquire) & eventMask<T>) != 0;
+    }
+
+private:
+    ListenerId addListener(EventListener callback, int priority, EventMask channels);
+
+    /**
+     * @brief Publishes a snapshot with every channel in `channels` rebuilt. Caller holds `mutex_`.
+     */
+    void rebuildChannels(EventMask channels);
+
+    /**
+     * @brief Waits until no publish reads a replaced snapshot, then destroys the callbacks.
+     * @details Returns at once on a thread that is publishing. Called without `mutex_`.
+     */
+    static void quiesce(const std::vector<std::shared_ptr<const Snapshot>>& draining,
+                        const std::vector<std::shared_ptr<const ListenerInfo>>& removed);
+
+    /** @brief Gets the replaced snapshots still alive. Caller holds `mutex_`. */
+    [[nodiscard]] std::vector<std::shared_ptr<const Snapshot>> collectRetired();
+
+    /** @brief Pins this thread's cached snapshot, refreshing it if the bus changed. */
+    [[nodiscard]] const Snapshot* beginRead() const;
+    /** @brief Unpins a snapshot returned by `beginRead`. */
+    static void endRead(const Snapshot* snapshot) noexcept;
 };
 
+/**
+ * @brief Retrieves the global, application-wide EventBus instance.
+ * @details The application drains its deferred events once per frame on the UI thread.
+ */
+EventBus& getGlobalEventBus();
+
 // ============================================================================
 // SCOPED EVENT LISTENER (RAII pattern)
 // ============================================================================
@@ -0,0 +1,64 @@
+/**
+ * @file event_dispatcher.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Declares helpers for delivering events to widget trees and building events.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Tree traversal honors event interest masks: a subtree whose aggregated mask
+ * does not contain the event's bit is skipped without visiting any node in it.
+ */
+
+#pragma once
+
+#include "event.hpp"
+
+namespace frqs::widget {
+    class IWidget;
+}
+
+namespace frqs::event {
+
+// ============================================================================
+// TREE DISPATCH
+// ============================================================================
+
+/**
+ * @brief Offers an event depth-first (children before parent) until a widget handles it.
+ * @return `true` if a widget handled the event.
+ */
+bool dispatchToWidgetTree(widget::IWidget* root, const Event& event);
+
+/**
+ * @brief Delivers an event to every visible, interested widget of the tree.
+ * @details Used for window-wide events such as `ResizeEvent` and `PaintEvent`.
+ * @return The number of widgets the event was delivered to.
+ */
+size_t broadcastToWidgetTree(widget::IWidget* root, const Event& event);
+
+// ============================================================================
+// EVENT FACTORIES & CLASSIFICATION
+// ============================================================================
+
+/**
+ * @brief Gets the current time on the event clock: `steady_clock`, in nanoseconds.
+ * @details Every event `timestamp` is on this clock, so timestamps can be
+ *          compared with each other and with present times. Native input
+ *          carries the time the OS queued it, mapped onto this clock.
+ */
+uint64_t eventTimestampNow() noexcept;
+
+MouseMoveEvent createMouseMoveEvent(int32_t x, int32_t y, int32_t prevX, int32_t prevY, uint32_t modifiers);
+MouseButtonEvent createMouseButtonEvent(MouseButtonEvent::Button button, MouseButtonEvent::Action action,
+                                        int32_t x, int32_t y, uint32_t modifiers);
+KeyEvent createKeyEvent(uint32_t keyCode, KeyEvent::Action action, uint32_t modifiers);
+ResizeEvent createResizeEvent(uint32_t newWidth, uint32_t newHeight, uint32_t oldWidth, uint32_t oldHeight);
+PaintEvent createPaintEvent(int32_t x, int32_t y, uint32_t width, uint32_t height);
+
+bool isInputEvent(const Event& event);
+bool isWindowEvent(const Event& event);
+const char* getEventTypeName(const Event& event);
+
+} // namespace frqs::event
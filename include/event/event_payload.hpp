@@ -0,0 +1,109 @@
+/**
+ * @file event_payload.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Defines the side arena that holds heavy event payloads referenced by handle.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Events are compact POD records. The rare payload that cannot be (the path
+ * list of a file drop) is stored here, and the event carries a generation-
+ * checked `PayloadHandle`. A stale handle resolves to an empty payload rather
+ * than dangling memory.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <vector>
+#include "event_types.hpp"
+
+namespace frqs::event {
+
+// ============================================================================
+// PAYLOAD ARENA
+// ============================================================================
+
+/**
+ * @class PayloadArena
+ * @brief A process-wide, thread-safe store of out-of-line event payloads.
+ *
+ * Slots are recycled; each reuse bumps the slot's generation so that old
+ * handles stop resolving. Payloads are owned by whoever stored them and must
+ * be released (see `ScopedPayload`).
+ */
+class PayloadArena {
+private:
+    struct Slot {
+        uint32_t generation = 1;
+        bool live = false;
+        std::vector<std::filesystem::path> files;
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<Slot> slots_;
+    std::vector<uint32_t> freeSlots_;
+    size_t liveCount_ = 0;
+
+public:
+    /** @brief Gets the process-wide arena. */
+    static PayloadArena& instance();
+
+    PayloadArena() = default;
+    PayloadArena(const PayloadArena&) = delete;
+    PayloadArena& operator=(const PayloadArena&) = delete;
+
+    /**
+     * @brief Stores a path list.
+     * @return A handle to reference it from a `FileDropEvent`.
+     */
+    [[nodiscard]] PayloadHandle storeFiles(std::vector<std::filesystem::path> files);
+
+    /**
+     * @brief Resolves a handle to its path list.
+     * @details The span stays valid until the payload is released.
+     * @return The paths, or an empty span if the handle is stale or empty.
+     */
+    [[nodiscard]] std::span<const std::filesystem::path> getFiles(PayloadHandle handle) const;
+
+    /**
+     * @brief Frees a payload. Stale or empty handles are ignored.
+     */
+    void release(PayloadHandle handle);
+
+    /** @brief Gets the number of payloads currently stored. */
+    [[nodiscard]] size_t getLiveCount() const;
+};
+
+// ============================================================================
+// SCOPED PAYLOAD (RAII)
+// ============================================================================
+
+/**
+ * @class ScopedPayload
+ * @brief Releases a payload when it goes out of scope.
+ *
+ * @example
+ * ScopedPayload files(PayloadArena::instance().storeFiles(std::move(paths)));
+ * window->dispatchEvent(Event(FileDropEvent{pos, count, files.get()}));
+ */
+class ScopedPayload {
+private:
+    PayloadHandle handle_;
+
+public:
+    explicit ScopedPayload(PayloadHandle handle) noexcept : handle_(handle) {}
+    ~ScopedPayload() { PayloadArena::instance().release(handle_); }
+
+    ScopedPayload(const ScopedPayload&) = delete;
+    ScopedPayload& operator=(const ScopedPayload&) = delete;
+
+    /** @brief Gets the managed handle. */
+    [[nodiscard]] PayloadHandle get() const noexcept { return handle_; }
+};
+
+} // namespace frqs::event
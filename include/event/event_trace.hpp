@@ -0,0 +1,161 @@
+/**
+ * @file event_trace.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Defines the binary input trace and the recorder that fills it.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * A trace is the sequence of input events a window dispatched, each stamped
+ * with the time since recording started and the id of the window that
+ * received it. Traces are saved in a compact binary form and replayed with
+ * `core::replayTrace` to reproduce jank reports or to drive repeatable
+ * interaction benchmarks.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <vector>
+#include "event.hpp"
+
+namespace frqs::event {
+
+// ============================================================================
+// TRACE RECORD
+// ============================================================================
+
+/**
+ * @struct TraceRecord
+ * @brief One recorded event.
+ *
+ * The stored event is a plain copy with its transient pointers cleared:
+ * coalesced mouse moves keep their summed position and delta but not their
+ * raw samples, and file drops keep their paths in the trace (see
+ * `EventTrace::getFiles()`) instead of the arena.
+ */
+struct TraceRecord {
+    /** @brief Marks a record without an out-of-line payload. */
+    static constexpr uint32_t NO_PAYLOAD = UINT32_MAX;
+
+    uint64_t time = 0;                ///< Nanoseconds since the recording started.
+    uint64_t windowId = 0;            ///< `WindowId::value` of the receiving window.
+    Event event;                      ///< The dispatched event.
+    uint32_t payload = NO_PAYLOAD;    ///< Index of the record's file list in the trace.
+};
+
+// ============================================================================
+// EVENT TRACE
+// ============================================================================
+
+/**
+ * @class EventTrace
+ * @brief An in-memory input trace that can be saved to and loaded from disk.
+ *
+ * The file format is native-endian and tied to the event layout of the build
+ * that wrote it; `load()` rejects traces written with a different layout.
+ */
+class EventTrace {
+private:
+    std::vector<TraceRecord> records_;
+    std::vector<std::vector<std::filesystem::path>> fileLists_;
+
+public:
+    EventTrace() = default;
+
+    /**
+     * @brief Appends an event. Records must be appended in time order.
+     * @details Transient pointers are cleared and file-drop paths are copied
+     *          out of the `PayloadArena` into the trace.
+     */
+    void append(uint64_t time, uint64_t windowId, const Event& event);
+
+    /** @brief Gets the records, oldest first. */
+    [[nodiscard]] std::span<const TraceRecord> getRecords() const noexcept { return records_; }
+
+    /** @brief Gets the dropped paths of a file-drop record (empty for other records). */
+    [[nodiscard]] std::span<const std::filesystem::path> getFiles(const TraceRecord& record) const noexcept;
+
+    /** @brief Gets the number of records. */
+    [[nodiscard]] size_t size() const noexcept { return records_.size(); }
+    /** @brief Checks if the trace holds no records. */
+    [[nodiscard]] bool empty() const noexcept { return records_.empty(); }
+    /** @brief Gets the time of the last record, in nanoseconds. */
+    [[nodiscard]] uint64_t getDuration() const noexcept { return records_.empty() ? 0 : records_.back().time; }
+
+    /** @brief Removes all records. */
+    void clear() noexcept;
+
+    /**
+     * @brief Writes the trace to a file.
+     * @return `false` if the file could not be written.
+     */
+    bool save(const std::filesystem::path& path) const;
+
+    /**
+     * @brief Reads a trace written by `save()`.
+     * @return The trace, or `std::nullopt` if the file is missing, truncated,
+     *         or was written with a different event layout.
+     */
+    [[nodiscard]] static std::optional<EventTrace> load(const std::filesystem::path& path);
+};
+
+// ============================================================================
+// EVENT RECORDER
+// ============================================================================
+
+/**
+ * @class EventRecorder
+ * @brief Appends the events a window dispatches to an `EventTrace`.
+ *
+ * Attach one recorder to any number of windows with `Window::setEventRecorder()`.
+ * Only input events are recorded by default; window-wide events such as
+ * resize and paint are consequences of input and are regenerated on replay.
+ *
+ * @note Recorders are used from the UI thread only.
+ */
+class EventRecorder {
+public:
+    /** @brief The event types recorded by default. */
+    static constexpr EventMask INPUT_EVENTS =
+        eventMask<MouseMoveEvent, MouseButtonEvent, KeyEvent, MouseWheelEvent, FileDropEvent>;
+
+private:
+    EventTrace trace_;
+    std::chrono::steady_clock::time_point start_;
+    EventMask mask_ = INPUT_EVENTS;
+    bool recording_ = false;
+
+public:
+    EventRecorder() = default;
+
+    /** @brief Starts (or restarts) recording into an empty trace; time 0 is now. */
+    void start();
+    /** @brief Stops recording. The trace is kept. */
+    void stop() noexcept { recording_ = false; }
+    /** @brief Checks if events are being recorded. */
+    [[nodiscard]] bool isRecording() const noexcept { return recording_; }
+
+    /** @brief Sets which event types are recorded. */
+    void setEventMask(EventMask mask) noexcept { mask_ = mask; }
+    /** @brief Gets the recorded event types. */
+    [[nodiscard]] EventMask getEventMask() const noexcept { return mask_; }
+
+    /**
+     * @brief Records an event dispatched to a window. Called by `Window::dispatchEvent`.
+     */
+    void record(uint64_t windowId, const Event& event);
+
+    /** @brief Gets the trace recorded so far. */
+    [[nodiscard]] const EventTrace& getTrace() const noexcept { return trace_; }
+
+    /** @brief Moves the trace out, leaving the recorder with an empty one. */
+    [[nodiscard]] EventTrace takeTrace() noexcept;
+};
+
+} // namespace frqs::event
@@ -11,8 +11,8 @@
 #pragma once
 
 #include <cstdint>
-#include <vector>
 #include <filesystem>
+#include <span>
 #include "unit/rect.hpp"
 
 namespace frqs::event {
@@ -173,11 +173,45 @@ enum class CursorType : uint8_t {
 // EVENT STRUCT DEFINITIONS
 // ============================================================================
 
-/** @struct MouseMoveEvent @brief Sent when the mouse cursor moves. */
+/**
+ * @struct MouseMoveEvent
+ * @brief Sent when the mouse cursor moves.
+ *
+ * Moves that arrive faster than the frame rate are coalesced by the window into
+ * one dispatch per frame. The dispatched event carries the latest position, the
+ * summed delta, and (via `getSamples()`) every raw sample it replaces, oldest
+ * first, for tools that need the full stroke.
+ */
 struct MouseMoveEvent {
     widget::Point<int32_t> position;  ///< Current cursor position in client coordinates.
     widget::Point<int32_t> delta;     ///< Change in position since the last move event.
     uint32_t modifiers;               ///< Bitfield of active `ModifierKey`s.
+    uint32_t sampleCount = 0;         ///< Number of entries in `samples` (0 if not coalesced).
+    uint64_t timestamp;               ///< High-precision timestamp of the event.
+    const MouseMoveEvent* samples = nullptr; ///< Coalesced raw samples. Valid only during dispatch.
+
+    /** @brief Returns the raw samples folded into this event (empty if it was not coalesced). */
+    [[nodiscard]] std::span<const MouseMoveEvent> getSamples() const noexcept;
+};
+
+inline std::span<const MouseMoveEvent> MouseMoveEvent::getSamples() const noexcept {
+    return {samples, sampleCount};
+}
+
+/**
+ * @struct MouseHoverEvent
+ * @brief Sent directly to a widget when the cursor enters or leaves it.
+ *
+ * Enter/leave events do not bubble. When the hovered leaf changes, every widget
+ * on the old hover path that is not on the new one receives `Leave` (deepest
+ * first), then every newly entered widget receives `Enter` (outermost first).
+ */
+struct MouseHoverEvent {
+    /** @enum Action @brief Whether the cursor entered or left the widget. */
+    enum class Action : uint8_t { Enter, Leave };
+
+    Action action;                    ///< The transition that occurred.
+    widget::Point<int32_t> position;  ///< Cursor position at the time of the transition.
     uint64_t timestamp;               ///< High-precision timestamp of the event.
 };
 
@@ -195,6 +229,17 @@ struct MouseButtonEvent {
     uint64_t timestamp;               ///< High-precision timestamp of the event.
 };
 
+/**
+ * @struct FocusEvent
+ * @brief Sent directly to a widget when it gains or loses keyboard focus.
+ */
+struct FocusEvent {
+    /** @enum Action @brief Whether focus arrived or left. */
+    enum class Action : uint8_t { Gained, Lost };
+
+    Action action;                    ///< The transition that occurred.
+};
+
 /** @struct MouseWheelEvent @brief Sent when the mouse wheel is scrolled. */
 struct MouseWheelEvent {
     int32_t delta;                    ///< The distance the wheel was rotated. Positive for forward, negative for backward.
@@ -225,25 +270,36 @@ struct PaintEvent {
     widget::Rect<int32_t, uint32_t> dirtyRect; ///< The rectangular area that needs repainting.
 };
 
-/** @struct FileDropEvent @brief Sent when one or more files are dropped onto the window. */
+/**
+ * @struct PayloadHandle
+ * @brief Refers to a heavy event payload stored out of line in the `PayloadArena`.
+ *
+ * Handles are plain values: copying an event never copies its payload. A
+ * handle whose payload was released resolves to an empty payload.
+ */
+struct PayloadHandle {
+    uint32_t index = 0;               ///< Slot in the arena.
+    uint32_t generation = 0;          ///< Slot generation; 0 means "no payload".
+
+    [[nodiscard]] constexpr bool isValid() const noexcept { return generation != 0; }
+};
+
+/**
+ * @struct FileDropEvent
+ * @brief Sent when one or more files are dropped onto the window.
+ *
+ * The path list lives in the `PayloadArena` so the event itself stays a small,
+ * trivially copyable record. The platform layer stores the paths, dispatches
+ * the event and releases the payload afterwards; copy the paths out of
+ * `getFiles()` to keep them beyond the handler.
+ */
 struct FileDropEvent {
-    widget::Point<int32_t> position;            ///< The cursor position where the files were dropped.
-    std::vector<std::filesystem::path> files;   ///< A list of paths to the dropped files.
+    widget::Point<int32_t> position;  ///< The cursor position where the files were dropped.
+    uint32_t fileCount = 0;           ///< Number of dropped files.
+    PayloadHandle payload;            ///< The dropped paths, see `getFiles()`.
 
-    FileDropEvent() = default;
-    
-    /** @brief Constructs a FileDropEvent from a position and a list of paths. */
-    FileDropEvent(widget::Point<int32_t> pos, std::vector<std::filesystem::path> fileList)
-        : position(pos), files(std::move(fileList)) {}
-    
-    /** @brief Helper constructor to convert from a list of `std::wstring` paths. */
-    FileDropEvent(widget::Point<int32_t> pos, const std::vector<std::wstring>& paths)
-        : position(pos) {
-        files.reserve(paths.size());
-        for (const auto& p : paths) {
-            files.emplace_back(p);
-        }
-    }
+    /** @brief Returns the dropped paths (empty once the payload was released). */
+    [[nodiscard]] std::span<const std::filesystem::path> getFiles() const;
 };
 
 } // namespace frqs::event
\ No newline at end of file
@@ -22,19 +22,35 @@
 // Platform abstraction (Windows-safe)
 #include "platform/win32_safe.hpp"
 #include "platform/message_queue.hpp"
+#include "platform/unique_task.hpp"
+#include "platform/update_channel.hpp"
+#include "platform/event_loop_backend.hpp"
+#include "platform/thread_pool.hpp"
 
 // Event system
 #include "event/event.hpp"
+#include "event/deferred_event_queue.hpp"
 #include "event/event_bus.hpp"
+#include "event/event_dispatcher.hpp"
+#include "event/event_payload.hpp"
+#include "event/event_trace.hpp"
 
 // Core infrastructure (order matters!)
 #include "core/window_id.hpp"        // Must come before window.hpp
+#include "core/frame_arena.hpp"
+#include "core/latency_monitor.hpp"
 #include "core/window.hpp"
 #include "core/window_registry.hpp"
+#include "core/ui_task_scheduler.hpp"
 #include "core/application.hpp"
+#include "core/event_replay.hpp"
+#include "core/coroutine.hpp"
+#include "core/timer_wheel.hpp"
+#include "core/frame_pacer.hpp"
 
 // Widget system
 #include "widget/iwidget.hpp"
+#include "widget/invalidation_sink.hpp"
 #include "widget/widget.hpp"
 #include "widget/layout.hpp"
 #include "widget/container.hpp"
@@ -46,6 +62,10 @@
 #include "widget/text_input.hpp"
 #include "widget/label.hpp"
 #include "widget/slider.hpp"
+#include "widget/spatial_index.hpp"
+#include "widget/hover_tracker.hpp"
+#include "widget/animation.hpp"
+#include "widget/focus_manager.hpp"
 #include "widget/internal.hpp"
 #include "widget/list_adapter.hpp"
 #include "widget/checkbox.hpp"
@@ -53,6 +73,7 @@
 
 // Rendering
 #include "render/dirty_rect.hpp"
+#include "render/display_list.hpp"
 
 // ============================================================================
 // NAMESPACE ALIASES (Optional convenience)
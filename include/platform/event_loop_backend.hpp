@@ -0,0 +1,119 @@
+/**
+ * @file event_loop_backend.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Defines the native message source the main loop dispatches from and blocks on.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * The main loop must sleep until *anything* needs it: OS input, a task
+ * posted from a worker, or the next timer. A backend owns the OS half of
+ * that wait. The Win32 backend blocks in `MsgWaitForMultipleObjectsEx` on
+ * the message queue plus a wake event; the headless backend has no windows
+ * and lets tests drive and observe the loop.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include "platform/unique_task.hpp"
+
+namespace frqs::platform {
+
+// ============================================================================
+// EVENT LOOP BACKEND
+// ============================================================================
+
+/**
+ * @class EventLoopBackend
+ * @brief Dispatches native messages and blocks until the next one.
+ *
+ * `dispatchMessages()` and `waitForMessages()` are called on the UI thread
+ * only; `wake()` from any thread.
+ */
+class EventLoopBackend {
+public:
+    virtual ~EventLoopBackend() = default;
+
+    /**
+     * @brief Dispatches every pending native message without blocking.
+     * @return `false` once the platform asked the application to quit.
+     */
+    virtual bool dispatchMessages() = 0;
+
+    /**
+     * @brief Blocks until a native message arrives, `wake()` is called, or `timeout` passes.
+     * @param timeout How long to wait at most; `std::nullopt` waits without limit.
+     * @return `true` if woken before the timeout.
+     */
+    virtual bool waitForMessages(std::optional<std::chrono::nanoseconds> timeout) = 0;
+
+    /**
+     * @brief Ends the current wait, or the next one if none is in progress. Thread-safe.
+     */
+    virtual void wake() = 0;
+
+    /**
+     * @brief Asks for fine-grained OS timers while frames are being paced.
+     * @details Coarse timers make short sleeps overshoot by a whole timer tick.
+     *          Backends without such a setting ignore it.
+     */
+    virtual void setHighResolutionTiming(bool enabled) { (void)enabled; }
+};
+
+/**
+ * @brief Creates the backend of the current platform (Win32 message queue).
+ */
+[[nodiscard]] std::unique_ptr<EventLoopBackend> createNativeEventLoopBackend();
+
+// ============================================================================
+// HEADLESS BACKEND
+// ============================================================================
+
+/**
+ * @class HeadlessEventLoopBackend
+ * @brief A backend without an OS message queue, for tests and offscreen tools.
+ *
+ * "Messages" are tasks posted with `postMessage()`; they wake the loop like
+ * input would and run in `dispatchMessages()`. Every wait is counted, so a
+ * test can tell how often an idle loop woke up.
+ */
+class HeadlessEventLoopBackend final : public EventLoopBackend {
+private:
+    std::mutex mutex_;
+    std::condition_variable condVar_;
+    std::deque<UniqueTask> messages_;
+    bool woken_ = false;
+    bool quitRequested_ = false;
+    std::atomic<uint64_t> waits_{0};
+    std::atomic<uint64_t> wakeups_{0};
+
+public:
+    HeadlessEventLoopBackend() = default;
+
+    /** @brief Queues a message and wakes the loop. Thread-safe. */
+    void postMessage(UniqueTask message);
+
+    /** @brief Makes the next `dispatchMessages()` report a quit request (like WM_QUIT). Thread-safe. */
+    void postQuit();
+
+    bool dispatchMessages() override;
+    bool waitForMessages(std::optional<std::chrono::nanoseconds> timeout) override;
+    void wake() override;
+
+    /** @brief Gets the number of `waitForMessages()` calls. */
+    [[nodiscard]] uint64_t getWaitCount() const noexcept { return waits_.load(std::memory_order_relaxed); }
+
+    /** @brief Gets the number of waits that ended before their timeout. */
+    [[nodiscard]] uint64_t getWakeupCount() const noexcept { return wakeups_.load(std::memory_order_relaxed); }
+};
+
+} // namespace frqs::platform
@@ -20,6 +20,8 @@
 #include <functional>
 #include <optional>
 #include <chrono>
+#include "mpsc_queue.hpp"
+#include "unique_task.hpp"
 
 namespace frqs::platform {
 
@@ -203,12 +205,14 @@ public:
  * @brief A type alias for a function wrapper representing a task to be executed on the UI thread.
  *
  * This is typically used for dispatching work from a worker thread to the main application thread.
+ * Tasks are move-only, so they may capture `std::unique_ptr` payloads; captures of up to
+ * 64 bytes are stored inline and never allocate.
  */
-using UiTask = std::function<void()>;
+using UiTask = UniqueTask;
 
 /**
- * @brief A convenience type alias for a queue of UI tasks.
+ * @brief The queue of UI tasks: lock-free for posting workers, drained in batches by the UI loop.
  */
-using UiTaskQueue = MessageQueue<UiTask>;
+using UiTaskQueue = MpscQueue<UiTask>;
 
 } // namespace frqs::platform
\ No newline at end of file
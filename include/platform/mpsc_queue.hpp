@@ -0,0 +1,434 @@
+/**
+ * @file mpsc_queue.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Defines a lock-free multiple-producer, single-consumer queue and a wakeup signal.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * `MpscQueue` backs the UI task queue. Producers link a node with one atomic
+ * exchange (Dmitry Vyukov's intrusive MPSC algorithm) and never block each
+ * other; the consumer drains a whole batch without taking any lock. A
+ * `WakeSignal` lets the consumer sleep until work arrives while costing
+ * producers a single load when the consumer is awake.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <utility>
+
+namespace frqs::platform {
+
+// ============================================================================
+// WAKE SIGNAL
+// ============================================================================
+
+/**
+ * @class WakeSignal
+ * @brief Lets one consumer thread sleep until a producer reports new work.
+ *
+ * The consumer announces that it is about to sleep, re-checks its queues,
+ * and only then blocks. Producers call `notify()` after publishing; it only
+ * touches the mutex when the consumer is actually asleep.
+ */
+class WakeSignal {
+private:
+    std::atomic<bool> sleeping_{false};
+    std::mutex mutex_;
+    std::condition_variable condVar_;
+    bool signaled_ = false;
+    std::function<void()> wakeHandler_;
+
+public:
+    WakeSignal() = default;
+    WakeSignal(const WakeSignal&) = delete;
+    WakeSignal& operator=(const WakeSignal&) = delete;
+
+    /**
+     * @brief Wakes the consumer if it is waiting. Safe from any thread.
+     * @details Call after publishing the work with a seq_cst store or RMW.
+     */
+    void notify() {
+        // Dekker handshake with waitFor(): the publication before this call and
+        // this load are both seq_cst, so either the consumer's re-check sees the
+        // work or this load sees the consumer asleep.
+        if (!sleeping_.load(std::memory_order_seq_cst)) return;
+        {
+            std::lock_guard lock(mutex_);
+            signaled_ = true;
+        }
+        condVar_.notify_one();
+        if (wakeHandler_) {
+            wakeHandler_();
+        }
+    }
+
+    /**
+     * @brief Sleeps until notified, `timeout` elapses, or `ready()` holds.
+     * @param ready Checked after announcing the sleep, so work published
+     *              concurrently is never missed. It must read the
+     *              publication with a seq_cst load.
+     * @return `true` if woken by a notification or `ready()`, `false` on timeout.
+     */
+    template <typename Rep, typename Period, typename Predicate>
+    bool waitFor(const std::chrono::duration<Rep, Period>& timeout, Predicate&& ready) {
+        {
+            std::lock_guard lock(mutex_);
+            signaled_ = false;                // Drop a notification meant for an earlier wait
+        }
+        sleeping_.store(true, std::memory_order_seq_cst);
+        if (ready()) {
+            sleeping_.store(false, std::memory_order_relaxed);
+            return true;
+        }
+
+        std::unique_lock lock(mutex_);
+        bool woken = condVar_.wait_for(lock, timeout, [this] { return signaled_; });
+        signaled_ = false;
+        sleeping_.store(false, std::memory_order_relaxed);
+        return woken;
+    }
+
+    /**
+     * @brief Like `waitFor`, but sleeps in `block()` instead of the condition variable.
+     * @details For a consumer that also waits for native events: the wake
+     *          handler must end `block()`, and must be remembered if it runs
+     *          before `block()` starts (e.g. an auto-reset event).
+     * @param block Sleeps; returns `true` if woken before its own timeout.
+     * @return `true` if `ready()` held or `block()` was woken, `false` on timeout.
+     */
+    template <typename Predicate, typename Blocker>
+    bool waitUsing(Predicate&& ready, Blocker&& block) {
+        sleeping_.store(true, std::memory_order_seq_cst);
+        if (ready()) {
+            sleeping_.store(false, std::memory_order_relaxed);
+            return true;
+        }
+
+        bool woken = block();
+        sleeping_.store(false, std::memory_order_relaxed);
+        return woken;
+    }
+
+    /**
+     * @brief Sets a callback run by `notify()` when the consumer is asleep.
+     * @details Used to break a native wait (e.g. post a message to the UI thread).
+     *          Set it before producers start.
+     */
+    void setWakeHandler(std::function<void()> handler) { wakeHandler_ = std::move(handler); }
+};
+
+// ============================================================================
+// INTRUSIVE MPSC QUEUE
+// ============================================================================
+
+/**
+ * @struct MpscHook
+ * @brief The link embedded in every node of an `IntrusiveMpscQueue`.
+ */
+struct MpscHook {
+    std::atomic<MpscHook*> next{nullptr};
+};
+
+/**
+ * @class IntrusiveMpscQueue
+ * @brief Vyukov's unbounded intrusive MPSC queue over caller-owned nodes.
+ *
+ * `push()` is wait-free (one exchange). `pop()` is lock-free for the single
+ * consumer; it can return nullptr while a producer is between its exchange
+ * and its link store, in which case the node appears on a later pop.
+ */
+class IntrusiveMpscQueue {
+private:
+    alignas(64) std::atomic<MpscHook*> head_;    ///< Producers' end.
+    alignas(64) MpscHook* tail_;                  ///< Consumer's end.
+    MpscHook stub_;
+
+public:
+    IntrusiveMpscQueue() noexcept : head_(&stub_), tail_(&stub_) {}
+    IntrusiveMpscQueue(const IntrusiveMpscQueue&) = delete;
+    IntrusiveMpscQueue& operator=(const IntrusiveMpscQueue&) = delete;
+
+    /**
+     * @brief Links a node. Safe from any thread.
+     * @details The exchange is sequentially consistent, so a `WakeSignal::notify()`
+     *          issued afterwards cannot miss a consumer that is going to sleep.
+     */
+    void push(MpscHook* node) noexcept {
+        node->next.store(nullptr, std::memory_order_relaxed);
+        MpscHook* prev = head_.exchange(node, std::memory_order_seq_cst);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    /** @brief Unlinks the oldest node. Consumer thread only. */
+    [[nodiscard]] MpscHook* pop() noexcept {
+        MpscHook* tail = tail_;
+        MpscHook* next = tail->next.load(std::memory_order_acquire);
+        if (tail == &stub_) {
+            if (!next) return nullptr;
+            tail_ = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+        if (next) {
+            tail_ = next;
+            return tail;
+        }
+        if (tail != head_.load(std::memory_order_acquire)) {
+            return nullptr;                       // A producer is mid-push
+        }
+        // `tail` is the last node: put the stub behind it so it can be handed out.
+        push(&stub_);
+        next = tail->next.load(std::memory_order_acquire);
+        if (next) {
+            tail_ = next;
+            return tail;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Pops every node linked before the call and passes it to `consume`. Consumer thread only.
+     * @details Nodes pushed while draining wait for the next call. If the head
+     *          is the stub, either the queue is empty or `pop()` put the stub
+     *          back behind a node whose link was not stored yet; the nodes ahead
+     *          of it can only be told apart by popping, so the drain runs until
+     *          `pop()` comes back empty.
+     * @return The number of nodes consumed.
+     */
+    template <typename Consume>
+    size_t drain(Consume&& consume) {
+        MpscHook* last = head_.load(std::memory_order_acquire);
+        if (last == &stub_) {
+            last = nullptr;                       // Never handed out: stops only when empty
+        }
+
+        size_t count = 0;
+        while (MpscHook* node = pop()) {
+            bool done = node == last;             // Compare before `consume` may recycle it
+            consume(node);
+            ++count;
+            if (done) break;
+        }
+        return count;
+    }
+
+    /** @brief Checks for linked nodes (sequentially consistent). Consumer thread only. */
+    [[nodiscard]] bool isEmpty() const noexcept {
+        return tail_ == &stub_ && head_.load(std::memory_order_seq_cst) == &stub_;
+    }
+};
+
+// ============================================================================
+// MPSC QUEUE
+// ============================================================================
+
+/**
+ * @class MpscQueue
+ * @brief A lock-free MPSC queue of values with batch drain and optional bound.
+ * @tparam T The message type; must be move-constructible.
+ *
+ * Any thread may push; one thread (the UI thread) consumes. `processAll()`
+ * runs the messages present when it starts, so a handler that posts more
+ * work cannot keep the consumer in the drain forever. A bounded queue
+ * rejects pushes beyond its capacity instead of growing.
+ *
+ * Nodes are recycled: the consumer returns drained nodes to a free stack,
+ * and a producer whose thread-local cache is empty takes the whole stack
+ * with one exchange. In steady state pushing does not allocate.
+ */
+template <typename T>
+class MpscQueue {
+public:
+    /** @brief Capacity value meaning "unbounded". */
+    static constexpr size_t UNBOUNDED = 0;
+
+private:
+    /**
+     * @struct Node
+     * @brief A queue node; `value` is constructed only while the node is queued.
+     * @internal
+     */
+    struct Node : MpscHook {
+        alignas(T) unsigned char storage[sizeof(T)];
+        T& value() noexcept { return *std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    /**
+     * @struct NodeCache
+     * @brief A producer thread's private free nodes, shared by all queues of `T`.
+     * @internal
+     */
+    struct NodeCache {
+        Node* head = nullptr;
+        ~NodeCache() { deleteChain(head); }
+    };
+
+    static inline thread_local NodeCache cache_;
+
+    IntrusiveMpscQueue list_;
+    alignas(64) std::atomic<Node*> recycled_{nullptr};  ///< Free nodes returned by the consumer.
+    alignas(64) std::atomic<size_t> size_{0};           ///< Pending count; maintained when bounded.
+    std::atomic<uint64_t> rejected_{0};
+    size_t capacity_;
+    WakeSignal wake_;
+
+public:
+    /**
+     * @brief Constructs the queue.
+     * @param capacity Maximum number of pending messages, or `UNBOUNDED`.
+     */
+    explicit MpscQueue(size_t capacity = UNBOUNDED) noexcept : capacity_(capacity) {}
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue(MpscQueue&&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+    MpscQueue& operator=(MpscQueue&&) = delete;
+
+    ~MpscQueue() noexcept {
+        while (MpscHook* hook = list_.pop()) {
+            auto* node = static_cast<Node*>(hook);
+            node->value().~T();
+            delete node;
+        }
+        deleteChain(recycled_.load(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Pushes a message and wakes the consumer if it sleeps. Safe from any thread.
+     * @return `false` if the queue is bounded and full; the message is discarded.
+     */
+    bool push(T&& message) {
+        if (capacity_ != UNBOUNDED) {
+            if (size_.fetch_add(1, std::memory_order_relaxed) >= capacity_) {
+                size_.fetch_sub(1, std::memory_order_relaxed);
+                rejected_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+
+        Node* node = acquireNode();
+        ::new (static_cast<void*>(node->storage)) T(std::move(message));
+        list_.push(node);
+        wake_.notify();
+        return true;
+    }
+
+    /** @brief Pushes a copy of a message. */
+    bool push(const T& message) {
+        T copy = message;
+        return push(std::move(copy));
+    }
+
+    /**
+     * @brief Pops the oldest message. Consumer thread only.
+     * @return The message, or `std::nullopt` if none is ready.
+     */
+    [[nodiscard]] std::optional<T> tryPop() {
+        MpscHook* hook = list_.pop();
+        if (!hook) return std::nullopt;
+
+        auto* node = static_cast<Node*>(hook);
+        std::optional<T> message(std::move(node->value()));
+        node->value().~T();
+        releaseNodes(node, node);
+        return message;
+    }
+
+    /**
+     * @brief Runs `handler` on every message pushed before the call. Consumer thread only.
+     * @param handler Called with each message (as an rvalue), oldest first.
+     * @return The number of messages handled.
+     */
+    template <typename Handler>
+    size_t processAll(Handler&& handler) {
+        // Freed nodes are chained locally and returned with a single CAS at the end,
+        // or when `handler` throws; the messages not reached stay queued.
+        struct FreedChain {
+            MpscQueue* queue;
+            Node* first = nullptr;
+            Node* last = nullptr;
+            ~FreedChain() {
+                if (first) queue->releaseNodes(first, last);
+            }
+        } freed{this};
+
+        return list_.drain([&](MpscHook* hook) {
+            auto* node = static_cast<Node*>(hook);
+            T message = std::move(node->value());
+            node->value().~T();
+            node->next.store(freed.first, std::memory_order_relaxed);
+            freed.first = node;
+            if (!freed.last) freed.last = node;
+            if (capacity_ != UNBOUNDED) {
+                size_.fetch_sub(1, std::memory_order_relaxed);
+            }
+            handler(std::move(message));
+        });
+    }
+
+    /**
+     * @brief Sleeps until a message is pushed or `timeout` elapses. Consumer thread only.
+     * @return `true` if messages are pending.
+     */
+    template <typename Rep, typename Period>
+    bool waitFor(const std::chrono::duration<Rep, Period>& timeout) {
+        return wake_.waitFor(timeout, [this] { return !list_.isEmpty(); });
+    }
+
+    /** @brief Gets the wakeup signal, e.g. to install a native wake handler. */
+    [[nodiscard]] WakeSignal& getWakeSignal() noexcept { return wake_; }
+
+    /** @brief Checks if no message is pending. Consumer thread only. */
+    [[nodiscard]] bool isEmpty() const noexcept { return list_.isEmpty(); }
+
+    /** @brief Gets the approximate number of pending messages (bounded queues only; 0 otherwise). */
+    [[nodiscard]] size_t size() const noexcept { return size_.load(std::memory_order_relaxed); }
+
+    /** @brief Gets the capacity, or `UNBOUNDED`. */
+    [[nodiscard]] size_t getCapacity() const noexcept { return capacity_; }
+
+    /** @brief Gets the number of pushes rejected because the queue was full. */
+    [[nodiscard]] uint64_t getRejectedCount() const noexcept { return rejected_.load(std::memory_order_relaxed); }
+
+private:
+    Node* acquireNode() {
+        Node* node = cache_.head;
+        if (!node) {
+            // Take every node the consumer has freed; no ABA, since nothing is popped singly.
+            node = recycled_.exchange(nullptr, std::memory_order_acquire);
+            if (!node) return new Node;
+        }
+        cache_.head = static_cast<Node*>(node->next.load(std::memory_order_relaxed));
+        return node;
+    }
+
+    /** @brief Returns the chain first..last (linked through `next`) to the free stack. */
+    void releaseNodes(Node* first, Node* last) noexcept {
+        Node* head = recycled_.load(std::memory_order_relaxed);
+        do {
+            last->next.store(head, std::memory_order_relaxed);
+        } while (!recycled_.compare_exchange_weak(head, first, std::memory_order_release,
+                                                  std::memory_order_relaxed));
+    }
+
+    static void deleteChain(Node* node) noexcept {
+        while (node) {
+            Node* next = static_cast<Node*>(node->next.load(std::memory_order_relaxed));
+            delete node;
+            node = next;
+        }
+    }
+};
+
+} // namespace frqs::platform
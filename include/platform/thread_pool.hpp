@@ -0,0 +1,273 @@
+/**
+ * @file thread_pool.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Defines a work-stealing thread pool with parallel loop helpers.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Every worker owns a deque. A worker pushes and pops its own tasks at the
+ * back (most recent first, while its data is still in cache) and, when it
+ * runs dry, steals the oldest task from the front of another worker's deque.
+ * Each deque has its own small lock, so workers only contend when one is
+ * stealing from another, instead of all of them serializing on a single
+ * queue. Idle workers park on a condition variable and are woken by the next
+ * submission; there is no polling.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <vector>
+#include "unique_task.hpp"
+
+namespace frqs::platform {
+
+// ============================================================================
+// THREAD POOL STATISTICS
+// ============================================================================
+
+/**
+ * @struct ThreadPoolStats
+ * @brief Counters of a pool since construction.
+ */
+struct ThreadPoolStats {
+    uint64_t submitted = 0;     ///< Tasks submitted.
+    uint64_t executed = 0;      ///< Tasks run, by workers or by `runPendingTask()`.
+    uint64_t stolen = 0;        ///< Tasks a worker took from another worker's deque.
+    uint64_t parks = 0;         ///< Times a worker went to sleep for lack of work.
+};
+
+// ============================================================================
+// THREAD POOL
+// ============================================================================
+
+/**
+ * @class ThreadPool
+ * @brief A work-stealing pool of worker threads.
+ *
+ * Tasks submitted from a worker go to that worker's own deque; tasks from
+ * any other thread are spread round-robin, or go to the worker named by an
+ * affinity hint. A hint only chooses where a task is queued: an idle worker
+ * may still steal it.
+ *
+ * `parallelFor` and `parallelReduce` split a range into chunks. The calling
+ * thread works on chunks too, so they make progress even when every worker
+ * is busy, and may be nested.
+ */
+class ThreadPool {
+public:
+    /** @brief Affinity hint meaning "any worker". */
+    static constexpr size_t ANY_WORKER = SIZE_MAX;
+
+private:
+    struct Impl;  // Worker deques and parking state
+    std::unique_ptr<Impl> pImpl_;
+
+public:
+    /**
+     * @brief Starts the worker threads.
+     * @param workerCount The number of workers. Defaults to `getOptimalThreadCount()`.
+     */
+    explicit ThreadPool(size_t workerCount = 0);
+
+    /**
+     * @brief Stops the pool: queued tasks still run, then the workers are joined.
+     */
+    ~ThreadPool() noexcept;
+
+    // Non-copyable, non-movable
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    /**
+     * @brief Queues a task.
+     * @param task The task; exceptions it throws are swallowed.
+     * @param affinity Index of the preferred worker (taken modulo the worker
+     *                 count), or `ANY_WORKER`.
+     * @note This method is thread-safe.
+     */
+    void submit(UniqueTask task, size_t affinity = ANY_WORKER);
+
+    /**
+     * @brief Runs one queued task on the calling thread, if there is one.
+     * @return `true` if a task ran.
+     * @details Lets a thread that waits on pool work help instead of blocking.
+     */
+    bool runPendingTask();
+
+    /** @brief Gets the number of worker threads. */
+    [[nodiscard]] size_t getWorkerCount() const noexcept;
+
+    /** @brief Gets the calling worker's index, or `ANY_WORKER` if it is not one of this pool's workers. */
+    [[nodiscard]] size_t getCurrentWorkerIndex() const noexcept;
+
+    /** @brief Gets a snapshot of the counters. */
+    [[nodiscard]] ThreadPoolStats getStats() const noexcept;
+
+    // ========================================================================
+    // PARALLEL LOOPS
+    // ========================================================================
+
+    /**
+     * @brief Runs `body` over `[begin, end)` in parallel and returns when all of it ran.
+     * @param grain Indices per chunk; 0 picks about four chunks per thread.
+     * @param body Either `body(size_t index)` or `body(size_t chunkBegin, size_t chunkEnd)`.
+     * @throws The first exception thrown by `body`, after every chunk finished.
+     */
+    template <typename Body>
+    void parallelFor(size_t begin, size_t end, size_t grain, Body&& body) {
+        if (begin >= end) return;
+        runChunks(begin, end, grain, [&body](size_t, size_t chunkBegin, size_t chunkEnd) {
+            if constexpr (std::is_invocable_v<Body&, size_t, size_t>) {
+                body(chunkBegin, chunkEnd);
+            } else {
+                for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+                    body(i);
+                }
+            }
+        });
+    }
+
+    /** @brief `parallelFor` with automatic chunking. */
+    template <typename Body>
+    void parallelFor(size_t begin, size_t end, Body&& body) {
+        parallelFor(begin, end, 0, std::forward<Body>(body));
+    }
+
+    /**
+     * @brief Reduces `[begin, end)` in parallel.
+     * @param identity The neutral value of `combine`.
+     * @param reduce `reduce(size_t chunkBegin, size_t chunkEnd) -> T` for one chunk.
+     * @param combine `combine(T, T) -> T`; chunk results are combined left to
+     *                right, so the result does not depend on scheduling.
+     * @param grain Indices per chunk; 0 picks about four chunks per thread.
+     */
+    template <typename T, typename Reduce, typename Combine>
+    [[nodiscard]] T parallelReduce(size_t begin, size_t end, T identity,
+                                   Reduce&& reduce, Combine&& combine, size_t grain = 0) {
+        if (begin >= end) return identity;
+
+        std::vector<std::optional<T>> partials(chunkCount(begin, end, grain));
+        runChunks(begin, end, grain, [&](size_t chunk, size_t chunkBegin, size_t chunkEnd) {
+            partials[chunk].emplace(reduce(chunkBegin, chunkEnd));
+        });
+
+        T result = std::move(identity);
+        for (auto& partial : partials) {
+            result = combine(std::move(result), std::move(*partial));
+        }
+        return result;
+    }
+
+private:
+    /**
+     * @struct LoopState
+     * @brief Chunk bookkeeping shared by the caller and the helper tasks of one loop.
+     * @internal
+     *
+     * Helpers keep it alive with a shared_ptr: a helper that starts after the
+     * loop returned finds no chunk left and touches nothing else.
+     */
+    struct LoopState {
+        std::atomic<size_t> nextChunk{0};
+        std::atomic<size_t> doneChunks{0};
+        size_t chunkCount = 0;
+        std::mutex errorMutex;
+        std::exception_ptr error;
+    };
+
+    [[nodiscard]] size_t chunkCount(size_t begin, size_t end, size_t grain) const noexcept {
+        size_t step = resolveGrain(begin, end, grain);
+        return (end - begin + step - 1) / step;
+    }
+
+    [[nodiscard]] size_t resolveGrain(size_t begin, size_t end, size_t grain) const noexcept {
+        if (grain > 0) return grain;
+        size_t threads = getWorkerCount() + 1;
+        return std::max<size_t>(1, (end - begin) / (threads * 4));
+    }
+
+    /**
+     * @brief Claims and runs chunks until none is left, then waits for the helpers' chunks.
+     * @param runChunk `runChunk(chunkIndex, chunkBegin, chunkEnd)`.
+     */
+    template <typename RunChunk>
+    void runChunks(size_t begin, size_t end, size_t grain, RunChunk&& runChunk) {
+        size_t step = resolveGrain(begin, end, grain);
+        auto state = std::make_shared<LoopState>();
+        state->chunkCount = chunkCount(begin, end, grain);
+
+        auto claimLoop = [state, begin, end, step, &runChunk] {
+            for (;;) {
+                size_t chunk = state->nextChunk.fetch_add(1, std::memory_order_relaxed);
+                if (chunk >= state->chunkCount) return;
+                size_t chunkBegin = begin + chunk * step;
+                try {
+                    runChunk(chunk, chunkBegin, std::min(end, chunkBegin + step));
+                } catch (...) {
+                    std::lock_guard lock(state->errorMutex);
+                    if (!state->error) state->error = std::current_exception();
+                }
+                if (state->doneChunks.fetch_add(1, std::memory_order_acq_rel) + 1 == state->chunkCount) {
+                    state->doneChunks.notify_all();
+                }
+            }
+        };
+
+        size_t helpers = std::min(getWorkerCount(), state->chunkCount - 1);
+        for (size_t i = 0; i < helpers; ++i) {
+            // A helper only touches runChunk after claiming a chunk, which can
+            // only happen before this call returns.
+            submit(UniqueTask(claimLoop));
+        }
+        claimLoop();
+
+        // Help with other queued work while the last chunks finish.
+        size_t done = state->doneChunks.load(std::memory_order_acquire);
+        while (done < state->chunkCount) {
+            if (!runPendingTask()) {
+                state->doneChunks.wait(done, std::memory_order_acquire);
+            }
+            done = state->doneChunks.load(std::memory_order_acquire);
+        }
+
+        if (state->error) {
+            std::rethrow_exception(state->error);
+        }
+    }
+};
+
+// ============================================================================
+// GLOBAL THREAD POOL
+// ============================================================================
+
+/**
+ * @brief Gets the number of hardware threads, or 4 if it cannot be detected.
+ */
+[[nodiscard]] unsigned int getOptimalThreadCount() noexcept;
+
+/**
+ * @brief Gets the process-wide pool, started on first use.
+ */
+[[nodiscard]] ThreadPool& getGlobalThreadPool();
+
+/**
+ * @brief Queues a task on the process-wide pool.
+ * @param task The task to run.
+ * @param affinity Preferred worker index, or `ThreadPool::ANY_WORKER`.
+ */
+void postToThreadPool(UniqueTask task, size_t affinity = ThreadPool::ANY_WORKER);
+
+} // namespace frqs::platform
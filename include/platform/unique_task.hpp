@@ -0,0 +1,226 @@
+/**
+ * @file unique_task.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Defines a move-only `void()` callable with a 64-byte inline buffer.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * `std::function` must be copyable and keeps only a couple of pointers inline,
+ * so most posted lambdas cost a heap allocation and cannot capture move-only
+ * state such as `std::unique_ptr`. `UniqueTask` stores callables of up to 64
+ * bytes in place and accepts move-only callables. Larger ones still work but
+ * spill to the heap; the spills are counted so hot call sites can be found.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace frqs::platform {
+
+// ============================================================================
+// SPILL STATISTICS
+// ============================================================================
+
+/**
+ * @struct TaskSpillStats
+ * @brief Process-wide counters of tasks too large for the inline buffer.
+ */
+struct TaskSpillStats {
+    uint64_t spills = 0;            ///< Tasks whose callable was heap-allocated.
+    uint64_t spilledBytes = 0;      ///< Total size of those callables.
+    uint64_t largestSpill = 0;      ///< Size of the largest spilled callable.
+};
+
+namespace detail {
+
+/// @brief Spill counters; only touched on the (rare) heap path.
+struct TaskSpillCounters {
+    std::atomic<uint64_t> spills{0};
+    std::atomic<uint64_t> spilledBytes{0};
+    std::atomic<uint64_t> largestSpill{0};
+};
+
+inline TaskSpillCounters& taskSpillCounters() noexcept {
+    static TaskSpillCounters counters;
+    return counters;
+}
+
+inline void recordTaskSpill(size_t bytes) noexcept {
+    auto& counters = taskSpillCounters();
+    counters.spills.fetch_add(1, std::memory_order_relaxed);
+    counters.spilledBytes.fetch_add(bytes, std::memory_order_relaxed);
+    uint64_t largest = counters.largestSpill.load(std::memory_order_relaxed);
+    while (bytes > largest &&
+           !counters.largestSpill.compare_exchange_weak(largest, bytes, std::memory_order_relaxed)) {
+    }
+}
+
+template <typename F>
+struct IsStdFunction : std::false_type {};
+
+template <typename R, typename... Args>
+struct IsStdFunction<std::function<R(Args...)>> : std::true_type {};
+
+} // namespace detail
+
+/** @brief Reads the spill counters. */
+inline TaskSpillStats getTaskSpillStats() noexcept {
+    auto& counters = detail::taskSpillCounters();
+    return TaskSpillStats{
+        .spills = counters.spills.load(std::memory_order_relaxed),
+        .spilledBytes = counters.spilledBytes.load(std::memory_order_relaxed),
+        .largestSpill = counters.largestSpill.load(std::memory_order_relaxed)
+    };
+}
+
+// ============================================================================
+// UNIQUE TASK
+// ============================================================================
+
+/**
+ * @class UniqueTask
+ * @brief A move-only, type-erased `void()` callable with small-buffer storage.
+ *
+ * Callables up to `INLINE_CAPACITY` bytes whose move constructor cannot throw
+ * are stored in place; constructing, moving and destroying such a task never
+ * allocates. Anything else is stored on the heap and counted in
+ * `getTaskSpillStats()`.
+ */
+class UniqueTask {
+public:
+    /** @brief Bytes available for an inline callable. */
+    static constexpr size_t INLINE_CAPACITY = 64;
+
+    /** @brief Checks whether a callable of type `F` is stored without allocating. */
+    template <typename F>
+    static constexpr bool fitsInline = sizeof(F) <= INLINE_CAPACITY &&
+                                       alignof(F) <= alignof(std::max_align_t) &&
+                                       std::is_nothrow_move_constructible_v<F>;
+
+private:
+    /**
+     * @struct Ops
+     * @brief Per-callable-type operations (one static table per type).
+     * @internal
+     */
+    struct Ops {
+        void (*invoke)(void* storage);
+        void (*relocate)(void* dst, void* src) noexcept;   ///< Move-construct into dst, destroy src; nullptr = memcpy.
+        void (*destroy)(void* storage) noexcept;           ///< nullptr = nothing to destroy.
+        bool spilled;
+    };
+
+    template <typename F>
+    struct InlineOps {
+        static F* get(void* storage) noexcept { return std::launder(static_cast<F*>(storage)); }
+        static void invoke(void* storage) { (*get(storage))(); }
+        static void relocate(void* dst, void* src) noexcept {
+            ::new (dst) F(std::move(*get(src)));
+            get(src)->~F();
+        }
+        static void destroy(void* storage) noexcept { get(storage)->~F(); }
+        static constexpr bool TRIVIAL = std::is_trivially_copyable_v<F>;
+        static constexpr Ops table{&invoke, TRIVIAL ? nullptr : &relocate,
+                                   std::is_trivially_destructible_v<F> ? nullptr : &destroy, false};
+    };
+
+    template <typename F>
+    struct HeapOps {
+        static F*& get(void* storage) noexcept { return *std::launder(static_cast<F**>(storage)); }
+        static void invoke(void* storage) { (*get(storage))(); }
+        static void destroy(void* storage) noexcept { delete get(storage); }
+        static constexpr Ops table{&invoke, nullptr, &destroy, true};
+    };
+
+    alignas(std::max_align_t) unsigned char storage_[INLINE_CAPACITY];
+    const Ops* ops_ = nullptr;
+
+public:
+    UniqueTask() noexcept = default;
+    UniqueTask(std::nullptr_t) noexcept {}
+
+    /**
+     * @brief Wraps a callable.
+     * @tparam F Any `void()`-invocable type, copyable or not.
+     */
+    template <typename F>
+        requires (!std::is_same_v<std::remove_cvref_t<F>, UniqueTask> &&
+                  std::is_invocable_v<std::remove_cvref_t<F>&>)
+    UniqueTask(F&& callable) {
+        using Fn = std::remove_cvref_t<F>;
+        if constexpr (std::is_pointer_v<Fn> || detail::IsStdFunction<Fn>::value) {
+            if (!callable) return;            // Null function pointer or empty std::function
+        }
+        if constexpr (fitsInline<Fn>) {
+            ::new (static_cast<void*>(storage_)) Fn(std::forward<F>(callable));
+            ops_ = &InlineOps<Fn>::table;
+        } else {
+            ::new (static_cast<void*>(storage_)) Fn*(new Fn(std::forward<F>(callable)));
+            ops_ = &HeapOps<Fn>::table;
+            detail::recordTaskSpill(sizeof(Fn));
+        }
+    }
+
+    UniqueTask(UniqueTask&& other) noexcept {
+        takeFrom(other);
+    }
+
+    UniqueTask& operator=(UniqueTask&& other) noexcept {
+        if (this != &other) {
+            reset();
+            takeFrom(other);
+        }
+        return *this;
+    }
+
+    UniqueTask& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    UniqueTask(const UniqueTask&) = delete;
+    UniqueTask& operator=(const UniqueTask&) = delete;
+
+    ~UniqueTask() { reset(); }
+
+    /** @brief Runs the callable. The task must not be empty. */
+    void operator()() { ops_->invoke(storage_); }
+
+    /** @brief Checks if the task holds a callable. */
+    explicit operator bool() const noexcept { return ops_ != nullptr; }
+
+    /** @brief Checks if the callable lives on the heap. */
+    [[nodiscard]] bool isSpilled() const noexcept { return ops_ && ops_->spilled; }
+
+    /** @brief Destroys the callable, leaving the task empty. */
+    void reset() noexcept {
+        if (ops_) {
+            if (ops_->destroy) ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+    }
+
+private:
+    void takeFrom(UniqueTask& other) noexcept {
+        ops_ = other.ops_;
+        if (!ops_) return;
+        if (ops_->relocate) {
+            ops_->relocate(storage_, other.storage_);
+        } else {
+            std::memcpy(storage_, other.storage_, INLINE_CAPACITY);
+        }
+        other.ops_ = nullptr;
+    }
+};
+
+} // namespace frqs::platform
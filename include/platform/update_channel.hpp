@@ -0,0 +1,213 @@
+/**
+ * @file update_channel.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Defines keyed "latest value wins" channels from worker threads to the UI thread.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Posting one `UiTask` per progress tick, price, or sensor reading makes the
+ * task queue grow without bound whenever the UI falls behind, and the UI then
+ * replays stale values one by one. An `UpdateChannel` keeps one slot per key
+ * instead: a newer value overwrites the pending one, and the UI thread
+ * consumes the newest value of every key once per frame. Memory is bounded
+ * by the number of distinct keys, not by the update rate.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace frqs::platform {
+
+// ============================================================================
+// UPDATE CHANNEL STATISTICS
+// ============================================================================
+
+/**
+ * @struct UpdateChannelStats
+ * @brief Counters of a channel since construction (or the last `resetStats()`).
+ */
+struct UpdateChannelStats {
+    uint64_t published = 0;     ///< Values handed to `publish()`.
+    uint64_t delivered = 0;     ///< Values passed to a consumer.
+    uint64_t superseded = 0;    ///< Values overwritten before the UI consumed them.
+    uint64_t frames = 0;        ///< Consumes that delivered at least one value.
+    size_t maxPending = 0;      ///< Largest number of keys pending at once.
+};
+
+// ============================================================================
+// UPDATE CHANNEL BASE (Type-erased, for the UI loop)
+// ============================================================================
+
+/**
+ * @class UpdateChannelBase
+ * @brief The part of a channel the UI loop needs, independent of key and value types.
+ */
+class UpdateChannelBase {
+public:
+    /** @brief Called on the first publish after a consume, e.g. to wake the UI loop. */
+    using PendingCallback = std::function<void()>;
+
+protected:
+    mutable std::mutex mutex_;
+    UpdateChannelStats stats_;
+    PendingCallback onPending_;
+
+public:
+    UpdateChannelBase() = default;
+    virtual ~UpdateChannelBase() = default;
+
+    UpdateChannelBase(const UpdateChannelBase&) = delete;
+    UpdateChannelBase& operator=(const UpdateChannelBase&) = delete;
+
+    /**
+     * @brief Delivers the newest pending value of every key to the channel's handler.
+     * @return The number of values delivered.
+     * @note UI thread only; the application loop calls this once per frame.
+     */
+    virtual size_t deliverPending() = 0;
+
+    /** @brief Gets the number of keys with an undelivered value. Thread-safe. */
+    [[nodiscard]] virtual size_t getPendingCount() const = 0;
+
+    /** @brief Gets a snapshot of the counters. Thread-safe. */
+    [[nodiscard]] UpdateChannelStats getStats() const {
+        std::lock_guard lock(mutex_);
+        return stats_;
+    }
+
+    /** @brief Zeroes the counters. Thread-safe. */
+    void resetStats() {
+        std::lock_guard lock(mutex_);
+        stats_ = UpdateChannelStats{};
+    }
+
+    /**
+     * @brief Sets the callback run when the channel goes from idle to pending.
+     * @details It runs on the publishing thread, outside the channel's lock, at
+     *          most once per consume. Thread-safe; a publish already past the
+     *          lock may still run the previous callback.
+     */
+    void setPendingCallback(PendingCallback callback) {
+        std::lock_guard lock(mutex_);
+        onPending_ = std::move(callback);
+    }
+};
+
+// ============================================================================
+// UPDATE CHANNEL
+// ============================================================================
+
+/**
+ * @class UpdateChannel
+ * @brief Keyed slots where producers publish the latest value and the UI takes the newest.
+ * @tparam Key   Identifies a slot (e.g. a job id or a ticker symbol).
+ * @tparam Value The update payload; must be move-constructible and move-assignable.
+ *
+ * `publish()` is safe from any thread and holds the lock only to store the
+ * value. `consume()` swaps the pending slots out under the lock and runs the
+ * handler without it, so producers are never blocked by UI work. Values are
+ * delivered in the order their keys first became pending.
+ *
+ * Example:
+ * @code
+ * auto progress = std::make_shared<UpdateChannel<int, float>>(
+ *     [](const int& job, float&& fraction) { bars[job]->setValue(fraction); });
+ * FRQS_APP.attachUpdateChannel(progress);
+ * // Worker thread:
+ * progress->publish(jobId, done / total);
+ * @endcode
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class UpdateChannel : public UpdateChannelBase {
+public:
+    /** @brief Receives the newest value of one key on the UI thread. */
+    using Handler = std::function<void(const Key&, Value&&)>;
+
+private:
+    std::unordered_map<Key, size_t, Hash> slotOf_;    ///< Key -> index into pending_.
+    std::vector<std::pair<Key, Value>> pending_;
+    std::vector<std::pair<Key, Value>> draining_;     ///< Swapped with pending_ on consume; keeps capacity.
+    Handler handler_;
+
+public:
+    /**
+     * @brief Constructs a channel.
+     * @param handler Run by `deliverPending()` for each key; may be empty if
+     *                the owner calls `consume()` itself.
+     */
+    explicit UpdateChannel(Handler handler = {}) : handler_(std::move(handler)) {}
+
+    /**
+     * @brief Publishes the latest value for a key, replacing any undelivered one.
+     * @note This method is thread-safe.
+     */
+    void publish(const Key& key, Value value) {
+        PendingCallback onPending;
+        {
+            std::lock_guard lock(mutex_);
+            ++stats_.published;
+            if (pending_.empty()) {
+                onPending = onPending_;     // Copied: it may be replaced once the lock drops
+            }
+
+            auto [it, inserted] = slotOf_.try_emplace(key, pending_.size());
+            if (inserted) {
+                pending_.emplace_back(key, std::move(value));
+                if (pending_.size() > stats_.maxPending) {
+                    stats_.maxPending = pending_.size();
+                }
+            } else {
+                pending_[it->second].second = std::move(value);
+                ++stats_.superseded;
+            }
+        }
+        if (onPending) {
+            onPending();
+        }
+    }
+
+    /**
+     * @brief Passes the newest value of every pending key to `handler`.
+     * @tparam F Callable as `handler(const Key&, Value&&)`.
+     * @return The number of values delivered.
+     * @note Single consumer (the UI thread). Values published while the
+     *       handler runs are kept for the next consume.
+     */
+    template <typename F>
+    size_t consume(F&& handler) {
+        {
+            std::lock_guard lock(mutex_);
+            if (pending_.empty()) return 0;
+            pending_.swap(draining_);
+            slotOf_.clear();
+            stats_.delivered += draining_.size();
+            ++stats_.frames;
+        }
+
+        size_t count = draining_.size();
+        for (auto& [key, value] : draining_) {
+            handler(std::as_const(key), std::move(value));
+        }
+        draining_.clear();
+        return count;
+    }
+
+    size_t deliverPending() override {
+        return handler_ ? consume(handler_) : 0;
+    }
+
+    [[nodiscard]] size_t getPendingCount() const override {
+        std::lock_guard lock(mutex_);
+        return pending_.size();
+    }
+};
+
+} // namespace frqs::platform
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <span>
 #include <vector>
 #include "unit/rect.hpp"
 
@@ -49,7 +50,9 @@ public:
      * @param bounds The initial bounds of the area to manage (e.g., window size).
      */
     explicit DirtyRectManager(const widget::Rect<int32_t, uint32_t>& bounds)
-        : bounds_(bounds) {}
+        : bounds_(bounds) {
+        dirtyRects_.reserve(16);
+    }
 
     /**
      * @brief Marks a specific region as dirty and needing a redraw.
@@ -97,12 +100,13 @@ public:
 
     /**
      * @brief Retrieves the list of rectangles that need to be redrawn.
-     * @return A vector of dirty rectangles. If a full redraw is needed, this
-     *         vector contains a single rectangle covering the entire bounds.
+     * @return A view of the dirty rectangles, valid until the next mutation.
+     *         If a full redraw is needed, it contains a single rectangle
+     *         covering the entire bounds. No copy is made.
      */
-    [[nodiscard]] std::vector<widget::Rect<int32_t, uint32_t>> getDirtyRects() const {
+    [[nodiscard]] std::span<const widget::Rect<int32_t, uint32_t>> getDirtyRects() const noexcept {
         if (fullRedraw_) {
-            return {bounds_};
+            return {&bounds_, 1};
         }
         return dirtyRects_;
     }
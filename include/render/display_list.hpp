@@ -0,0 +1,299 @@
+/**
+ * @file display_list.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Retained display lists and per-widget diffing for automatic damage tracking.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * When auto-damage is enabled on a window, each frame is first recorded into a
+ * `DisplayList` instead of being drawn directly. Commands are attributed to the
+ * widget that issued them (via `Renderer::beginWidget`/`endWidget`) and folded
+ * into a per-widget hash. Diffing two consecutive lists yields the exact regions
+ * whose pixels changed, which are then replayed into the real renderer under a
+ * clip. Widgets no longer need tight `invalidateRect` calls for partial repaint.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "render/renderer.hpp"
+#include "render/dirty_rect.hpp"
+
+namespace frqs::render {
+
+// ============================================================================
+// DISPLAY COMMANDS
+// ============================================================================
+
+/**
+ * @enum DisplayOp
+ * @brief Identifies the renderer call captured by a `DisplayCommand`.
+ */
+enum class DisplayOp : uint8_t {
+    Clear,
+    DrawRect,
+    FillRect,
+    DrawText,
+    PushClip,
+    PopClip,
+    DrawLine,
+    DrawEllipse,
+    FillEllipse,
+    DrawRoundedRect,
+    FillRoundedRect,
+    DrawTextEx,
+    DrawBitmap,
+    Save,
+    Restore,
+    SetOpacity,
+    SetTransform,
+    Translate
+};
+
+/**
+ * @struct DisplayCommand
+ * @brief A single recorded renderer call.
+ *
+ * Commands are flat and trivially copyable; strings live in the owning list's
+ * text pool and are referenced by offset/length.
+ */
+struct DisplayCommand {
+    DisplayOp op = DisplayOp::Clear;
+    TextAlign halign = TextAlign::Left;
+    VerticalAlign valign = VerticalAlign::Top;
+    uint8_t fontFlags = 0;                          ///< bold | italic << 1 | underline << 2 | strikethrough << 3
+    uint32_t item = 0;                              ///< Index of the owning `DisplayItem`.
+    widget::Rect<int32_t, uint32_t> rect;           ///< Rect argument, in the caller's (local) space.
+    widget::Rect<int32_t, uint32_t> bounds;         ///< Affected pixels, in window space after transform and clip.
+    widget::Point<int32_t> start;                   ///< Line start.
+    widget::Point<int32_t> end;                     ///< Line end.
+    widget::Color color;
+    float params[6] = {};                           ///< Stroke width, radii, opacity or matrix.
+    void* bitmap = nullptr;
+    uint32_t textOffset = 0;
+    uint32_t textLength = 0;
+    uint32_t fontOffset = 0;
+    uint32_t fontLength = 0;
+    float fontSize = 0.0f;
+};
+
+/**
+ * @struct DisplayItem
+ * @brief The commands issued by one widget during a frame, reduced to a hash and bounds.
+ */
+struct DisplayItem {
+    const void* client = nullptr;                   ///< The widget (or nullptr for the window itself).
+    uint64_t hash = 0;                              ///< Order-sensitive hash of the item's commands.
+    widget::Rect<int32_t, uint32_t> bounds;         ///< Union of the item's command bounds.
+};
+
+// ============================================================================
+// DISPLAY LIST
+// ============================================================================
+
+/**
+ * @class DisplayList
+ * @brief A recorded frame: commands, per-widget items and a shared text pool.
+ *
+ * `clear()` keeps all capacity, so recording a steady-state frame does not
+ * touch the heap once the buffers have grown to the frame's size.
+ */
+class DisplayList {
+private:
+    std::vector<DisplayCommand> commands_;
+    std::vector<DisplayItem> items_;
+    std::vector<uint32_t> order_;                   ///< Item indices sorted by client, built by `finalize()`.
+    std::wstring textPool_;
+
+    // Replay scratch (reused to avoid per-command allocations)
+    mutable std::wstring scratchText_;
+    mutable FontStyle scratchFont_;
+
+    friend class DisplayListRecorder;
+
+public:
+    DisplayList() = default;
+
+    /** @brief Removes all commands and items, keeping allocated capacity. */
+    void clear() noexcept;
+
+    /** @brief Sorts the item index used by `diff()`. Called when recording ends. */
+    void finalize();
+
+    [[nodiscard]] const std::vector<DisplayCommand>& getCommands() const noexcept { return commands_; }
+    [[nodiscard]] const std::vector<DisplayItem>& getItems() const noexcept { return items_; }
+    [[nodiscard]] bool isEmpty() const noexcept { return commands_.empty(); }
+
+    /** @brief Returns the text referenced by a command. */
+    [[nodiscard]] std::wstring_view getText(const DisplayCommand& cmd) const noexcept {
+        return std::wstring_view(textPool_).substr(cmd.textOffset, cmd.textLength);
+    }
+
+    /**
+     * @brief Replays the list into a renderer.
+     * @param target The renderer that receives the commands.
+     * @param clip When non-null, drawing commands whose bounds miss this rect are skipped.
+     *             State commands (clip, transform, save/restore) are always replayed.
+     */
+    void replay(IExtendedRenderer& target, const widget::Rect<int32_t, uint32_t>* clip = nullptr) const;
+
+    /**
+     * @brief Computes the damage between two frames, per widget.
+     *
+     * Items are matched by client. A matched item whose hash changed damages both
+     * its old and new bounds; unmatched items damage their own bounds.
+     *
+     * @param previous The last presented frame.
+     * @param current The newly recorded frame.
+     * @param damage Receives the damaged regions.
+     * @return The number of items that contributed damage.
+     */
+    static size_t diff(const DisplayList& previous, const DisplayList& current,
+                       DirtyRectManager& damage);
+};
+
+// ============================================================================
+// RECORDING RENDERER
+// ============================================================================
+
+/**
+ * @class DisplayListRecorder
+ * @brief An `IExtendedRenderer` that records calls into a `DisplayList` instead of drawing.
+ *
+ * Text measurement is forwarded to a backend renderer so widgets that measure
+ * during `render()` behave exactly as they do when drawing directly.
+ */
+class DisplayListRecorder final : public IExtendedRenderer {
+private:
+    struct TransformState {
+        float tx = 0.0f;
+        float ty = 0.0f;
+        float opacity = 1.0f;
+        bool complex = false;                       ///< Scale/rotation: bounds fall back to the whole surface.
+    };
+
+    IExtendedRenderer* backend_ = nullptr;
+    DisplayList* list_ = nullptr;
+    widget::Rect<int32_t, uint32_t> surface_;
+    TransformState state_;
+    std::vector<TransformState> stateStack_;
+    std::vector<widget::Rect<int32_t, uint32_t>> clipStack_;
+    std::vector<uint32_t> itemStack_;
+
+public:
+    /**
+     * @param backend Renderer used for text measurement and resource loading (may be null).
+     */
+    explicit DisplayListRecorder(IExtendedRenderer* backend = nullptr) noexcept
+        : backend_(backend) {}
+
+    /** @brief Starts recording into `list`, which is cleared first. */
+    void begin(DisplayList& list, const widget::Rect<int32_t, uint32_t>& surface);
+    /** @brief Finishes recording and finalizes the list. */
+    void end();
+
+    [[nodiscard]] IExtendedRenderer* getBackend() const noexcept { return backend_; }
+    void setBackend(IExtendedRenderer* backend) noexcept { backend_ = backend; }
+
+    // widget::Renderer
+    void clear(const widget::Color& color) override;
+    void drawRect(const widget::Rect<int32_t, uint32_t>& rect,
+                  const widget::Color& color, float strokeWidth = 1.0f) override;
+    void fillRect(const widget::Rect<int32_t, uint32_t>& rect,
+                  const widget::Color& color) override;
+    void drawText(const std::wstring& text,
+                  const widget::Rect<int32_t, uint32_t>& rect,
+                  const widget::Color& color) override;
+    void pushClip(const widget::Rect<int32_t, uint32_t>& rect) override;
+    void popClip() override;
+    void beginWidget(const widget::IWidget* widget) override;
+    void endWidget() override;
+
+    // IExtendedRenderer
+    void drawLine(const widget::Point<int32_t>& start, const widget::Point<int32_t>& end,
+                  const widget::Color& color, float strokeWidth = 1.0f) override;
+    void drawEllipse(const widget::Rect<int32_t, uint32_t>& rect,
+                     const widget::Color& color, float strokeWidth = 1.0f) override;
+    void fillEllipse(const widget::Rect<int32_t, uint32_t>& rect,
+                     const widget::Color& color) override;
+    void drawRoundedRect(const widget::Rect<int32_t, uint32_t>& rect,
+                         float radiusX, float radiusY,
+                         const widget::Color& color, float strokeWidth = 1.0f) override;
+    void fillRoundedRect(const widget::Rect<int32_t, uint32_t>& rect,
+                         float radiusX, float radiusY,
+                         const widget::Color& color) override;
+    void drawTextEx(const std::wstring& text,
+                    const widget::Rect<int32_t, uint32_t>& rect,
+                    const widget::Color& color,
+                    const FontStyle& font,
+                    TextAlign halign = TextAlign::Left,
+                    VerticalAlign valign = VerticalAlign::Top) override;
+    void drawBitmap(void* bitmap, const widget::Rect<int32_t, uint32_t>& destRect,
+                    float opacity = 1.0f) override;
+    void save() override;
+    void restore() override;
+    void setOpacity(float opacity) override;
+    void setTransform(float m11, float m12, float m21, float m22,
+                      float dx, float dy) override;
+    void translate(float dx, float dy) override;
+
+    float measureTextWidth(const std::wstring& text, size_t length,
+                           const FontStyle& font) const override;
+    size_t getCharPositionFromX(const std::wstring& text, float x,
+                                const FontStyle& font) const override;
+
+private:
+    DisplayCommand& emit(DisplayOp op);
+    void commit(DisplayCommand& cmd, const widget::Rect<int32_t, uint32_t>& localBounds);
+    [[nodiscard]] widget::Rect<int32_t, uint32_t> toDevice(const widget::Rect<int32_t, uint32_t>& rect) const noexcept;
+    void storeText(DisplayCommand& cmd, const std::wstring& text);
+};
+
+// ============================================================================
+// DAMAGE TRACKER
+// ============================================================================
+
+/**
+ * @class DamageTracker
+ * @brief Owns the double-buffered display lists for one window.
+ *
+ * Per frame: `record()` the widget tree, `computeDamage()` against the last
+ * presented frame, `present()` the damaged regions, then `commit()`.
+ */
+class DamageTracker {
+private:
+    DisplayList lists_[2];
+    uint32_t current_ = 0;
+    bool hasPrevious_ = false;
+    DisplayListRecorder recorder_;
+
+public:
+    explicit DamageTracker(IExtendedRenderer* backend = nullptr) noexcept
+        : recorder_(backend) {}
+
+    /** @brief Records a full frame: a clear with `background` followed by `root`. */
+    void record(widget::IWidget& root, const widget::Rect<int32_t, uint32_t>& surface,
+                const widget::Color& background);
+
+    /** @brief Adds the difference to the previous frame to `damage` (full redraw on first frame). */
+    void computeDamage(DirtyRectManager& damage);
+
+    /** @brief Replays the current frame into `target`, restricted to the damaged regions. */
+    void present(IExtendedRenderer& target, const DirtyRectManager& damage) const;
+
+    /** @brief Makes the current frame the baseline for the next diff. */
+    void commit() noexcept;
+
+    /** @brief Drops the baseline so the next frame is treated as fully damaged. */
+    void reset() noexcept { hasPrevious_ = false; }
+
+    [[nodiscard]] const DisplayList& getCurrent() const noexcept { return lists_[current_]; }
+    [[nodiscard]] DisplayListRecorder& getRecorder() noexcept { return recorder_; }
+};
+
+} // namespace frqs::render
@@ -12,7 +12,7 @@
 #pragma once
 
 #include "unit/rect.hpp"
-#include <stack>
+#include <vector>
 #include <algorithm>
 #include <cmath>
 
@@ -58,7 +58,9 @@ struct RenderState {
  */
 class RenderContext {
 private:
-    std::stack<RenderState> stateStack_; ///< Stack for saving and restoring render states.
+    /// Stack for saving and restoring render states. Vector-backed so that
+    /// push/pop reuse capacity instead of allocating deque blocks.
+    std::vector<RenderState> stateStack_;
     RenderState currentState_; ///< The currently active render state.
 
 public:
@@ -68,6 +70,7 @@ public:
      */
     RenderContext(const widget::Rect<int32_t, uint32_t>& initialClip) {
         currentState_.clipRect = initialClip;
+        stateStack_.reserve(16);
     }
 
     // ========================================================================
@@ -81,7 +84,7 @@ public:
      * that should be reverted later.
      */
     void save() {
-        stateStack_.push(currentState_);
+        stateStack_.push_back(currentState_);
     }
 
     /**
@@ -92,8 +95,8 @@ public:
      */
     void restore() {
         if (!stateStack_.empty()) {
-            currentState_ = stateStack_.top();
-            stateStack_.pop();
+            currentState_ = stateStack_.back();
+            stateStack_.pop_back();
         }
     }
 
@@ -233,9 +236,7 @@ public:
      * @param initialClip The new initial clipping rectangle.
      */
     void reset(const widget::Rect<int32_t, uint32_t>& initialClip) {
-        while (!stateStack_.empty()) {
-            stateStack_.pop();
-        }
+        stateStack_.clear();
         currentState_ = RenderState{};
         currentState_.clipRect = initialClip;
     }
@@ -137,6 +137,13 @@ enum class BrushType : uint8_t {
  */
 class IExtendedRenderer : public widget::Renderer {
 public:
+    /**
+     * @brief Advertises the extended interface through `Renderer::getCaps()`.
+     */
+    IExtendedRenderer() noexcept {
+        caps_.extended = this;
+    }
+
     // Advanced drawing
     /**
      * @brief Draws a line between two points.
@@ -272,7 +279,7 @@ inline widget::Size<uint32_t> measureText(
     const FontStyle& font = FontStyle{}
 ) {
     // Try extended renderer first
-    if (auto* extRenderer = dynamic_cast<IExtendedRenderer*>(&renderer)) {
+    if (auto* extRenderer = renderer.getCaps().extended) {
         float width = extRenderer->measureTextWidth(text, text.length(), font);
         return widget::Size(static_cast<uint32_t>(width), 
                            static_cast<uint32_t>(font.size * 1.5f));
@@ -0,0 +1,239 @@
+/**
+ * @file animation.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Defines property tweens driven by the application's frame clock.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * A tween moves one property of one widget (a color, a `Rect`, an opacity,
+ * a scroll offset, a slider value) from a start value to a target over a
+ * duration, shaped by an easing curve. All tweens share a single frame
+ * ticker: each frame's animate phase writes every running value through the
+ * widget's own setter. The setter invalidates that widget's rect, so only
+ * animated widgets repaint, at the frame rate and in phase with the pacer.
+ *
+ * Values are kept as up to four `double` components. A finished tween is
+ * compacted out of a flat vector, which never allocates. Starting a tween
+ * on a (widget, property) pair that is already animating retargets it from
+ * where the caller says it currently is.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+#include "widget/iwidget.hpp"
+
+namespace frqs::widget {
+
+// ============================================================================
+// EASING
+// ============================================================================
+
+/**
+ * @enum Easing
+ * @brief The curve mapping elapsed time to progress.
+ */
+enum class Easing : uint8_t {
+    Linear,
+    EaseInQuad,
+    EaseOutQuad,
+    EaseInOutQuad,
+    EaseOutCubic,
+    EaseInOutCubic
+};
+
+/**
+ * @brief Applies an easing curve.
+ * @param t Linear progress, clamped to [0, 1].
+ * @return Eased progress; 0 at `t = 0` and 1 at `t = 1` for every curve.
+ */
+[[nodiscard]] float ease(Easing easing, float t) noexcept;
+
+/**
+ * @struct AnimationSpec
+ * @brief How long a tween runs and how it is shaped. A zero duration snaps.
+ */
+struct AnimationSpec {
+    std::chrono::milliseconds duration{150};
+    Easing easing = Easing::EaseOutCubic;
+};
+
+/**
+ * @enum AnimatedProperty
+ * @brief Names the property a tween writes; one tween per (widget, property).
+ * @details Widgets animating a property of their own use `Custom` plus an offset.
+ */
+enum class AnimatedProperty : uint8_t {
+    BackgroundColor,
+    Rect,
+    Opacity,
+    ScrollOffset,
+    SliderValue,
+    Custom
+};
+
+// ============================================================================
+// VALUE TRAITS
+// ============================================================================
+
+/** @brief The packed components of an animated value. */
+using AnimationValues = std::array<double, 4>;
+
+/**
+ * @brief Packs a value into components and back. Specialized per animatable type.
+ */
+template <typename T>
+struct AnimationTraits;
+
+template <>
+struct AnimationTraits<float> {
+    static AnimationValues pack(float value) noexcept { return {value, 0.0, 0.0, 0.0}; }
+    static float unpack(const AnimationValues& v) noexcept { return static_cast<float>(v[0]); }
+};
+
+template <>
+struct AnimationTraits<double> {
+    static AnimationValues pack(double value) noexcept { return {value, 0.0, 0.0, 0.0}; }
+    static double unpack(const AnimationValues& v) noexcept { return v[0]; }
+};
+
+template <>
+struct AnimationTraits<Color> {
+    static AnimationValues pack(const Color& c) noexcept { return {double(c.r), double(c.g), double(c.b), double(c.a)}; }
+    static Color unpack(const AnimationValues& v) noexcept;
+};
+
+template <>
+struct AnimationTraits<Point<float>> {
+    static AnimationValues pack(const Point<float>& p) noexcept { return {p.x, p.y, 0.0, 0.0}; }
+    static Point<float> unpack(const AnimationValues& v) noexcept {
+        return Point<float>(static_cast<float>(v[0]), static_cast<float>(v[1]));
+    }
+};
+
+template <>
+struct AnimationTraits<Rect<int32_t, uint32_t>> {
+    static AnimationValues pack(const Rect<int32_t, uint32_t>& r) noexcept {
+        return {double(r.x), double(r.y), double(r.w), double(r.h)};
+    }
+    static Rect<int32_t, uint32_t> unpack(const AnimationValues& v) noexcept;
+};
+
+// ============================================================================
+// ANIMATOR
+// ============================================================================
+
+/**
+ * @class Animator
+ * @brief Runs every property tween of the UI thread from one frame ticker.
+ *
+ * A widget that is not attached to a window (or a zero duration) snaps to
+ * the target instead: nothing would show the frames in between. A setter
+ * that is called directly does not stop a tween of the same property;
+ * widgets whose own input must win (scrolling, dragging) `cancel()` it.
+ *
+ * @note UI thread only.
+ */
+class Animator {
+public:
+    using Clock = std::chrono::steady_clock;
+    /** @brief Writes one interpolated value into the widget. */
+    using Applier = std::function<void(const AnimationValues&)>;
+
+private:
+    struct Animation {
+        Widget* target = nullptr;   ///< Null once finished or cancelled; compacted after the tick.
+        AnimatedProperty property = AnimatedProperty::Custom;
+        Easing easing = Easing::Linear;
+        AnimationValues from{};
+        AnimationValues to{};
+        Clock::time_point start{};
+        Clock::duration duration{};
+        Applier apply;
+    };
+
+    std::vector<Animation> animations_;
+    std::vector<Animation> started_;    ///< Started by a setter during a tick; merged after it.
+    uint64_t tickerId_ = 0;             ///< 0 until the first tween registers the ticker.
+    bool ticking_ = false;
+
+    static Animator* instance_;         ///< Set while the singleton is alive.
+
+    Animator();
+
+public:
+    ~Animator();
+
+    Animator(const Animator&) = delete;
+    Animator& operator=(const Animator&) = delete;
+
+    /** @brief Gets the animator of the UI thread. */
+    static Animator& instance();
+
+    /**
+     * @brief Tweens a property from `from` to `to`.
+     * @param setter Called with each interpolated `T`, the last time with `to`.
+     *        Usually the widget's own setter, which invalidates the widget's rect.
+     */
+    template <typename T, typename Setter>
+    void animate(Widget& target, AnimatedProperty property, const T& from, const T& to,
+                 const AnimationSpec& spec, Setter&& setter) {
+        using Traits = AnimationTraits<T>;
+        start(target, property, Traits::pack(from), Traits::pack(to), spec,
+              [setter = std::forward<Setter>(setter)](const AnimationValues& values) {
+                  setter(Traits::unpack(values));
+              });
+    }
+
+    /** @brief Tweens the background color from its current value. */
+    void animateBackgroundColor(Widget& target, const Color& to, const AnimationSpec& spec = {});
+
+    /** @brief Tweens the bounds from their current value. */
+    void animateRect(Widget& target, const Rect<int32_t, uint32_t>& to, const AnimationSpec& spec = {});
+
+    /**
+     * @brief Stops a tween where it is.
+     * @return `true` if one was running.
+     */
+    bool cancel(const Widget& target, AnimatedProperty property) noexcept;
+
+    /** @brief Stops every tween of `target`. */
+    void cancelAll(const Widget* target) noexcept;
+
+    /** @brief Stops the tweens of a widget being destroyed, without creating the animator. */
+    static void forget(const Widget* target) noexcept;
+
+    /**
+     * @brief Checks if any tween targets `root` or a widget under it, without creating the animator.
+     * @details A window asks this each frame to keep its paint rate up while animating.
+     */
+    [[nodiscard]] static bool isAnimatingUnder(const IWidget* root) noexcept;
+
+    /** @brief Checks if a property is being tweened. */
+    [[nodiscard]] bool isAnimating(const Widget& target, AnimatedProperty property) const noexcept;
+
+    /** @brief Gets the number of running tweens. */
+    [[nodiscard]] size_t getActiveCount() const noexcept;
+
+    /**
+     * @brief Advances every tween to `frameTime` and drops the finished ones.
+     * @details Run by the frame ticker; public for loops that drive their own clock.
+     * @return `true` while any tween still runs.
+     */
+    bool tick(Clock::time_point frameTime);
+
+private:
+    void start(Widget& target, AnimatedProperty property, const AnimationValues& from,
+               const AnimationValues& to, const AnimationSpec& spec, Applier apply);
+    void ensureTicker();
+    Animation* find(std::vector<Animation>& list, const Widget* target, AnimatedProperty property) noexcept;
+};
+
+} // namespace frqs::widget
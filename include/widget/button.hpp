@@ -6,6 +6,7 @@
 #pragma once
 
 #include "iwidget.hpp"
+#include "animation.hpp"
 #include "render/renderer.hpp"
 #include <functional>
 
@@ -20,6 +21,9 @@ namespace frqs::widget {
  */
 class Button : public Widget {
 public:
+    static constexpr WidgetKind KIND = WidgetKind::Button;
+    using KindOwner = Button;
+
     /**
      * @brief Defines the function signature for the button's click event handler.
      */
@@ -52,6 +56,7 @@ private:
     Color hoverColor_ = Color(41, 128, 185);      // Darker blue
     Color pressedColor_ = Color(21, 101, 192);    // Even darker
     Color disabledColor_ = Color(149, 165, 166);  // Gray
+    AnimationSpec hoverTransition_{std::chrono::milliseconds(120), Easing::EaseOutQuad};
     
     // Border
     float borderRadius_ = 4.0f;
@@ -106,16 +111,16 @@ public:
     void setFontSize(float size) noexcept { font_.size = size; }
 
     /** @brief Sets the background color for the button's normal (idle) state. */
-    void setNormalColor(const Color& color) noexcept { normalColor_ = color; }
+    void setNormalColor(const Color& color) noexcept { normalColor_ = color; syncBackground(); }
 
     /** @brief Sets the background color for the button's hovered (mouse over) state. */
-    void setHoverColor(const Color& color) noexcept { hoverColor_ = color; }
+    void setHoverColor(const Color& color) noexcept { hoverColor_ = color; syncBackground(); }
 
     /** @brief Sets the background color for the button's pressed (mouse down) state. */
-    void setPressedColor(const Color& color) noexcept { pressedColor_ = color; }
+    void setPressedColor(const Color& color) noexcept { pressedColor_ = color; syncBackground(); }
 
     /** @brief Sets the background color for the button's disabled state. */
-    void setDisabledColor(const Color& color) noexcept { disabledColor_ = color; }
+    void setDisabledColor(const Color& color) noexcept { disabledColor_ = color; syncBackground(); }
 
     /**
      * @brief Sets the corner radius for the button's border.
@@ -130,6 +135,12 @@ public:
      */
     void setBorder(const Color& color, float width) noexcept;
 
+    /**
+     * @brief Sets how the background fades between the normal and hovered colors.
+     * @details Pressing and disabling still switch at once. A zero duration snaps.
+     */
+    void setHoverTransition(const AnimationSpec& spec) noexcept { hoverTransition_ = spec; }
+
     /**
      * @brief Manually sets the visual state of the button.
      * @param state The new state to apply.
@@ -183,6 +194,12 @@ private:
      */
     Color getCurrentColor() const noexcept;
 
+    /**
+     * @brief Stops a color fade and shows the current state's color.
+     * @internal
+     */
+    void syncBackground() noexcept;
+
     /**
      * @brief Checks if a given point is within the button's boundaries.
      * @internal
@@ -27,6 +27,9 @@ namespace frqs::widget {
  */
 class CheckBox : public Widget {
 public:
+    static constexpr WidgetKind KIND = WidgetKind::CheckBox;
+    using KindOwner = CheckBox;
+
     /**
      * @brief Callback function type for when the checked state changes.
      * @param checked True if the box is now checked, false otherwise.
@@ -70,6 +70,9 @@ namespace frqs::widget {
  */
 class ComboBox : public Widget {
 public:
+    static constexpr WidgetKind KIND = WidgetKind::ComboBox;
+    using KindOwner = ComboBox;
+
     /**
      * @brief Callback function type for when the selected item changes.
      * @param index The index of the newly selected item.
@@ -24,6 +24,11 @@ namespace frqs::widget {
  * The Container is the primary tool for building complex user interfaces. It manages a
  * collection of child widgets and uses a `ILayout` object to determine their positions
  * and sizes. It can also have its own visual properties like padding and a border.
+ *
+ * A Container handles no events itself: once attached, a plain Container's
+ * event mask is empty, so event dispatch passes straight through it to
+ * interested children. Subclasses keep `EVENT_MASK_ALL` and receive every
+ * event in `onEvent` unless they narrow it with `setEventMask()`.
  */
 class Container : public Widget {
 private:
@@ -34,6 +39,9 @@ private:
     bool autoLayout_ = true;
 
 public:
+    static constexpr WidgetKind KIND = WidgetKind::Container;
+    using KindOwner = Container;
+
     /**
      * @brief Constructs a new Container with a default layout.
      */
@@ -93,6 +101,9 @@ public:
 
     /**
      * @brief Enables or disables automatic layout updates when the container is resized.
+     * @details Automatic layouts of a container attached to a window are
+     *          deferred to the window's layout pass, so any number of
+     *          changes within a frame cost a single layout.
      * @param enable True to enable automatic layout, false to disable.
      */
     void setAutoLayout(bool enable) noexcept { autoLayout_ = enable; }
@@ -105,9 +116,17 @@ public:
 
     /**
      * @brief Manually triggers the layout to rearrange its child widgets.
+     * @details Runs immediately; automatic updates go through `invalidateLayout()`.
      */
     void applyLayout();
 
+    /**
+     * @brief Schedules an automatic layout update.
+     * @details Queued for the window's layout pass while attached, applied
+     *          right away while detached. Does nothing if auto-layout is off.
+     */
+    void invalidateLayout();
+
     /**
      * @brief Sets the rectangle (position and size) of the widget.
      * 
@@ -121,6 +140,10 @@ public:
      * @param renderer The renderer to draw with.
      */
     void render(Renderer& renderer) override;
+
+protected:
+    /** @brief Applies the layout when the window's layout pass reaches this container. */
+    void onLayout() override;
 };
 
 // ============================================================================
@@ -0,0 +1,83 @@
+/**
+ * @file focus_manager.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Tracks the focused widget of a window and routes keyboard input to it.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Key and character events go straight to the focused widget and bubble up
+ * its parent chain until a widget handles them; no part of the tree is
+ * searched. Unhandled Tab / Shift+Tab presses move focus along the tab order.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "widget/iwidget.hpp"
+
+namespace frqs::widget {
+
+// ============================================================================
+// FOCUS MANAGER
+// ============================================================================
+
+/**
+ * @class FocusManager
+ * @brief Owns the keyboard focus of one widget tree.
+ *
+ * Focus changes are announced to the widgets involved with `FocusEvent`
+ * (`Lost` to the old widget first, then `Gained` to the new one).
+ */
+class FocusManager {
+private:
+    std::shared_ptr<IWidget> focused_;
+    std::vector<std::shared_ptr<IWidget>> tabScratch_;  ///< Reused by tab navigation.
+
+public:
+    FocusManager() = default;
+
+    /** @brief Returns the focused widget, or nullptr. */
+    [[nodiscard]] IWidget* getFocused() const noexcept { return focused_.get(); }
+
+    /**
+     * @brief Moves focus to `widget` (nullptr clears it).
+     * @param root The window's root widget; `widget` must belong to its tree.
+     * @return `true` if focus changed.
+     */
+    bool setFocus(const std::shared_ptr<IWidget>& root, IWidget* widget);
+
+    /** @brief Clears focus, sending `Lost` to the focused widget. */
+    void clearFocus();
+
+    /**
+     * @brief Delivers a key (or char) event to the focused widget, bubbling to its ancestors.
+     * @details Falls back to the root if nothing is focused or the focused widget
+     *          left the tree. An unhandled Tab press moves focus.
+     * @return `true` if a widget handled the event.
+     */
+    bool dispatchKey(const std::shared_ptr<IWidget>& root, const event::Event& event);
+
+    /**
+     * @brief Gives focus to the focusable widget that owns `target` (or clears focus).
+     * @details Called for mouse presses before the press is dispatched.
+     */
+    void focusFromPointer(const std::shared_ptr<IWidget>& root, IWidget* target);
+
+    /**
+     * @brief Moves focus to the next (or previous) focusable widget in tab order, wrapping around.
+     * @return `true` if focus moved.
+     */
+    bool focusNext(const std::shared_ptr<IWidget>& root, bool backward = false);
+
+private:
+    [[nodiscard]] static bool isAttached(const IWidget* widget, const IWidget* root) noexcept;
+    [[nodiscard]] static bool canFocus(IWidget* widget) noexcept;
+    [[nodiscard]] static std::shared_ptr<IWidget> findOwner(const std::shared_ptr<IWidget>& root, IWidget* widget);
+    void collectTabOrder(const std::shared_ptr<IWidget>& widget);
+    static void notify(IWidget& widget, event::FocusEvent::Action action);
+};
+
+} // namespace frqs::widget
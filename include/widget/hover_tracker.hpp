@@ -0,0 +1,92 @@
+/**
+ * @file hover_tracker.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Caches the hover path of a window and produces enter/leave transitions.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Most mouse moves land in the same leaf widget as the previous one. The
+ * tracker keeps the path from the root to the hovered leaf together with a
+ * "fast rect": the part of the leaf that no sibling above it covers. While the
+ * widget tree is unchanged and the cursor stays inside that rect, the hit test
+ * is skipped entirely. When the leaf changes, the old and new paths are
+ * diffed to deliver `MouseHoverEvent`s.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "widget/iwidget.hpp"
+
+namespace frqs::widget {
+
+// ============================================================================
+// HOVER TRACKER
+// ============================================================================
+
+/**
+ * @class HoverTracker
+ * @brief Resolves the widget under the cursor, reusing the previous result when possible.
+ *
+ * The path holds owning references, so widgets removed from the tree while
+ * hovered still receive their `Leave` before they are released.
+ */
+class HoverTracker {
+private:
+    std::vector<std::shared_ptr<IWidget>> path_;        ///< Root first, hovered leaf last.
+    std::vector<std::shared_ptr<IWidget>> nextPath_;    ///< Scratch for the path being built.
+    std::vector<IWidget*> chain_;                       ///< Scratch: hit target up to the root.
+    Rect<int32_t, uint32_t> fastRect_;
+    bool fastValid_ = false;
+    uint64_t epoch_ = 0;
+    size_t fastHits_ = 0;
+    size_t fullHits_ = 0;
+
+public:
+    HoverTracker() {
+        path_.reserve(16);
+        nextPath_.reserve(16);
+        chain_.reserve(16);
+    }
+
+    /**
+     * @brief Returns the hovered leaf for `position`, emitting enter/leave on change.
+     * @param root The window's root widget.
+     * @param position The cursor position, in window coordinates.
+     * @param epoch A counter that changes whenever the widget tree may have
+     *              changed shape (the window's invalidation count).
+     * @param timestamp Timestamp stamped onto generated hover events.
+     * @return The hovered leaf, or nullptr if nothing is under the cursor.
+     */
+    IWidget* update(const std::shared_ptr<IWidget>& root, const Point<int32_t>& position,
+                    uint64_t epoch, uint64_t timestamp);
+
+    /**
+     * @brief Sends `Leave` to the whole hover path and forgets it.
+     * @details Called when the cursor leaves the window or the root is replaced.
+     */
+    void clear(const Point<int32_t>& position, uint64_t timestamp);
+
+    /** @brief Returns the hovered leaf, or nullptr. */
+    [[nodiscard]] IWidget* getHovered() const noexcept {
+        return path_.empty() ? nullptr : path_.back().get();
+    }
+
+    /** @brief Returns true if `widget` is on the current hover path. */
+    [[nodiscard]] bool isHovered(const IWidget* widget) const noexcept;
+
+    /** @brief Number of moves resolved without a hit test. */
+    [[nodiscard]] size_t getFastHits() const noexcept { return fastHits_; }
+    /** @brief Number of moves that needed a full hit test. */
+    [[nodiscard]] size_t getFullHits() const noexcept { return fullHits_; }
+
+private:
+    void buildPath(const std::shared_ptr<IWidget>& root, IWidget* target);
+    void transition(const Point<int32_t>& position, uint64_t timestamp);
+    void computeFastRect();
+};
+
+} // namespace frqs::widget
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "iwidget.hpp"
+#include "animation.hpp"
 #include <string>
 
 namespace frqs::widget {
@@ -26,6 +27,9 @@ namespace frqs::widget {
  */
 class Image : public Widget {
 public:
+    static constexpr WidgetKind KIND = WidgetKind::Image;
+    using KindOwner = Image;
+
     /**
      * @brief Defines how the image should be scaled to fit the widget's area.
      */
@@ -108,6 +112,13 @@ public:
      * @param opacity The opacity value, from 0.0 (fully transparent) to 1.0 (fully opaque).
      */
     void setOpacity(float opacity) noexcept;
+
+    /**
+     * @brief Fades the image to an opacity on the frame clock; only the image repaints.
+     * @param opacity The opacity to end on, from 0.0 to 1.0.
+     * @param spec Duration and easing of the fade.
+     */
+    void fadeTo(float opacity, const AnimationSpec& spec = {});
     
     /**
      * @brief Gets the current opacity of the image.
@@ -14,6 +14,7 @@
 namespace frqs::widget {
 
 class Widget;
+class InvalidationSink;
 
 /**
  * @brief Contains internal implementation details for the widget system.
@@ -22,17 +23,17 @@ class Widget;
 namespace internal {
 
 /**
- * @brief Recursively sets the native window handle for a widget and all its children.
+ * @brief Recursively attaches a widget and all its children to a window's invalidation sink.
  * 
  * This function is intended for internal use by the `Window` class when a widget tree is attached to it.
- * It traverses the widget hierarchy starting from the given widget and assigns the window handle (`HWND` on Windows)
- * to each widget. This association is crucial for widgets to be able to interact with the parent window,
- * for example, to invalidate their region and trigger a redraw using `InvalidateRect`.
+ * Each widget caches the sink so that `invalidate()` reaches the owning window in O(1), without
+ * walking up the parent chain. Passing `nullptr` detaches the subtree. Attaching also settles the
+ * event masks of pass-through widgets (see `Widget::setPassThroughType`).
  * 
- * @param widget A pointer to the root widget of the tree (or subtree) to which the window handle will be set.
- * @param hwnd A type-erased pointer to the native window handle (e.g., `HWND`).
+ * @param widget A pointer to the root widget of the tree (or subtree) to attach.
+ * @param sink The window's invalidation sink, or `nullptr` to detach.
  */
-void setWidgetWindowHandle(Widget* widget, void* hwnd);
+void setWidgetInvalidationSink(Widget* widget, InvalidationSink* sink);
 
 } // namespace internal
 } // namespace frqs::widget
\ No newline at end of file
@@ -0,0 +1,73 @@
+/**
+ * @file invalidation_sink.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Defines the portable interface widgets use to request repaints and focus.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Widgets never talk to the OS directly. When a widget tree is attached to a
+ * window, every widget caches a pointer to the window's sink. Invalidations are
+ * accumulated and coalesced by the sink, then flushed to the platform once per
+ * frame, so a layout pass that moves N children costs one OS call, not N.
+ * The same sink receives focus requests, which the window's focus manager
+ * turns into `FocusEvent`s, and layout requests, which the window runs once
+ * per frame in its layout pass (parents before children).
+ */
+
+#pragma once
+
+#include <cstdint>
+#include "unit/rect.hpp"
+
+namespace frqs::widget {
+
+class IWidget;
+class Widget;
+
+// ============================================================================
+// INVALIDATION SINK
+// ============================================================================
+
+/**
+ * @class InvalidationSink
+ * @brief Receives repaint requests from a widget tree and defers them to the next flush.
+ *
+ * The generation counter advances on every flush. Widgets remember the
+ * generation of their last request and drop exact duplicates within a frame.
+ */
+class InvalidationSink {
+public:
+    virtual ~InvalidationSink() = default;
+
+    /** @brief Queues a region (window coordinates) for repaint. */
+    virtual void invalidateRect(const Rect<int32_t, uint32_t>& rect) noexcept = 0;
+
+    /** @brief Queues the whole surface for repaint. */
+    virtual void invalidateAll() noexcept = 0;
+
+    /** @brief Returns the current frame generation. Advances once per flush. */
+    [[nodiscard]] virtual uint64_t getGeneration() const noexcept = 0;
+
+    /** @brief Asks the window to move keyboard focus to `widget`. */
+    virtual void requestFocus(IWidget* widget) = 0;
+
+    /** @brief Drops keyboard focus if `widget` currently holds it. */
+    virtual void releaseFocus(IWidget* widget) = 0;
+
+    /** @brief Queues `widget` for the next layout pass. Called once until the pass runs it. */
+    virtual void requestLayout(Widget* widget) = 0;
+
+    /** @brief Drops a queued layout request (the widget leaves the tree or is destroyed). */
+    virtual void cancelLayout(Widget* widget) noexcept = 0;
+
+    /**
+     * @brief Notes that a widget moved, was shown or hidden, or joined or left the tree.
+     * @details Unlike repaint requests, never deduplicated: caches of what is
+     *          under the cursor must be dropped even if the area is already queued.
+     */
+    virtual void noteTreeChanged() noexcept {}
+};
+
+} // namespace frqs::widget
@@ -20,20 +20,27 @@
 
 #include <memory>
 #include <string>
+#include <type_traits>
+#include <typeinfo>
 #include <vector>
 #include "unit/rect.hpp"
 #include "unit/color.hpp"
 #include "event/event.hpp"
 
+namespace frqs::render {
+    class IExtendedRenderer;
+}
+
 namespace frqs::widget {
 
 // Forward declarations
 class IWidget;
 class Widget;
 class Renderer;
+class InvalidationSink;
 
 namespace internal {
-    void setWidgetWindowHandle(Widget*, void*);
+    void setWidgetInvalidationSink(Widget*, InvalidationSink*);
 }
 
 // ============================================================================
@@ -77,6 +84,32 @@ struct LayoutProps {
     Align alignSelf = Align::Stretch;
 };
 
+// ============================================================================
+// WIDGET KIND TAGS (RTTI-free type checks)
+// ============================================================================
+
+/**
+ * @enum WidgetKind
+ * @brief A cheap type tag stored in every widget.
+ * @details Lets hot paths (layout, invalidation, hit-testing) recover the
+ *          concrete type with a byte compare and a `static_cast` instead of
+ *          `dynamic_cast`. Any kind other than `Custom` derives from `Widget`.
+ */
+enum class WidgetKind : uint8_t {
+    Custom,     //!< Implements IWidget directly (not derived from Widget).
+    Widget,     //!< Plain Widget, or a user subclass that did not set a kind.
+    Container,
+    Label,
+    Button,
+    CheckBox,
+    Slider,
+    TextInput,
+    ScrollView,
+    ListView,
+    ComboBox,
+    Image
+};
+
 // ============================================================================
 // WIDGET INTERFACE (Virtual for polymorphism at high level ONLY)
 // ============================================================================
@@ -161,6 +194,49 @@ public:
      * @return IWidget* A pointer to the parent widget, or nullptr if this is a top-level widget.
      */
     virtual IWidget* getParent() const noexcept = 0;
+
+    /**
+     * @brief Gets the widget's kind tag. Non-virtual.
+     * @return WidgetKind The tag set by the concrete class constructor.
+     */
+    [[nodiscard]] WidgetKind getKind() const noexcept { return kind_; }
+
+    /**
+     * @brief Gets the event types this widget's `onEvent` handles. Non-virtual.
+     * @return event::EventMask One bit per `Event` alternative; all bits by default.
+     */
+    [[nodiscard]] event::EventMask getEventMask() const noexcept { return eventMask_; }
+
+    /**
+     * @brief Gets the OR of the event masks of this widget and all its descendants. Non-virtual.
+     * @details Dispatch skips a whole subtree when the event's bit is not set here.
+     */
+    [[nodiscard]] event::EventMask getSubtreeEventMask() const noexcept { return subtreeEventMask_; }
+
+    /** @brief Checks if this widget's own mask contains the event's type. */
+    [[nodiscard]] bool wantsEvent(const event::Event& event) const noexcept {
+        return (eventMask_ & event::eventMaskOf(event)) != 0;
+    }
+
+protected:
+    /**
+     * @brief Sets the kind tag. Called once from concrete widget constructors.
+     * @param kind The tag describing the concrete type.
+     */
+    void setKind(WidgetKind kind) noexcept { kind_ = kind; }
+
+    /**
+     * @brief Stores the own and subtree event masks. Keeping them consistent is up to the caller.
+     */
+    void storeEventMasks(event::EventMask own, event::EventMask subtree) noexcept {
+        eventMask_ = own;
+        subtreeEventMask_ = subtree;
+    }
+
+private:
+    WidgetKind kind_ = WidgetKind::Custom;
+    event::EventMask eventMask_ = event::EVENT_MASK_ALL;
+    event::EventMask subtreeEventMask_ = event::EVENT_MASK_ALL;
 };
 
 // ============================================================================
@@ -179,6 +255,13 @@ private:
     std::unique_ptr<Impl> pImpl_;  // Hide implementation details
 
 public:
+    static constexpr WidgetKind KIND = WidgetKind::Widget;
+    /** @brief The class `KIND` belongs to; a subclass with its own kind redeclares both. */
+    using KindOwner = Widget;
+
+    /** @brief Child count at which `hitTest` switches from a linear scan to a spatial index. */
+    static constexpr size_t DEFAULT_HIT_INDEX_THRESHOLD = 128;
+
     /**
      * @brief Default constructor.
      */
@@ -209,6 +292,83 @@ public:
     const std::vector<std::shared_ptr<IWidget>>& getChildren() const noexcept override;
     IWidget* getParent() const noexcept override;
 
+    /**
+     * @brief Sets the child count at which hit-testing uses a spatial index.
+     * @details Above the threshold, children are bucketed into a uniform grid
+     *          over this widget's bounds, updated incrementally as children move.
+     *          Pass `SIZE_MAX` to disable the index.
+     * @param count The child count threshold.
+     */
+    void setHitIndexThreshold(size_t count) noexcept;
+    /** @brief Gets the hit-test index threshold. */
+    size_t getHitIndexThreshold() const noexcept;
+
+    // --- Keyboard focus ---
+
+    /**
+     * @brief Marks the widget as able to take keyboard focus (by click or Tab).
+     * @param focusable `true` to let the window's focus manager focus this widget.
+     */
+    void setFocusable(bool focusable) noexcept;
+    /** @brief Checks if the widget can take keyboard focus. */
+    bool isFocusable() const noexcept;
+
+    /**
+     * @brief Sets the widget's position in the Tab order.
+     * @details Positive indices come first, in ascending order; widgets with
+     *          index 0 (the default) follow in tree order.
+     * @param index The tab index.
+     */
+    void setTabIndex(int32_t index) noexcept;
+    /** @brief Gets the widget's tab index. */
+    int32_t getTabIndex() const noexcept;
+
+    /**
+     * @brief Asks the owning window to give this widget keyboard focus.
+     * @return `true` if a window handled the request (a `FocusEvent` follows),
+     *         `false` if the widget is not attached to a window.
+     */
+    bool requestFocus();
+    /**
+     * @brief Gives up keyboard focus if this widget holds it.
+     * @return `true` if a window handled the request.
+     */
+    bool releaseFocus();
+    /** @brief Checks if the widget belongs to a window's tree (invalidations reach a window). */
+    bool isAttached() const noexcept;
+
+    // --- Deferred layout ---
+
+    /**
+     * @brief Asks the owning window to run `onLayout()` in the frame's layout pass.
+     * @details Repeated requests before the pass collapse into one. Parents
+     *          are laid out before their children, so a child resized by its
+     *          parent's layout still runs once.
+     * @return `true` if queued (or already queued), `false` if the widget is
+     *         not attached to a window; the caller then lays out right away.
+     */
+    bool requestLayout();
+    /** @brief Checks if a layout request is waiting for the window's layout pass. */
+    bool isLayoutRequested() const noexcept;
+    /**
+     * @brief Runs a queued layout now and clears the request.
+     * @note Called by the window's layout pass.
+     */
+    void performLayout();
+
+    // --- Event interest ---
+
+    /**
+     * @brief Declares the event types this widget's `onEvent` handles.
+     * @details Widgets default to `EVENT_MASK_ALL`. Dispatch never offers an
+     *          event outside the mask, and skips subtrees where no widget wants
+     *          it. Subclasses that override `onEvent` of a widget that narrowed
+     *          its mask must widen it again (pass-through widgets such as
+     *          `Container` narrow only exact instances; see `setPassThroughType`).
+     * @param mask Bits built with `event::eventMask<...>`.
+     */
+    void setEventMask(event::EventMask mask) noexcept;
+
     /**
      * @brief Gets the widget's position. Non-virtual for performance.
      * @tparam T The coordinate type (e.g., int32_t, float).
@@ -285,13 +445,76 @@ public:
      */
     LayoutProps& getLayoutPropsMut() noexcept;
 
-    friend void internal::setWidgetWindowHandle(Widget* widget, void* hwnd);
+protected:
+    /**
+     * @brief Arranges the children; run by `performLayout()`. The base does nothing.
+     */
+    virtual void onLayout() {}
+
+    /**
+     * @brief Marks instances of exactly `type` as handling no events.
+     * @details For widgets that keep the base no-op `onEvent`. The mask stays
+     *          `EVENT_MASK_ALL` until the widget is first attached, when the
+     *          complete dynamic type is known: only an exact `type` instance
+     *          whose mask was not set explicitly drops to `EVENT_MASK_NONE`.
+     *          A subclass may override `onEvent`, so it keeps receiving events.
+     * @param type `typeid` of the class whose constructor calls this.
+     */
+    void setPassThroughType(const std::type_info& type) noexcept;
+
+public:
+    friend void internal::setWidgetInvalidationSink(Widget* widget, InvalidationSink* sink);
 };
 
+// ============================================================================
+// RTTI-FREE CASTS
+// ============================================================================
+
+/**
+ * @brief Casts an IWidget to Widget using its kind tag.
+ * @param widget The widget to cast (may be null).
+ * @return Widget* The widget, or nullptr if it does not derive from Widget.
+ */
+[[nodiscard]] inline Widget* asWidget(IWidget* widget) noexcept {
+    return (widget && widget->getKind() != WidgetKind::Custom)
+        ? static_cast<Widget*>(widget)
+        : nullptr;
+}
+
+/**
+ * @brief Casts an IWidget to a concrete widget type using its kind tag.
+ * @tparam T A widget class declaring its own `KIND` and `KindOwner`. A subclass
+ *         that inherits them shares its base's kind, so the tag cannot tell
+ *         the two apart; such a cast does not compile.
+ * @param widget The widget to cast (may be null).
+ * @return T* The widget, or nullptr if its kind does not match.
+ */
+template <typename T>
+[[nodiscard]] T* widgetCast(IWidget* widget) noexcept {
+    static_assert(std::is_same_v<typename T::KindOwner, T>,
+                  "widgetCast<T>: T must declare its own KIND and KindOwner");
+    if constexpr (std::is_same_v<T, Widget>) {
+        return asWidget(widget);
+    } else {
+        return (widget && widget->getKind() == T::KIND) ? static_cast<T*>(widget) : nullptr;
+    }
+}
+
 // ============================================================================
 // RENDERER INTERFACE (Direct2D abstraction)
 // ============================================================================
 
+/**
+ * @struct RendererCaps
+ * @brief Capabilities of a renderer, readable without RTTI.
+ * @details Widgets read this once at the top of `render()` instead of
+ *          probing the renderer with `dynamic_cast` on every call.
+ */
+struct RendererCaps {
+    /** @brief Non-null if the renderer implements `render::IExtendedRenderer`. */
+    render::IExtendedRenderer* extended = nullptr;
+};
+
 /**
  * @class Renderer
  * @brief An abstract interface for rendering operations.
@@ -299,12 +522,21 @@ public:
  *          OpenGL, Skia) by providing a common set of drawing commands.
  */
 class Renderer {
+protected:
+    RendererCaps caps_; ///< Filled in by derived renderer constructors.
+
 public:
     /**
      * @brief Virtual destructor.
      */
     virtual ~Renderer() noexcept = default;
 
+    /**
+     * @brief Gets the renderer's capabilities. Non-virtual.
+     * @return const RendererCaps& The capability struct.
+     */
+    [[nodiscard]] const RendererCaps& getCaps() const noexcept { return caps_; }
+
     /**
      * @brief Clears the entire render target with a specified color.
      * @param color The color to clear with.
@@ -350,6 +582,20 @@ public:
      * @brief Pops the current clipping rectangle from the render stack.
      */
     virtual void popClip() = 0;
+
+    /**
+     * @brief Marks the start of the drawing commands issued by a widget.
+     * @details Called around each child's `render()`. Immediate-mode renderers
+     *          ignore it; recording renderers use it to attribute commands to
+     *          widgets (see `render::DisplayListRecorder`).
+     * @param widget The widget about to render.
+     */
+    virtual void beginWidget(const IWidget* widget) { (void)widget; }
+
+    /**
+     * @brief Marks the end of the commands started by the matching `beginWidget`.
+     */
+    virtual void endWidget() {}
 };
 
 } // namespace frqs::widget
\ No newline at end of file
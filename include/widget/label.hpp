@@ -23,6 +23,9 @@ namespace frqs::widget {
  */
 class Label : public Widget {
 public:
+    static constexpr WidgetKind KIND = WidgetKind::Label;
+    using KindOwner = Label;
+
     /**
      * @brief Specifies the horizontal alignment of the text within the label's bounds.
      */
@@ -74,7 +74,7 @@ public:
      * Example:
      * ```cpp
      * void updateView(size_t index, IWidget* view) override {
-     *     auto* label = dynamic_cast<Label*>(view);
+     *     auto* label = widgetCast<Label>(view);
      *     label->setText(myData[index]);
      * }
      * ```
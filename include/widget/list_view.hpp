@@ -31,6 +31,9 @@ namespace frqs::widget {
  */
 class ListView : public Widget {
 public:
+    static constexpr WidgetKind KIND = WidgetKind::ListView;
+    using KindOwner = ListView;
+
     /**
      * @brief A callback function type that is invoked when the selected item changes.
      * @param index The index of the newly selected item, or size_t(-1) if the selection is cleared.
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "iwidget.hpp"
+#include "animation.hpp"
 #include <memory>
 
 namespace frqs::widget {
@@ -28,6 +29,9 @@ namespace frqs::widget {
  */
 class ScrollView : public Widget {
 public:
+    static constexpr WidgetKind KIND = WidgetKind::ScrollView;
+    using KindOwner = ScrollView;
+
     /**
      * @brief Constructs a new ScrollView object.
      */
@@ -59,11 +63,22 @@ public:
 
     /**
      * @brief Scrolls the view to an absolute offset.
+     * @details Stops a smooth scroll in progress.
      * @param[in] x The horizontal scroll position.
      * @param[in] y The vertical scroll position.
      */
     void scrollTo(float x, float y);
 
+    /**
+     * @brief Glides to an absolute offset on the frame clock.
+     * @details Only the view repaints while it moves. Wheel, drag and `scrollTo()`
+     *          take over from it at once.
+     * @param[in] x The horizontal scroll position.
+     * @param[in] y The vertical scroll position.
+     * @param[in] spec Duration and easing of the glide.
+     */
+    void animateScrollTo(float x, float y, const AnimationSpec& spec = {});
+
     /**
      * @brief Scrolls the view by a relative amount.
      * @param[in] dx The change in horizontal scroll position.
@@ -174,6 +189,8 @@ private:
     Point<int32_t> dragStartPos_;             ///< Mouse position where a scrollbar drag started.
     float dragStartOffset_ = 0.0f;            ///< Scroll offset when a drag started.
 
+    AnimationSpec jumpTransition_{std::chrono::milliseconds(200), Easing::EaseOutCubic}; ///< Glide of a track click.
+
     // Scrollbar colors
     Color scrollbarColor_ = Color(150, 150, 150, 180);       ///< Default color of the scrollbar thumbs.
     Color scrollbarHoverColor_ = Color(120, 120, 120, 220);  ///< Color of scrollbar thumbs when hovered.
@@ -192,6 +209,11 @@ private:
      */
     void clampScrollOffset();
 
+    /**
+     * @brief Moves the content without stopping a smooth scroll; the glide's setter.
+     */
+    void applyScrollOffset(const Point<float>& offset);
+
     // Scrollbar geometry
     /**
      * @brief Gets the rectangle of the content area, excluding scrollbars.
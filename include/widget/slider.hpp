@@ -12,6 +12,7 @@
 #pragma once
 
 #include "iwidget.hpp"
+#include "animation.hpp"
 #include <functional>
 #include <cmath>
 #include "render/renderer.hpp"
@@ -29,6 +30,9 @@ namespace frqs::widget {
  */
 class Slider : public Widget {
 public:
+    static constexpr WidgetKind KIND = WidgetKind::Slider;
+    using KindOwner = Slider;
+
     /**
      * @brief A callback function type invoked when the slider's value changes.
      * @param value The new value of the slider.
@@ -85,10 +89,21 @@ public:
     /**
      * @brief Sets the current value of the slider.
      * @details The value will be clamped to the slider's current range [min, max].
+     *          Stops a glide started by `animateValueTo()`.
      * @param[in] value The new value to set.
      */
     void setValue(double value);
 
+    /**
+     * @brief Glides the thumb to a value on the frame clock.
+     * @details The target is clamped and snapped like `setValue()`; the values
+     *          in between are not snapped, so the thumb moves smoothly.
+     *          `onValueChanged` is not called, as with `setValue()`.
+     * @param[in] value The value to end on.
+     * @param[in] spec Duration and easing of the glide.
+     */
+    void animateValueTo(double value, const AnimationSpec& spec = {});
+
     /**
      * @brief Gets the current value of the slider.
      * @return The current value.
@@ -230,6 +245,11 @@ private:
      * @brief Invokes the onValueChanged callback if it is set.
      */
     void notifyValueChanged();
+
+    /**
+     * @brief Stores a value already in range and repaints; the glide's setter.
+     */
+    void applyValue(double value);
 };
 
 } // namespace frqs::widget
\ No newline at end of file
@@ -0,0 +1,251 @@
+/**
+ * @file spatial_index.hpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Uniform-grid spatial index used to hit-test large child lists.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * A `Widget` with many children (node graphs, floor plans on `AbsoluteLayout`)
+ * builds a `SpatialGrid` over its bounds once the child count crosses its
+ * hit-test threshold. Children are bucketed by the grid cells they overlap;
+ * a hit test only looks at the one cell under the cursor. Moving a child
+ * updates just the cells it leaves and enters.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+#include "core/frame_arena.hpp"
+#include "widget/iwidget.hpp"
+
+namespace frqs::widget {
+
+// ============================================================================
+// SPATIAL GRID
+// ============================================================================
+
+/**
+ * @class SpatialGrid
+ * @brief Buckets child widgets into a uniform grid for point queries.
+ *
+ * Every entry carries the child's z-order (its index in the parent's child
+ * list), so queries return the top-most hit exactly like a reverse scan.
+ * Children that span a large part of the grid, or that cannot report their
+ * own moves (non-`Widget` children), live in an overflow list that every
+ * query checks.
+ */
+class SpatialGrid {
+public:
+    using RectType = Rect<int32_t, uint32_t>;
+
+    struct Entry {
+        IWidget* widget = nullptr;
+        uint32_t order = 0;                         ///< Index in the parent's child list (z-order).
+    };
+
+    static constexpr uint32_t TARGET_PER_CELL = 2;  ///< Sizing goal for uniformly spread children.
+    static constexpr uint32_t MAX_CELLS = 256 * 256;
+    static constexpr uint32_t MAX_CELLS_PER_ENTRY = 64; ///< Larger children go to the overflow list.
+
+private:
+    RectType bounds_;
+    uint32_t cols_ = 0;
+    uint32_t rows_ = 0;
+    uint32_t cellW_ = 1;
+    uint32_t cellH_ = 1;
+    std::vector<std::vector<Entry>> cells_;
+    std::vector<Entry> overflow_;
+    std::vector<Entry> offGrid_;                    ///< Children outside the bounds; never hit, kept for their z-order.
+    size_t size_ = 0;
+
+    struct CellRange {
+        uint32_t c0, r0, c1, r1;                    ///< Inclusive cell bounds.
+        [[nodiscard]] uint32_t count() const noexcept { return (c1 - c0 + 1) * (r1 - r0 + 1); }
+    };
+
+public:
+    SpatialGrid() = default;
+
+    /**
+     * @brief Rebuilds the grid over `bounds` from a parent's child list.
+     * @param bounds The parent's rect; children are clipped to it.
+     * @param children The children in z-order.
+     * @param trackable Predicate telling whether a child reports its own moves.
+     */
+    template <typename Trackable>
+    void build(const RectType& bounds,
+               std::span<const std::shared_ptr<IWidget>> children,
+               Trackable&& trackable) {
+        clear();
+        bounds_ = bounds;
+
+        // Size the grid for ~TARGET_PER_CELL children per cell, keeping cells roughly square.
+        double cellCount = std::clamp(static_cast<double>(children.size()) / TARGET_PER_CELL,
+                                      1.0, static_cast<double>(MAX_CELLS));
+        double aspect = bounds.h > 0 ? static_cast<double>(bounds.w) / bounds.h : 1.0;
+        cols_ = std::clamp(static_cast<uint32_t>(std::sqrt(cellCount * aspect)), 1u, std::max(bounds.w, 1u));
+        rows_ = std::clamp(static_cast<uint32_t>(cellCount / cols_), 1u, std::max(bounds.h, 1u));
+        cellW_ = std::max(1u, (bounds.w + cols_ - 1) / cols_);
+        cellH_ = std::max(1u, (bounds.h + rows_ - 1) / rows_);
+        cells_.resize(static_cast<size_t>(cols_) * rows_);
+
+        for (size_t i = 0; i < children.size(); ++i) {
+            IWidget* child = children[i].get();
+            Entry entry{child, static_cast<uint32_t>(i)};
+            if (trackable(child)) {
+                insert(entry, child->getRect());
+            } else {
+                overflow_.push_back(entry);
+                ++size_;
+            }
+        }
+    }
+
+    /** @brief Drops all entries and cells. */
+    void clear() noexcept {
+        cells_.clear();
+        overflow_.clear();
+        offGrid_.clear();
+        cols_ = rows_ = 0;
+        size_ = 0;
+    }
+
+    /** @brief Adds a child with the given z-order. */
+    void insert(IWidget* widget, uint32_t order, const RectType& rect) {
+        insert(Entry{widget, order}, rect);
+    }
+
+    /**
+     * @brief Moves a child from `oldRect` to `newRect`.
+     * @return `false` if the child was not found where expected (caller should rebuild).
+     */
+    bool update(IWidget* widget, const RectType& oldRect, const RectType& newRect) {
+        Entry entry;
+        if (!remove(widget, oldRect, entry)) return false;
+        insert(entry, newRect);
+        return true;
+    }
+
+    [[nodiscard]] const RectType& getBounds() const noexcept { return bounds_; }
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] size_t getCellCount() const noexcept { return cells_.size(); }
+
+    /**
+     * @brief Finds the top-most child under `point`, delegating to each candidate's `hitTest`.
+     * @return The hit descendant, or nullptr if no child was hit.
+     */
+    [[nodiscard]] IWidget* hitTest(const Point<int32_t>& point) const {
+        auto& arena = core::FrameArena::forCurrentThread();
+        core::FrameArena::Scope scope(arena);
+        core::ArenaVector<Entry> candidates{core::ArenaAllocator<Entry>(arena)};
+
+        auto collect = [&](const std::vector<Entry>& entries) {
+            for (const auto& entry : entries) {
+                if (containsPoint(entry.widget->getRect(), point)) {
+                    candidates.push_back(entry);
+                }
+            }
+        };
+
+        if (!cells_.empty() && containsPoint(bounds_, point)) {
+            uint32_t col = std::min(static_cast<uint32_t>(point.x - bounds_.x) / cellW_, cols_ - 1);
+            uint32_t row = std::min(static_cast<uint32_t>(point.y - bounds_.y) / cellH_, rows_ - 1);
+            collect(cells_[static_cast<size_t>(row) * cols_ + col]);
+        }
+        collect(overflow_);
+
+        // Top-most first, matching the reverse scan of the unindexed path.
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const Entry& a, const Entry& b) { return a.order > b.order; });
+        for (const auto& entry : candidates) {
+            if (auto* result = entry.widget->hitTest(point)) {
+                return result;
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    [[nodiscard]] static bool containsPoint(const RectType& rect, const Point<int32_t>& point) noexcept {
+        return point.x >= rect.x && static_cast<int64_t>(point.x) < static_cast<int64_t>(rect.x) + rect.w &&
+               point.y >= rect.y && static_cast<int64_t>(point.y) < static_cast<int64_t>(rect.y) + rect.h;
+    }
+
+    /**
+     * @brief Computes the cells a rect overlaps.
+     * @return `false` if the rect misses the grid entirely.
+     */
+    [[nodiscard]] bool cellRange(const RectType& rect, CellRange& range) const noexcept {
+        if (cells_.empty() || rect.w == 0 || rect.h == 0) return false;
+
+        int64_t left = std::max<int64_t>(rect.x, bounds_.x);
+        int64_t top = std::max<int64_t>(rect.y, bounds_.y);
+        int64_t right = std::min<int64_t>(static_cast<int64_t>(rect.x) + rect.w,
+                                          static_cast<int64_t>(bounds_.x) + bounds_.w);
+        int64_t bottom = std::min<int64_t>(static_cast<int64_t>(rect.y) + rect.h,
+                                           static_cast<int64_t>(bounds_.y) + bounds_.h);
+        if (left >= right || top >= bottom) return false;
+
+        range.c0 = static_cast<uint32_t>((left - bounds_.x) / cellW_);
+        range.r0 = static_cast<uint32_t>((top - bounds_.y) / cellH_);
+        range.c1 = std::min(static_cast<uint32_t>((right - 1 - bounds_.x) / cellW_), cols_ - 1);
+        range.r1 = std::min(static_cast<uint32_t>((bottom - 1 - bounds_.y) / cellH_), rows_ - 1);
+        return true;
+    }
+
+    void insert(const Entry& entry, const RectType& rect) {
+        ++size_;
+        CellRange range;
+        if (!cellRange(rect, range)) {
+            offGrid_.push_back(entry);          // Cannot be hit through this parent.
+            return;
+        }
+
+        if (range.count() > MAX_CELLS_PER_ENTRY) {
+            overflow_.push_back(entry);
+            return;
+        }
+        for (uint32_t r = range.r0; r <= range.r1; ++r) {
+            for (uint32_t c = range.c0; c <= range.c1; ++c) {
+                cells_[static_cast<size_t>(r) * cols_ + c].push_back(entry);
+            }
+        }
+    }
+
+    bool remove(IWidget* widget, const RectType& rect, Entry& removed) {
+        auto eraseFrom = [&](std::vector<Entry>& entries) {
+            auto it = std::find_if(entries.begin(), entries.end(),
+                                   [widget](const Entry& e) { return e.widget == widget; });
+            if (it == entries.end()) return false;
+            removed = *it;
+            *it = entries.back();
+            entries.pop_back();
+            return true;
+        };
+
+        CellRange range;
+        bool found = false;
+        if (!cellRange(rect, range)) {
+            found = eraseFrom(offGrid_);
+        } else if (range.count() > MAX_CELLS_PER_ENTRY) {
+            found = eraseFrom(overflow_);
+        } else {
+            for (uint32_t r = range.r0; r <= range.r1; ++r) {
+                for (uint32_t c = range.c0; c <= range.c1; ++c) {
+                    found |= eraseFrom(cells_[static_cast<size_t>(r) * cols_ + c]);
+                }
+            }
+        }
+        if (found) --size_;
+        return found;
+    }
+};
+
+} // namespace frqs::widget
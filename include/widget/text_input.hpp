@@ -29,6 +29,9 @@ namespace frqs::widget {
  */
 class TextInput : public Widget {
 public:
+    static constexpr WidgetKind KIND = WidgetKind::TextInput;
+    using KindOwner = TextInput;
+
     /**
      * @brief Callback function type invoked whenever the text content changes.
      * @param text The new text content of the input field.
@@ -180,6 +183,11 @@ private:
      * @return True if the event was handled.
      */
     bool handleKeyEvent(const event::KeyEvent& evt);
+
+    /**
+     * @brief Applies a focus change delivered by the window's focus manager.
+     */
+    void applyFocus(bool focus);
     
     /**
      * @brief Moves the cursor left or right.
@@ -9,8 +9,11 @@
  */
 
 #include "core/application.hpp"
+#include "core/frame_arena.hpp"
+#include "event/event_bus.hpp"
 #include "platform/win32_safe.hpp"
-#include <thread> // For std::this_thread::sleep_for
+#include <algorithm>
+#include <thread>
 
 namespace frqs::core {
 
@@ -28,10 +31,52 @@ namespace frqs::core {
 struct Application::Impl {
     /** @brief The native instance handle for the application (e.g., HINSTANCE on Windows). */
     platform::NativeInstance hInstance = nullptr;
-    /** @brief The target frames per second for the render loop. 0 means unlimited. */
-    uint32_t targetFps = 60;
+    /** @brief Paces busy frames at the target frames per second (0 means unlimited). */
+    FramePacer pacer{60};
     /** @brief The time point of the last rendered frame, used for FPS limiting. */
     std::chrono::steady_clock::time_point lastFrameTime;
+    /** @brief Reused window snapshot for per-frame iteration (avoids reallocating every frame). */
+    std::vector<std::shared_ptr<Window>> windowScratch;
+    /** @brief The UI thread's timers, advanced once per loop iteration. */
+    TimerWheel timers;
+    /** @brief The thread running the loop (the creating thread until `run()`). */
+    std::thread::id uiThread = std::this_thread::get_id();
+    /** @brief Latest-value channels delivered once per frame. */
+    std::vector<std::shared_ptr<platform::UpdateChannelBase>> updateChannels;
+    /** @brief The native message source the loop dispatches from and sleeps on. */
+    std::unique_ptr<platform::EventLoopBackend> backend = platform::createNativeEventLoopBackend();
+    /** @brief Stop the loop once the last window is closed. */
+    bool quitOnLastWindowClosed = true;
+    /** @brief Set by `requestAnimationFrame()`, consumed when the loop decides how long to sleep. */
+    bool frameRequested = false;
+    /** @brief Loop iteration and sleep counters. */
+    MainLoopStats loopStats;
+
+    /**
+     * @struct TickerEntry
+     * @brief A registered frame ticker; removal during a tick only marks it.
+     */
+    struct TickerEntry {
+        FrameTickerId id = 0;
+        FrameTicker ticker;
+        std::optional<WindowId> window;     ///< Kept at full rate while the ticker asks for frames.
+        bool removed = false;
+    };
+    /** @brief Tickers run by the animate phase, in registration order. */
+    std::vector<TickerEntry> frameTickers;
+    /** @brief Tickers added while `frameTickers` is being run; they join after the phase. */
+    std::vector<TickerEntry> addedTickers;
+    /** @brief The id handed to the next ticker. */
+    FrameTickerId nextTickerId = 1;
+    /** @brief `true` while the animate phase runs the tickers. */
+    bool ticking = false;
+
+    /** @brief Called after each phase of the frame pipeline. */
+    FramePhaseHook phaseHook;
+    /** @brief Duration of each phase over recent passes. */
+    std::array<LatencyHistogram, FRAME_PHASE_COUNT> phaseTimes;
+    /** @brief The earliest time a window wants to paint damage its frame-rate policy held back. */
+    std::optional<std::chrono::steady_clock::time_point> paintRetryAt;
 
     /**
      * @brief Construct a new Impl object and get the module handle.
@@ -46,9 +91,21 @@ struct Application::Impl {
 // CONSTRUCTOR / DESTRUCTOR
 // ============================================================================
 
-Application::Application() : pImpl_(std::make_unique<Impl>()) {}
+Application::Application() : pImpl_(std::make_unique<Impl>()) {
+    // An idle loop sleeps in the backend: posted tasks and deferred bus
+    // events must break that wait, not just the scheduler's own.
+    taskScheduler_.getWakeSignal().setWakeHandler([this] { pImpl_->backend->wake(); });
+    event::getGlobalEventBus().setDeferredWakeHandler([this] {
+        // Pairs with the fence in waitForWork(): the ring's relaxed publish
+        // becomes part of the WakeSignal handshake.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        taskScheduler_.getWakeSignal().notify();
+    });
+}
 
-Application::~Application() noexcept = default;
+Application::~Application() noexcept {
+    event::getGlobalEventBus().setDeferredWakeHandler(nullptr);
+}
 
 // ============================================================================
 // LIFECYCLE MANAGEMENT
@@ -61,16 +118,32 @@ void Application::initialize() {
 }
 
 void Application::run() {
-    if (running_) {
+    if (running_.exchange(true)) {
         return; // Already running
     }
-    running_ = true;
+    pImpl_->uiThread = std::this_thread::get_id();
     runMainLoop();
 }
 
 void Application::quit() noexcept {
-    // This simply sets the flag. The runMainLoop will detect this and exit.
-    running_ = false;
+    // This simply sets the flag. The runMainLoop will detect this and exit;
+    // if it sleeps, the notification wakes it (the flag is its publication).
+    running_.store(false, std::memory_order_seq_cst);
+    taskScheduler_.getWakeSignal().notify();
+}
+
+void Application::setQuitOnLastWindowClosed(bool quit) noexcept {
+    pImpl_->quitOnLastWindowClosed = quit;
+}
+
+void Application::setEventLoopBackend(std::unique_ptr<platform::EventLoopBackend> backend) {
+    if (backend) {
+        pImpl_->backend = std::move(backend);
+    }
+}
+
+platform::EventLoopBackend& Application::getEventLoopBackend() noexcept {
+    return *pImpl_->backend;
 }
 
 // ============================================================================
@@ -99,49 +172,92 @@ void Application::closeAllWindows() {
     WindowRegistry::instance().clear();
 }
 
+// ============================================================================
+// WORKER THREAD COMMUNICATION
+// ============================================================================
+
+void Application::attachUpdateChannel(std::shared_ptr<platform::UpdateChannelBase> channel) {
+    if (!channel) return;
+    auto& channels = pImpl_->updateChannels;
+    if (std::find(channels.begin(), channels.end(), channel) != channels.end()) return;
+
+    // An empty task is a doorbell: it ends the loop's sleep and is skipped when drained.
+    channel->setPendingCallback([this] { taskScheduler_.post(platform::UiTask{}, TaskLane::Critical); });
+    channels.push_back(std::move(channel));
+}
+
+void Application::postAt(platform::UiTask task, TimerWheel::Clock::time_point deadline) {
+    if (isUiThread()) {
+        pImpl_->timers.scheduleAt(deadline, std::move(task));
+        return;
+    }
+    // The wheel belongs to the UI thread: hand the timer over. The deadline
+    // was fixed by the caller, so the hop does not lengthen the delay.
+    postToUiThread([this, deadline, task = std::move(task)]() mutable {
+        pImpl_->timers.scheduleAt(deadline, std::move(task));
+    }, TaskLane::Critical);
+}
+
+TimerWheel& Application::getTimers() noexcept {
+    return pImpl_->timers;
+}
+
+bool Application::isUiThread() const noexcept {
+    return std::this_thread::get_id() == pImpl_->uiThread;
+}
+
+void Application::detachUpdateChannel(const std::shared_ptr<platform::UpdateChannelBase>& channel) {
+    auto& channels = pImpl_->updateChannels;
+    if (std::erase(channels, channel) == 0) return;
+
+    // The doorbell captures `this`: a channel outliving the application must not ring it.
+    channel->setPendingCallback({});
+}
+
 // ============================================================================
 // EVENT LOOP CONTROL
 // ============================================================================
 
 void Application::processPendingTasks() {
-    // Execute all tasks currently in the queue from worker threads.
-    taskQueue_.processAll([](platform::UiTask&& task) {
-        if (task) {
-            task();
-        }
-    });
+    // Critical tasks in full, the other lanes within the frame budget.
+    taskScheduler_.runFrame();
+}
+
+size_t Application::deliverUpdates() {
+    size_t delivered = 0;
+    // Index loop: a handler may attach another channel.
+    auto& channels = pImpl_->updateChannels;
+    for (size_t i = 0; i < channels.size(); ++i) {
+        std::shared_ptr<platform::UpdateChannelBase> channel = channels[i];
+        delivered += channel->deliverPending();
+    }
+    return delivered;
 }
 
 bool Application::pollEvents() {
-    processWindowMessages();
-    processPendingTasks();
+    pImpl_->pacer.beginFrame(std::chrono::steady_clock::now());
+    runFrame();
+
+    // Same as the main loop: the frame's scratch memory ends with the frame.
+    FrameArena::forCurrentThread().reset();
     return isRunning();
 }
 
 /**
- * @brief Processes the Windows message queue for the current thread.
+ * @brief Processes the native message queue for the current thread.
  * @internal
  *
- * This function retrieves and dispatches messages (e.g., mouse, keyboard, paint)
- * to the appropriate window procedures. It also checks for the WM_QUIT message
- * to terminate the application loop.
+ * The backend retrieves and dispatches messages (e.g., mouse, keyboard, paint)
+ * to the appropriate window procedures. A quit request (WM_QUIT on Windows)
+ * terminates the application loop.
+ * @return `false` if a quit request was received.
  */
-void Application::processWindowMessages() {
-    platform::NativeMessage msg;
-    // PM_REMOVE pulls messages from the queue.
-    while (PeekMessageW(&msg, nullptr, 0, 0, PM_REMOVE)) {
-        if (msg.message == WM_QUIT) {
-            // A WM_QUIT message signals that the application should terminate.
-            // This is typically posted when the last window is closed.
-            running_ = false;
-            return;
-        }
-        
-        // Translates virtual-key messages into character messages.
-        TranslateMessage(&msg);
-        // Dispatches the message to a window's procedure.
-        DispatchMessageW(&msg);
+bool Application::processWindowMessages() {
+    if (!pImpl_->backend->dispatchMessages()) {
+        running_ = false;
+        return false;
     }
+    return true;
 }
 
 // ============================================================================
@@ -149,12 +265,14 @@ void Application::processWindowMessages() {
 // ============================================================================
 
 void Application::requestRender() {
-    auto windows = WindowRegistry::instance().getAllWindows();
+    auto& windows = pImpl_->windowScratch;
+    WindowRegistry::instance().getAllWindows(windows);
     for (auto& window : windows) {
         if (window && window->isVisible()) {
             window->invalidate(); // Mark the window as needing a redraw.
         }
     }
+    windows.clear(); // Drop references, keep capacity.
 }
 
 void Application::requestRender(WindowId id) {
@@ -164,32 +282,113 @@ void Application::requestRender(WindowId id) {
 }
 
 void Application::setTargetFps(uint32_t fps) noexcept {
-    pImpl_->targetFps = fps;
+    pImpl_->pacer.setTargetFps(fps);
 }
 
 uint32_t Application::getTargetFps() const noexcept {
-    return pImpl_->targetFps;
+    return pImpl_->pacer.getTargetFps();
+}
+
+FramePacer& Application::getFramePacer() noexcept {
+    return pImpl_->pacer;
+}
+
+void Application::requestAnimationFrame() noexcept {
+    pImpl_->frameRequested = true;
+}
+
+FrameTickerId Application::addFrameTicker(FrameTicker ticker, std::optional<WindowId> window) {
+    auto& impl = *pImpl_;
+    FrameTickerId id = impl.nextTickerId++;
+    // Tickers must not be added to the vector being iterated.
+    auto& target = impl.ticking ? impl.addedTickers : impl.frameTickers;
+    target.push_back({id, std::move(ticker), window});
+    // Its first tick should not wait for unrelated work.
+    impl.frameRequested = true;
+    return id;
+}
+
+void Application::removeFrameTicker(FrameTickerId id) noexcept {
+    auto& impl = *pImpl_;
+    auto matches = [id](const Impl::TickerEntry& entry) { return entry.id == id; };
+    std::erase_if(impl.addedTickers, matches);
+    if (impl.ticking) {
+        // The ticker may be the one running: only mark it, the phase drops it.
+        for (auto& entry : impl.frameTickers) {
+            if (entry.id == id) {
+                entry.removed = true;
+            }
+        }
+        return;
+    }
+    std::erase_if(impl.frameTickers, matches);
+}
+
+void Application::setFramePhaseHook(FramePhaseHook hook) {
+    pImpl_->phaseHook = std::move(hook);
+}
+
+const LatencyHistogram& Application::getFramePhaseTimes(FramePhase phase) const noexcept {
+    return pImpl_->phaseTimes[static_cast<size_t>(phase)];
+}
+
+MainLoopStats Application::getLoopStats() const noexcept {
+    return pImpl_->loopStats;
+}
+
+void Application::resetLoopStats() noexcept {
+    pImpl_->loopStats = MainLoopStats{};
+    for (auto& times : pImpl_->phaseTimes) {
+        times.reset();
+    }
 }
 
 /**
- * @brief Renders all visible windows that require redrawing.
+ * @brief Dispatches the mouse move each window coalesced during this pass.
  * @internal
- *
- * This function iterates through all registered windows and calls their
- * rendering logic if they are visible and have been marked as dirty.
- * NOTE: In the current implementation, rendering is primarily driven by
- * the OS WM_PAINT message, but this function allows for forced, immediate
-*  updates needed for smooth animations.
  */
-void Application::renderWindows() {
-    auto windows = WindowRegistry::instance().getAllWindows();
+void Application::flushWindowInput() {
+    auto& windows = pImpl_->windowScratch;
+    WindowRegistry::instance().getAllWindows(windows);
     for (auto& window : windows) {
-        if (window && window->isVisible()) {
-            // Calling forceRedraw bypasses the usual invalidation and WM_PAINT
-            // cycle, rendering the window's content immediately.
-            window->forceRedraw();
+        if (window) {
+            window->flushPendingInput();
+        }
+    }
+    windows.clear(); // Drop references, keep capacity.
+}
+
+/**
+ * @brief Runs every frame ticker, then schedules another frame if one asked for it.
+ * @internal
+ */
+void Application::tickAnimations(FramePacer::Clock::time_point frameTime) {
+    auto& impl = *pImpl_;
+    if (impl.frameTickers.empty()) return;
+
+    bool another = false;
+    impl.ticking = true;
+    for (auto& entry : impl.frameTickers) {
+        if (!entry.removed && entry.ticker(frameTime)) {
+            another = true;
+            if (entry.window) {
+                if (auto window = getWindow(*entry.window)) {
+                    window->requestAnimationFrame();
+                }
+            }
         }
     }
+    impl.ticking = false;
+
+    std::erase_if(impl.frameTickers, [](const Impl::TickerEntry& entry) { return entry.removed; });
+    for (auto& entry : impl.addedTickers) {
+        impl.frameTickers.push_back(std::move(entry));
+    }
+    impl.addedTickers.clear();
+
+    if (another) {
+        impl.frameRequested = true;
+    }
 }
 
 // ============================================================================
@@ -201,83 +400,197 @@ void Application::renderWindows() {
  * @internal
  *
  * This loop continues as long as `running_` is true. In each iteration, it:
- * 1. Processes system messages (input, paint, etc.).
- * 2. Executes tasks posted from other threads.
- * 3. Checks if it should terminate (e.g., if all windows are closed).
- * 4. Enforces a frame rate limit to control CPU usage.
+ * 1. Runs one frame of the pipeline (see `runFrame`).
+ * 2. Checks if it should terminate (e.g., if all windows are closed).
+ * 3. Sleeps until there is something to do (see `waitForWork`).
  */
 void Application::runMainLoop() {
     using namespace std::chrono;
     
     while (running_) {
         auto frameStart = steady_clock::now();
-        
-        auto frameDuration = pImpl_->targetFps > 0
-            ? duration_cast<milliseconds>(seconds(1)) / pImpl_->targetFps
-            : milliseconds(0);
-
-        // Process Windows messages (MUST be first to handle input and OS events).
-        processWindowMessages();
-
-        // If processWindowMessages received WM_QUIT, exit immediately.
-        if (!running_) break;
-
-        // Process UI tasks posted from worker threads.
-        processPendingTasks();
+        ++pImpl_->loopStats.iterations;
+        pImpl_->pacer.beginFrame(frameStart);
 
-        // In a non-WM_PAINT driven model, you would render here.
-        // For now, renderWindows() is called explicitly where needed.
-        // renderWindows();
+        runFrame();
 
         // The application automatically quits when the last window is closed.
-        if (WindowRegistry::instance().getWindowCount() == 0) {
+        if (running_ && pImpl_->quitOnLastWindowClosed && WindowRegistry::instance().getWindowCount() == 0) {
             quit();
             break;
         }
 
-        // Frame rate limiting to avoid burning CPU cycles.
-        if (pImpl_->targetFps > 0) {
-            auto frameEnd = steady_clock::now();
-            auto frameTime = duration_cast<milliseconds>(frameEnd - frameStart);
-            
-            if (frameTime < frameDuration) {
-                auto sleepTime = frameDuration - frameTime;
-                std::this_thread::sleep_for(sleepTime);
-            }
-        } else {
-             // Yield the CPU for a moment if FPS is unlimited to be a good citizen.
-             std::this_thread::sleep_for(milliseconds(1));
+        pImpl_->lastFrameTime = frameStart;
+
+        // Release all per-frame scratch memory (layout temporaries, etc.).
+        FrameArena::forCurrentThread().reset();
+
+        waitForWork(frameStart);
+    }
+}
+
+/**
+ * @brief Runs one frame: every phase once, in a fixed order.
+ * @internal
+ *
+ * 1. Input: native messages (input, OS paints, etc.), then each window's
+ *    coalesced mouse move.
+ * 2. Tasks: tasks posted from other threads, the latest values of update
+ *    channels, due timers, and deferred bus events.
+ * 3. Animate: frame tickers, at the pacer's frame time.
+ * 4. Layout: every container that requested a layout, once, parents first.
+ * 5. Paint: each window draws the regions invalidated by the phases above.
+ * 6. Present: the drawn frames are shown.
+ *
+ * Everything that changes the tree runs before layout, and layout before
+ * paint, so however many changes a frame makes, no container is laid out
+ * and no window is painted more than once (an OS paint request during
+ * input consumes the invalidations it drew). Each phase is timed into
+ * `getFramePhaseTimes()` and reported to the phase hook.
+ */
+void Application::runFrame() {
+    using namespace std::chrono;
+    auto& impl = *pImpl_;
+
+    auto phaseStart = steady_clock::now();
+    auto endPhase = [&](FramePhase phase) {
+        auto now = steady_clock::now();
+        auto duration = duration_cast<nanoseconds>(now - phaseStart);
+        impl.phaseTimes[static_cast<size_t>(phase)].record(duration);
+        if (impl.phaseHook) {
+            impl.phaseHook(phase, phaseStart, duration);
         }
+        phaseStart = now;
+    };
 
-        pImpl_->lastFrameTime = frameStart;
+    // Process Windows messages (MUST be first to handle input and OS events).
+    // If processWindowMessages received WM_QUIT, exit immediately.
+    if (!processWindowMessages()) return;
+
+    // Deliver this frame's coalesced mouse move.
+    flushWindowInput();
+    endPhase(FramePhase::Input);
+
+    // Process UI tasks posted from worker threads.
+    processPendingTasks();
+    // Hand the UI the newest value of each key of every update channel.
+    deliverUpdates();
+    // Fire the timers that are due (caret blink, tooltips, postDelayed...).
+    impl.timers.advance();
+    // Deliver events worker threads published with publishDeferred, in one batch.
+    event::getGlobalEventBus().drainDeferred();
+    endPhase(FramePhase::Tasks);
+
+    tickAnimations(impl.pacer.getFrameTime());
+    endPhase(FramePhase::Animate);
+
+    // One snapshot for the rest of the frame: a window that painted must present.
+    auto& windows = impl.windowScratch;
+    WindowRegistry::instance().getAllWindows(windows);
+
+    for (auto& window : windows) {
+        if (window) {
+            impl.loopStats.layouts += window->runLayoutPass();
+        }
+    }
+    endPhase(FramePhase::Layout);
+
+    // Each window paints at the rate of its policy; held-back damage brings the loop back.
+    auto frameTime = impl.pacer.getFrameTime();
+    impl.paintRetryAt.reset();
+    for (auto& window : windows) {
+        if (!window) continue;
+        if (window->paint(frameTime)) {
+            ++impl.loopStats.paints;
+        } else if (auto retry = window->getNextPaintTime(); retry && (!impl.paintRetryAt || *retry < *impl.paintRetryAt)) {
+            impl.paintRetryAt = retry;
+        }
+    }
+    endPhase(FramePhase::Paint);
+
+    for (auto& window : windows) {
+        if (window) {
+            window->present();
+        }
     }
+    endPhase(FramePhase::Present);
+
+    windows.clear(); // Drop references, keep capacity.
 }
 
-// ============================================================================
-// DELAYED TASK (Template Implementation)
-// ============================================================================
+/**
+ * @brief Blocks the UI thread until the next iteration has something to do.
+ * @internal
+ *
+ * One combined wait covers every source of work: native messages and the
+ * wake event (backend), posted tasks and deferred bus events (WakeSignal
+ * handshake), `quit()`, the nearest timer deadline, and the next paint of a
+ * window whose frame-rate policy held damage back. Only when work is
+ * left over (tasks carried past the frame budget, or a requested animation
+ * frame) is the sleep also capped at the next frame deadline of the
+ * `FramePacer`, finished by a short spin. An idle application therefore
+ * does not wake at all.
+ */
+void Application::waitForWork(std::chrono::steady_clock::time_point frameStart) {
+    using namespace std::chrono;
+    auto& impl = *pImpl_;
+    if (!running_) return;      // quit() from a task or handler of this pass
+
+    bool busy = std::exchange(impl.frameRequested, false) || taskScheduler_.hasPending();
+
+    // Work left over runs at the next frame deadline. Sleep to just before it
+    // and spin the rest, unless a timer is due first.
+    std::optional<steady_clock::time_point> frameDeadline;
+    std::optional<steady_clock::time_point> wakeAt;
+    if (busy) {
+        frameDeadline = impl.pacer.scheduleNextFrame(frameStart);
+        // Unlimited FPS still yields the CPU for a moment to be a good citizen.
+        wakeAt = frameDeadline ? impl.pacer.getSleepUntil(*frameDeadline) : frameStart + milliseconds(1);
+    } else {
+        impl.pacer.stop();
+    }
+    impl.backend->setHighResolutionTiming(frameDeadline.has_value());
+
+    bool sleepsToFrame = frameDeadline.has_value();
+    for (auto deadline : {impl.timers.getNextDeadline(), impl.paintRetryAt}) {
+        if (deadline && (!wakeAt || *deadline < *wakeAt)) {
+            wakeAt = *deadline;
+            sleepsToFrame = false;
+        }
+    }
 
-template <typename Rep, typename Period>
-void Application::postDelayed(
-    platform::UiTask task,
-    const std::chrono::duration<Rep, Period>& delay
-) {
-    // TODO: Implement a proper delayed execution mechanism, possibly with
-    // a priority queue of timed events processed in the main loop.
-    // For now, we just post it immediately.
-    (void)delay; // Mark delay as unused for now.
-    postToUiThread(std::move(task));
-}
-
-// Explicit template instantiations are required for template definitions in a .cpp file.
-template void Application::postDelayed(
-    platform::UiTask,
-    const std::chrono::milliseconds&
-);
-
-template void Application::postDelayed(
-    platform::UiTask,
-    const std::chrono::seconds&
-);
+    std::optional<nanoseconds> timeout;
+    if (wakeAt) {
+        timeout = duration_cast<nanoseconds>(*wakeAt - steady_clock::now());
+        if (*timeout <= nanoseconds(0)) {
+            // Already due (e.g. the frame ran into the spin margin).
+            if (sleepsToFrame) {
+                impl.pacer.spinUntil(*frameDeadline);
+            }
+            return;
+        }
+    }
+
+    if (busy) {
+        ++impl.loopStats.frameWaits;
+    } else {
+        ++impl.loopStats.idleWaits;
+    }
+
+    auto& bus = event::getGlobalEventBus();
+    bool woken = taskScheduler_.getWakeSignal().waitUsing(
+        [&] {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return !running_.load(std::memory_order_seq_cst)
+                || taskScheduler_.hasNewTasks()
+                || bus.getDeferredPendingCount() > 0;
+        },
+        [&] { return impl.backend->waitForMessages(timeout); });
+    if (woken) {
+        ++impl.loopStats.wakeups;
+    } else if (sleepsToFrame) {
+        impl.pacer.finishWait(*frameDeadline);
+    }
+}
 
 } // namespace frqs::core
\ No newline at end of file
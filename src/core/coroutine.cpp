@@ -0,0 +1,165 @@
+/**
+ * @file coroutine.cpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Implementation of coroutine hops, spawning and cancellation.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "core/coroutine.hpp"
+#include "core/application.hpp"
+#include "platform/thread_pool.hpp"
+#include <mutex>
+
+namespace frqs::core {
+
+namespace {
+
+std::mutex g_handlerMutex;
+TaskExceptionHandler g_exceptionHandler;     ///< Empty: rethrow on the UI thread.
+
+} // anonymous namespace
+
+// ============================================================================
+// SPAWN
+// ============================================================================
+
+void spawn(Task<void> task, CancellationToken token) {
+    if (!task) return;
+
+    auto handle = std::exchange(task.handle_, nullptr);
+    auto& promise = handle.promise();
+    promise.detached = true;
+    promise.token = std::move(token);
+
+    if (promise.token.isCancelled()) {
+        handle.destroy();
+        return;
+    }
+    handle.resume();
+}
+
+void setTaskExceptionHandler(TaskExceptionHandler handler) {
+    std::lock_guard lock(g_handlerMutex);
+    g_exceptionHandler = std::move(handler);
+}
+
+namespace detail {
+
+// ============================================================================
+// EXCEPTIONS
+// ============================================================================
+
+void reportDetachedException(std::exception_ptr error) noexcept {
+    TaskExceptionHandler handler;
+    {
+        std::lock_guard lock(g_handlerMutex);
+        handler = g_exceptionHandler;
+    }
+
+    try {
+        if (handler) {
+            handler(error);
+        } else {
+            Application::instance().postToUiThread(
+                [error] { std::rethrow_exception(error); }, TaskLane::Critical);
+        }
+    } catch (...) {
+        // A handler that throws (or a post that cannot allocate) has nowhere
+        // left to report to; the frame is freed either way.
+    }
+}
+
+// ============================================================================
+// RESUMPTION
+// ============================================================================
+
+namespace {
+
+/**
+ * @brief Destroys the chain `promise` belongs to, if `spawn()` owns it.
+ * @return `false` if the root is owned by a `Task` object, which frees it.
+ */
+bool destroyChain(TaskPromiseBase& promise) noexcept {
+    // Every frame of the chain is owned by the one awaiting it, so destroying
+    // the spawned root unwinds all of them, innermost locals included.
+    TaskPromiseBase* root = &promise;
+    while (root->parent) {
+        root = root->parent;
+    }
+    if (!root->detached) return false;
+    root->self.destroy();
+    return true;
+}
+
+/**
+ * @class ResumeTask
+ * @brief The queued half of a hop: resumes once, or destroys the chain if dropped.
+ */
+class ResumeTask {
+private:
+    std::coroutine_handle<> handle_;
+    TaskPromiseBase* promise_;
+
+public:
+    ResumeTask(std::coroutine_handle<> handle, TaskPromiseBase& promise) noexcept
+        : handle_(handle), promise_(&promise) {}
+
+    ResumeTask(ResumeTask&& other) noexcept
+        : handle_(std::exchange(other.handle_, nullptr)), promise_(other.promise_) {}
+
+    ResumeTask(const ResumeTask&) = delete;
+    ResumeTask& operator=(const ResumeTask&) = delete;
+    ResumeTask& operator=(ResumeTask&&) = delete;
+
+    ~ResumeTask() {
+        if (handle_) {
+            destroyChain(*promise_);
+        }
+    }
+
+    void operator()() noexcept {
+        resumeOrCancel(std::exchange(handle_, nullptr), *promise_);
+    }
+};
+
+} // anonymous namespace
+
+void resumeOrCancel(std::coroutine_handle<> handle, TaskPromiseBase& promise) noexcept {
+    if (!promise.token.isCancelled()) {
+        handle.resume();
+        return;
+    }
+
+    if (!destroyChain(promise)) {
+        handle.resume();    // Not owned by spawn(): whoever owns the root decides
+    }
+}
+
+platform::UniqueTask makeResumeTask(std::coroutine_handle<> handle, TaskPromiseBase& promise) {
+    return platform::UniqueTask(ResumeTask(handle, promise));
+}
+
+// ============================================================================
+// HOPS
+// ============================================================================
+
+void postResumeToUi(std::coroutine_handle<> handle, TaskPromiseBase& promise, TaskLane lane) {
+    Application::instance().postToUiThread(makeResumeTask(handle, promise), lane);
+}
+
+void postResumeToPool(std::coroutine_handle<> handle, TaskPromiseBase& promise) {
+    platform::postToThreadPool(makeResumeTask(handle, promise));
+}
+
+void postResumeDelayed(std::coroutine_handle<> handle, TaskPromiseBase& promise,
+                       std::chrono::milliseconds delay) {
+    Application::instance().postDelayed(makeResumeTask(handle, promise), delay);
+}
+
+} // namespace detail
+
+} // namespace frqs::core
@@ -0,0 +1,149 @@
+/**
+ * @file event_replay.cpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Implementation of input trace replay.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "core/event_replay.hpp"
+#include "core/window_registry.hpp"
+#include "event/event_dispatcher.hpp"
+#include "event/event_payload.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <unordered_map>
+
+namespace frqs::core {
+
+namespace {
+
+/**
+ * @brief Stamps an event with this process's current input time.
+ * @details Recorded timestamps come from the recording session's clock: passed
+ *          on, they would show up as bogus input latencies and hover times.
+ */
+void restamp(event::Event& event) noexcept {
+    uint64_t now = event::eventTimestampNow();
+    std::visit([now](auto& evt) {
+        if constexpr (requires { evt.timestamp; }) {
+            evt.timestamp = now;
+        }
+    }, event);
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// REPLAY REPORT
+// ============================================================================
+
+double ReplayReport::getPercentile(double percentile) const {
+    if (frameTimesMs.empty()) return 0.0;
+
+    std::vector<double> sorted = frameTimesMs;
+    std::sort(sorted.begin(), sorted.end());
+    double clamped = std::clamp(percentile, 0.0, 100.0);
+    auto rank = static_cast<size_t>(std::ceil(clamped / 100.0 * static_cast<double>(sorted.size())));
+    return sorted[rank == 0 ? 0 : rank - 1];
+}
+
+// ============================================================================
+// REPLAY
+// ============================================================================
+
+ReplayReport replayTrace(const event::EventTrace& trace, const ReplayOptions& options) {
+    using clock = std::chrono::steady_clock;
+
+    ReplayReport report;
+    auto records = trace.getRecords();
+    if (records.empty()) return report;
+
+    auto resolve = options.resolveWindow;
+    if (!resolve) {
+        resolve = [](uint64_t id) { return WindowRegistry::instance().getWindow(WindowId{id}).value_or(nullptr); };
+    }
+
+    // Resolve each recorded id once; the windows are kept alive for the whole replay.
+    std::unordered_map<uint64_t, std::shared_ptr<Window>> windows;
+    std::vector<Window*> touched;
+
+    auto interval = static_cast<uint64_t>(std::max<int64_t>(options.frameInterval.count(), 1));
+    report.frameTimesMs.reserve(static_cast<size_t>(trace.getDuration() / interval) + 1);
+
+    auto replayStart = clock::now();
+    size_t next = 0;
+    while (next < records.size()) {
+        // The frame covers the trace time up to the end of the interval holding the next record.
+        uint64_t frameEnd = (records[next].time / interval + 1) * interval;
+
+        if (options.speed == ReplaySpeed::RealTime) {
+            std::this_thread::sleep_until(replayStart + std::chrono::nanoseconds(frameEnd));
+        }
+
+        auto frameStart = clock::now();
+        touched.clear();
+        for (; next < records.size() && records[next].time < frameEnd; ++next) {
+            const auto& record = records[next];
+
+            auto [it, inserted] = windows.try_emplace(record.windowId);
+            if (inserted) {
+                it->second = resolve(record.windowId);
+            }
+            Window* window = it->second.get();
+            if (!window) {
+                ++report.eventsSkipped;
+                continue;
+            }
+
+            event::Event replayed = record.event;
+            restamp(replayed);
+            if (auto* drop = std::get_if<event::FileDropEvent>(&replayed)) {
+                // Give the drop its paths back for the duration of the dispatch.
+                auto files = trace.getFiles(record);
+                event::ScopedPayload payload(
+                    event::PayloadArena::instance().storeFiles({files.begin(), files.end()}));
+                drop->payload = payload.get();
+                window->dispatchEvent(replayed);
+            } else {
+                window->dispatchEvent(replayed);
+            }
+            ++report.eventsDispatched;
+
+            if (std::find(touched.begin(), touched.end(), window) == touched.end()) {
+                touched.push_back(window);
+            }
+        }
+
+        // End of frame: what the application loop does once per iteration.
+        // The frame time follows the trace, so reduced rates keep the recorded pacing.
+        auto frameTime = replayStart + std::chrono::nanoseconds(frameEnd);
+        for (Window* window : touched) {
+            window->flushPendingInput();
+            if (!options.render) {
+                window->flushInvalidations();
+            } else if (window->paint(frameTime)) {
+                window->present();
+            }
+        }
+
+        report.frameTimesMs.push_back(
+            std::chrono::duration<double, std::milli>(clock::now() - frameStart).count());
+    }
+
+    report.totalMs = std::chrono::duration<double, std::milli>(clock::now() - replayStart).count();
+    return report;
+}
+
+ReplayReport replayTrace(const event::EventTrace& trace, Window& window, ReplayOptions options) {
+    // Non-owning: the caller keeps `window` alive for the duration of the call.
+    std::shared_ptr<Window> target(std::shared_ptr<Window>{}, &window);
+    options.resolveWindow = [target](uint64_t) { return target; };
+    return replayTrace(trace, options);
+}
+
+} // namespace frqs::core
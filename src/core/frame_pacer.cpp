@@ -0,0 +1,148 @@
+/**
+ * @file frame_pacer.cpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Implementation of deadline-based frame pacing.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "core/frame_pacer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace frqs::core {
+
+namespace {
+
+using namespace std::chrono_literals;
+
+/** @brief The shortest spin margin; below it the yield loop cannot react in time anyway. */
+constexpr FramePacer::Clock::duration MIN_SPIN_MARGIN = 250us;
+/** @brief The longest spin margin, whatever the OS oversleeps by. */
+constexpr FramePacer::Clock::duration MAX_SPIN_MARGIN = 4ms;
+
+} // anonymous namespace
+
+// ============================================================================
+// CONFIGURATION
+// ============================================================================
+
+void FramePacer::setTargetFps(uint32_t fps) noexcept {
+    targetFps_ = fps;
+    period_ = fps > 0
+        ? std::chrono::duration_cast<Clock::duration>(std::chrono::seconds(1)) / fps
+        : Clock::duration::zero();
+    stop();
+}
+
+// ============================================================================
+// LOOP INTERFACE
+// ============================================================================
+
+void FramePacer::beginFrame(Clock::time_point now) noexcept {
+    frameTime_ = now;
+    if (!deadline_ || now < *deadline_) return;
+
+    // Skip the periods already gone rather than rushing through them, so the
+    // schedule keeps its phase and the animation clock never runs fast.
+    auto skipped = static_cast<uint64_t>((now - *deadline_) / period_);
+    frameTime_ = *deadline_ + period_ * skipped;
+    deadline_ = frameTime_ + period_;
+    stats_.missedFrames += skipped;
+    ++stats_.frames;
+
+    if (lastFrame_) {
+        recordInterval(now - *lastFrame_);
+    }
+    lastFrame_ = now;
+}
+
+std::optional<FramePacer::Clock::time_point> FramePacer::scheduleNextFrame(Clock::time_point frameStart) noexcept {
+    if (period_ == Clock::duration::zero()) return std::nullopt;
+
+    if (!deadline_) {
+        // First frame of a burst: it anchors the schedule.
+        deadline_ = frameStart + period_;
+        lastFrame_ = frameStart;
+    }
+    return deadline_;
+}
+
+void FramePacer::finishWait(Clock::time_point deadline, Clock::time_point woke) noexcept {
+    // Track a slowly decaying maximum of the oversleep, and keep the margin
+    // just above it: enough to never wake past the deadline, no more.
+    auto oversleep = std::max(woke - getSleepUntil(deadline), Clock::duration::zero());
+    oversleep_ = std::max(oversleep, oversleep_ - oversleep_ / 16);
+    stats_.maxOversleep = std::max(stats_.maxOversleep,
+                                   std::chrono::duration_cast<std::chrono::nanoseconds>(oversleep));
+    auto maxMargin = std::min<Clock::duration>(MAX_SPIN_MARGIN, period_ / 2);
+    spinMargin_ = std::clamp<Clock::duration>(oversleep_ + MIN_SPIN_MARGIN, MIN_SPIN_MARGIN,
+                                              std::max(maxMargin, MIN_SPIN_MARGIN));
+
+    spinUntil(deadline);
+}
+
+void FramePacer::spinUntil(Clock::time_point deadline) noexcept {
+    if (Clock::now() >= deadline) return;
+
+    ++stats_.spins;
+    while (Clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+}
+
+void FramePacer::stop() noexcept {
+    deadline_.reset();
+    lastFrame_.reset();
+}
+
+// ============================================================================
+// METRICS
+// ============================================================================
+
+void FramePacer::recordInterval(Clock::duration interval) noexcept {
+    intervals_[intervalNext_] = std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count();
+    intervalNext_ = (intervalNext_ + 1) % HISTORY_SIZE;
+    intervalCount_ = std::min(intervalCount_ + 1, HISTORY_SIZE);
+}
+
+FramePacingStats FramePacer::getStats() const noexcept {
+    FramePacingStats stats = stats_;
+    stats.spinMargin = std::chrono::duration_cast<std::chrono::nanoseconds>(spinMargin_);
+    return stats;
+}
+
+std::chrono::nanoseconds FramePacer::getIntervalPercentile(double percentile) const noexcept {
+    if (intervalCount_ == 0) return std::chrono::nanoseconds(0);
+
+    // Nearest-rank percentile over a copy, so recording stays O(1).
+    std::array<int64_t, HISTORY_SIZE> sorted;
+    std::copy_n(intervals_.begin(), intervalCount_, sorted.begin());
+    double clamped = std::clamp(percentile, 0.0, 100.0);
+    auto rank = static_cast<size_t>(std::ceil(clamped / 100.0 * static_cast<double>(intervalCount_)));
+    size_t index = rank > 0 ? rank - 1 : 0;
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.begin() + intervalCount_);
+    return std::chrono::nanoseconds(sorted[index]);
+}
+
+std::chrono::nanoseconds FramePacer::getMeanInterval() const noexcept {
+    if (intervalCount_ == 0) return std::chrono::nanoseconds(0);
+
+    int64_t sum = 0;
+    for (size_t i = 0; i < intervalCount_; ++i) {
+        sum += intervals_[i];
+    }
+    return std::chrono::nanoseconds(sum / static_cast<int64_t>(intervalCount_));
+}
+
+void FramePacer::resetStats() noexcept {
+    stats_ = FramePacingStats{};
+    intervalCount_ = 0;
+    intervalNext_ = 0;
+}
+
+} // namespace frqs::core
@@ -0,0 +1,80 @@
+/**
+ * @file frame_throttle.cpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Implementation of the per-window frame-rate throttle.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "core/frame_throttle.hpp"
+
+namespace frqs::core {
+
+namespace {
+
+using namespace std::chrono_literals;
+
+/**
+ * @brief How early a frame may come and still count as on schedule.
+ * @details Loop deadlines are rounded to the clock tick, so four 60 fps
+ *          periods can end a few nanoseconds before one 15 fps period.
+ */
+constexpr FrameThrottle::Clock::duration EARLY_TOLERANCE = 1ms;
+
+} // anonymous namespace
+
+bool FrameThrottle::admit(FrameRateTier tier, Clock::time_point frameTime) noexcept {
+    tier_ = tier;
+    retryAt_.reset();
+
+    uint32_t fps = 0;
+    switch (tier) {
+    case FrameRateTier::Hidden:
+        ++stats_.hidden;
+        nextPaint_.reset();
+        return false;
+    case FrameRateTier::Occluded:
+        // Uncovering sends no message under composition: look again later.
+        ++stats_.occluded;
+        nextPaint_.reset();
+        retryAt_ = frameTime + policy_.occlusionProbe;
+        return false;
+    case FrameRateTier::Full:
+        fps = policy_.focusedFps;
+        break;
+    case FrameRateTier::Reduced:
+        fps = policy_.backgroundFps;
+        break;
+    }
+
+    if (fps == 0) {
+        nextPaint_.reset();
+        return true;
+    }
+
+    auto period = std::chrono::duration_cast<Clock::duration>(std::chrono::seconds(1)) / fps;
+    if (nextPaint_ && frameTime + EARLY_TOLERANCE < *nextPaint_) {
+        ++stats_.throttled;
+        retryAt_ = nextPaint_;
+        return false;
+    }
+
+    // Keep the schedule's phase unless a whole period was missed (e.g. no damage for a while).
+    bool onSchedule = nextPaint_ && frameTime - *nextPaint_ < period;
+    nextPaint_ = onSchedule ? *nextPaint_ + period : frameTime + period;
+    return true;
+}
+
+void FrameThrottle::notePresented() noexcept {
+    ++stats_.presented;
+    if (tier_ == FrameRateTier::Reduced) {
+        ++stats_.reducedRate;
+    } else {
+        ++stats_.fullRate;
+    }
+}
+
+} // namespace frqs::core
@@ -0,0 +1,130 @@
+/**
+ * @file latency_monitor.cpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Implementation of input-to-present latency histograms.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "core/latency_monitor.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace frqs::core {
+
+// ============================================================================
+// LATENCY HISTOGRAM
+// ============================================================================
+
+/**
+ * @brief Maps a duration to its bucket: octave from the leading bit, step from the next two bits.
+ */
+size_t LatencyHistogram::bucketFor(uint64_t ns) noexcept {
+    uint64_t us = ns / 1000;
+    if (us < 1) return 0;
+
+    auto octave = static_cast<size_t>(std::bit_width(us) - 1);
+    size_t step = octave >= 2 ? static_cast<size_t>((us >> (octave - 2)) & 0x3)
+                              : static_cast<size_t>((us << (2 - octave)) & 0x3);
+    return std::min(octave * SUB_BUCKETS + step, BUCKET_COUNT - 1);
+}
+
+std::chrono::nanoseconds LatencyHistogram::getBucketUpperBound(size_t bucket) noexcept {
+    size_t octave = bucket / SUB_BUCKETS;
+    size_t step = bucket % SUB_BUCKETS;
+    // Octave o spans [2^o, 2^(o+1)) µs in four equal steps.
+    double us = std::ldexp(1.0 + static_cast<double>(step + 1) / SUB_BUCKETS, static_cast<int>(octave));
+    return std::chrono::nanoseconds(static_cast<int64_t>(us * 1000.0));
+}
+
+void LatencyHistogram::record(std::chrono::nanoseconds latency) noexcept {
+    auto ns = static_cast<uint64_t>(std::max<int64_t>(latency.count(), 0));
+    ++buckets_[bucketFor(ns)];
+    ++count_;
+    sumNs_ += ns;
+    minNs_ = std::min(minNs_, ns);
+    maxNs_ = std::max(maxNs_, ns);
+}
+
+void LatencyHistogram::reset() noexcept {
+    buckets_.fill(0);
+    count_ = 0;
+    sumNs_ = 0;
+    minNs_ = UINT64_MAX;
+    maxNs_ = 0;
+}
+
+std::chrono::nanoseconds LatencyHistogram::getMin() const noexcept {
+    return std::chrono::nanoseconds(count_ ? minNs_ : 0);
+}
+
+std::chrono::nanoseconds LatencyHistogram::getMean() const noexcept {
+    return std::chrono::nanoseconds(count_ ? sumNs_ / count_ : 0);
+}
+
+std::chrono::nanoseconds LatencyHistogram::getPercentile(double percentile) const noexcept {
+    if (count_ == 0) return std::chrono::nanoseconds(0);
+
+    double clamped = std::clamp(percentile, 0.0, 100.0);
+    auto target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped / 100.0 * static_cast<double>(count_))));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += buckets_[i];
+        if (seen >= target) {
+            // Never report beyond what was actually observed.
+            return std::min(getBucketUpperBound(i), getMax());
+        }
+    }
+    return getMax();
+}
+
+// ============================================================================
+// LATENCY MONITOR
+// ============================================================================
+
+void LatencyMonitor::notePending(size_t eventIndex, uint64_t timestamp) noexcept {
+    if (eventIndex >= EVENT_TYPE_COUNT || timestamp == 0) return;
+    uint64_t& pending = pending_[eventIndex];
+    if (pending == 0 || timestamp < pending) {
+        pending = timestamp;
+    }
+    hasPending_ = true;
+}
+
+void LatencyMonitor::notePresented(uint64_t presentTimestamp) {
+    if (!hasPending_) return;
+    hasPending_ = false;
+
+    for (size_t i = 0; i < EVENT_TYPE_COUNT; ++i) {
+        uint64_t origin = pending_[i];
+        if (origin == 0) continue;
+        pending_[i] = 0;
+
+        auto latency = std::chrono::nanoseconds(presentTimestamp > origin ? presentTimestamp - origin : 0);
+        histograms_[i].record(latency);
+        if (latency > budget_) {
+            ++overBudgetCount_;
+            if (overBudget_) {
+                overBudget_(LatencySample{.eventIndex = i, .latency = latency});
+            }
+        }
+    }
+}
+
+void LatencyMonitor::setBudget(std::chrono::nanoseconds budget, BudgetCallback callback) {
+    budget_ = budget;
+    overBudget_ = std::move(callback);
+}
+
+void LatencyMonitor::reset() noexcept {
+    for (auto& histogram : histograms_) {
+        histogram.reset();
+    }
+    overBudgetCount_ = 0;
+}
+
+} // namespace frqs::core
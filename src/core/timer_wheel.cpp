@@ -0,0 +1,362 @@
+/**
+ * @file timer_wheel.cpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Implementation of the hierarchical timer wheel and debounce/throttle helpers.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "core/timer_wheel.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace frqs::core {
+
+namespace {
+
+constexpr uint64_t SLOT_MASK = TimerWheel::SLOTS - 1;
+
+/** @brief Ticks covered by one turn of the top level (2^24 ms, about 4.6 hours). */
+constexpr uint64_t WHEEL_SPAN = uint64_t{1} << (TimerWheel::LEVELS * TimerWheel::SLOT_BITS);
+
+/** @brief Gets the digit of `tick` at `level` (its slot on that level). */
+constexpr size_t digitOf(uint64_t tick, size_t level) noexcept {
+    return static_cast<size_t>((tick >> (level * TimerWheel::SLOT_BITS)) & SLOT_MASK);
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// CONSTRUCTION
+// ============================================================================
+
+TimerWheel::TimerWheel(Clock::time_point start) : epoch_(start) {
+    for (auto& level : heads_) {
+        level.fill(NIL);
+    }
+}
+
+uint64_t TimerWheel::toTick(Clock::time_point time, bool roundUp) const noexcept {
+    if (time <= epoch_) return 0;
+    auto elapsed = time - epoch_;
+    auto ms = roundUp ? std::chrono::ceil<std::chrono::milliseconds>(elapsed)
+                      : std::chrono::floor<std::chrono::milliseconds>(elapsed);
+    return static_cast<uint64_t>(ms.count());
+}
+
+// ============================================================================
+// NODE POOL
+// ============================================================================
+
+uint32_t TimerWheel::allocate() {
+    if (freeHead_ != NIL) {
+        uint32_t index = freeHead_;
+        freeHead_ = nodes_[index].next;
+        return index;
+    }
+    nodes_.emplace_back();
+    return static_cast<uint32_t>(nodes_.size() - 1);
+}
+
+void TimerWheel::release(uint32_t index) noexcept {
+    Node& node = nodes_[index];
+    node.task.reset();
+    node.state = State::Free;
+    if (++node.generation == 0) {
+        node.generation = 1;        // Keep ids non-zero
+    }
+    node.prev = NIL;
+    node.next = freeHead_;
+    freeHead_ = index;
+}
+
+TimerWheel::Node* TimerWheel::resolve(TimerId id) noexcept {
+    auto index = static_cast<uint32_t>(id & 0xFFFFFFFFu);
+    auto generation = static_cast<uint32_t>(id >> 32);
+    if (index >= nodes_.size()) return nullptr;
+    Node& node = nodes_[index];
+    return node.generation == generation && node.state != State::Free ? &node : nullptr;
+}
+
+const TimerWheel::Node* TimerWheel::resolve(TimerId id) const noexcept {
+    return const_cast<TimerWheel*>(this)->resolve(id);
+}
+
+// ============================================================================
+// SLOT LISTS
+// ============================================================================
+
+/**
+ * @brief Puts an armed node in the slot matching its expiry.
+ *
+ * The level is where the expiry's highest bit differing from `now_` lies, so
+ * the node's slot is reached before it expires and it moves down one or more
+ * levels each time. A node expiring at `now_` (only while cascading) goes to
+ * the current level-0 slot, which fires right after.
+ */
+void TimerWheel::link(uint32_t index) noexcept {
+    Node& node = nodes_[index];
+
+    size_t level = 0;
+    size_t slot = digitOf(node.expiry, 0);
+    if (uint64_t diff = node.expiry ^ now_; diff != 0) {
+        level = static_cast<size_t>(std::bit_width(diff) - 1) / SLOT_BITS;
+        if (level < LEVELS) {
+            slot = digitOf(node.expiry, level);
+        } else {
+            // The expiry is in a later turn of the top level. Within one turn
+            // its own top slot comes round in time; beyond that, park it in
+            // the top slot reached last and re-place it from there.
+            level = LEVELS - 1;
+            slot = node.expiry - now_ < WHEEL_SPAN ? digitOf(node.expiry, level)
+                                                   : (digitOf(now_, level) + SLOTS - 1) & SLOT_MASK;
+        }
+    }
+
+    node.level = static_cast<uint8_t>(level);
+    node.slot = static_cast<uint8_t>(slot);
+    node.prev = NIL;
+    node.next = heads_[level][slot];
+    if (node.next != NIL) {
+        nodes_[node.next].prev = index;
+    }
+    heads_[level][slot] = index;
+    occupied_[level] |= uint64_t{1} << slot;
+}
+
+void TimerWheel::unlink(uint32_t index) noexcept {
+    Node& node = nodes_[index];
+    if (node.prev != NIL) {
+        nodes_[node.prev].next = node.next;
+    } else {
+        heads_[node.level][node.slot] = node.next;
+        if (node.next == NIL) {
+            occupied_[node.level] &= ~(uint64_t{1} << node.slot);
+        }
+    }
+    if (node.next != NIL) {
+        nodes_[node.next].prev = node.prev;
+    }
+    node.prev = NIL;
+    node.next = NIL;
+}
+
+uint32_t TimerWheel::popSlot(size_t level, size_t slot) noexcept {
+    uint32_t index = heads_[level][slot];
+    if (index != NIL) {
+        unlink(index);
+    }
+    return index;
+}
+
+// ============================================================================
+// SCHEDULING
+// ============================================================================
+
+TimerId TimerWheel::scheduleAt(Clock::time_point deadline, platform::UiTask task) {
+    uint32_t index = allocate();
+    Node& node = nodes_[index];
+    node.task = std::move(task);
+    node.expiry = std::max(toTick(deadline, true), now_ + 1);
+    node.period = 0;
+    node.state = State::Armed;
+    link(index);
+    ++armed_;
+    return makeId(index, node.generation);
+}
+
+TimerId TimerWheel::schedulePeriodicAt(Clock::time_point firstDeadline, Clock::duration interval,
+                                       platform::UiTask task) {
+    auto period = std::max<int64_t>(1, std::chrono::ceil<std::chrono::milliseconds>(interval).count());
+    TimerId id = scheduleAt(firstDeadline, std::move(task));
+    nodes_[static_cast<uint32_t>(id)].period = static_cast<uint64_t>(period);
+    return id;
+}
+
+bool TimerWheel::reschedule(TimerId id, Clock::time_point deadline) {
+    Node* node = resolve(id);
+    if (!node || node->state != State::Armed) return false;
+
+    auto index = static_cast<uint32_t>(id & 0xFFFFFFFFu);
+    unlink(index);
+    node->expiry = std::max(toTick(deadline, true), now_ + 1);
+    link(index);
+    return true;
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    Node* node = resolve(id);
+    if (!node) return false;
+
+    switch (node->state) {
+        case State::Armed:
+            unlink(static_cast<uint32_t>(id & 0xFFFFFFFFu));
+            release(static_cast<uint32_t>(id & 0xFFFFFFFFu));
+            --armed_;
+            return true;
+        case State::Running:
+            node->state = State::Cancelled;     // Freed once its task returns
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool TimerWheel::isPending(TimerId id) const noexcept {
+    const Node* node = resolve(id);
+    return node && (node->state == State::Armed || (node->state == State::Running && node->period != 0));
+}
+
+// ============================================================================
+// DRIVING THE WHEEL
+// ============================================================================
+
+/**
+ * @brief Gets the first tick after `now_` at which some occupied slot is reached.
+ */
+std::optional<uint64_t> TimerWheel::nextEventTick() const noexcept {
+    std::optional<uint64_t> earliest;
+    for (size_t level = 0; level < LEVELS; ++level) {
+        uint64_t bits = occupied_[level];
+        if (bits == 0) continue;
+
+        size_t shift = level * SLOT_BITS;
+        size_t blockShift = shift + SLOT_BITS;
+        size_t digit = digitOf(now_, level);
+        uint64_t ahead = digit + 1 < SLOTS ? bits & (~uint64_t{0} << (digit + 1)) : 0;
+
+        uint64_t block = now_ >> blockShift;
+        uint64_t slot;
+        if (ahead != 0) {
+            slot = static_cast<uint64_t>(std::countr_zero(ahead));
+        } else {
+            slot = static_cast<uint64_t>(std::countr_zero(bits));    // Wraps into the next block
+            ++block;
+        }
+        uint64_t tick = (block << blockShift) | (slot << shift);
+        if (!earliest || tick < *earliest) {
+            earliest = tick;
+        }
+    }
+    return earliest;
+}
+
+std::optional<TimerWheel::Clock::time_point> TimerWheel::getNextDeadline() const noexcept {
+    auto tick = nextEventTick();
+    if (!tick) return std::nullopt;
+    return epoch_ + std::chrono::milliseconds(static_cast<int64_t>(*tick));
+}
+
+size_t TimerWheel::advance(Clock::time_point now) {
+    uint64_t target = toTick(now, false);
+    size_t fired = 0;
+
+    while (auto tick = nextEventTick()) {
+        if (*tick > target) break;
+        now_ = *tick;
+
+        // Move timers down from every level whose slot starts at this tick,
+        // highest first, so they can keep falling within the same tick.
+        for (size_t level = LEVELS - 1; level > 0; --level) {
+            if ((now_ & ((uint64_t{1} << (level * SLOT_BITS)) - 1)) != 0) continue;
+            size_t slot = digitOf(now_, level);
+            while (true) {
+                uint32_t index = popSlot(level, slot);
+                if (index == NIL) break;
+                link(index);
+            }
+        }
+
+        fired += fireSlot(digitOf(now_, 0), target);
+    }
+
+    now_ = std::max(now_, target);
+    return fired;
+}
+
+size_t TimerWheel::fireSlot(size_t slot, uint64_t target) {
+    size_t fired = 0;
+    // Pop one at a time: a task may cancel or add timers, but never into this
+    // slot, since new expiries are always after now_.
+    while (true) {
+        uint32_t index = popSlot(0, slot);
+        if (index == NIL) break;
+
+        // Run a moved-out copy: the task may schedule timers and grow nodes_.
+        platform::UiTask task = std::move(nodes_[index].task);
+        nodes_[index].state = State::Running;
+        task();
+        ++fired;
+
+        Node& node = nodes_[index];
+        if (node.period != 0 && node.state == State::Running) {
+            node.task = std::move(task);
+            // Skip periods missed while the loop was blocked: up to the
+            // advance target, not just this slot, or a catch-up would run
+            // every missed period within this one call.
+            uint64_t missed = (target - node.expiry) / node.period + 1;
+            node.expiry += missed * node.period;
+            node.state = State::Armed;
+            link(index);
+        } else {
+            release(index);
+            --armed_;
+        }
+    }
+    return fired;
+}
+
+// ============================================================================
+// DEBOUNCER
+// ============================================================================
+
+void Debouncer::trigger(platform::UiTask task, TimerWheel::Clock::time_point now) {
+    pending_ = std::move(task);
+    auto deadline = now + delay_;
+    if (!wheel_.reschedule(timer_, deadline)) {
+        timer_ = wheel_.scheduleAt(deadline, [this] {
+            platform::UiTask task = std::move(pending_);
+            if (task) task();
+        });
+    }
+}
+
+void Debouncer::cancel() {
+    wheel_.cancel(timer_);
+    timer_ = INVALID_TIMER;
+    pending_.reset();
+}
+
+// ============================================================================
+// THROTTLER
+// ============================================================================
+
+void Throttler::trigger(platform::UiTask task, TimerWheel::Clock::time_point now) {
+    if (!wheel_.isPending(timer_) && (!lastRun_ || now - *lastRun_ >= interval_)) {
+        lastRun_ = now;
+        if (task) task();
+        return;
+    }
+
+    pending_ = std::move(task);
+    if (!wheel_.isPending(timer_)) {
+        timer_ = wheel_.scheduleAt(*lastRun_ + interval_, [this] { runPending(); });
+    }
+}
+
+void Throttler::runPending() {
+    *lastRun_ += interval_;     // When it was due, so the spacing does not drift with loop lateness
+    platform::UiTask task = std::move(pending_);
+    if (task) task();
+}
+
+void Throttler::cancel() {
+    wheel_.cancel(timer_);
+    timer_ = INVALID_TIMER;
+    pending_.reset();
+}
+
+} // namespace frqs::core
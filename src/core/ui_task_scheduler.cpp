@@ -0,0 +1,154 @@
+/**
+ * @file ui_task_scheduler.cpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Implementation of the budgeted, multi-lane UI task scheduler.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "core/ui_task_scheduler.hpp"
+#include <algorithm>
+
+namespace frqs::core {
+
+namespace {
+
+uint64_t nowNs() noexcept {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @brief Queued tasks of a lane. A task can run before its producer bumps
+ *        `posted`, so the difference is clamped at zero.
+ */
+size_t pendingOf(uint64_t posted, uint64_t executed) noexcept {
+    return posted > executed ? static_cast<size_t>(posted - executed) : 0;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// POSTING
+// ============================================================================
+
+void UiTaskScheduler::post(platform::UiTask task, TaskLane lane) {
+    Lane& target = lanes_[static_cast<size_t>(lane)];
+    target.queue.push(Entry{.task = std::move(task), .postedAt = nowNs()});
+    // seq_cst publication for the WakeSignal handshake; also the lane's depth counter.
+    target.posted.fetch_add(1, std::memory_order_seq_cst);
+    wake_.notify();
+}
+
+uint64_t UiTaskScheduler::getPostedTotal() const noexcept {
+    uint64_t total = 0;
+    for (const Lane& lane : lanes_) {
+        total += lane.posted.load(std::memory_order_seq_cst);
+    }
+    return total;
+}
+
+bool UiTaskScheduler::hasPending() const noexcept {
+    return std::ranges::any_of(lanes_, [](const Lane& lane) { return !lane.queue.isEmpty(); });
+}
+
+// ============================================================================
+// FRAME DRAIN
+// ============================================================================
+
+void UiTaskScheduler::runEntry(Lane& lane, Entry& entry, uint64_t now) {
+    ++lane.executed;
+    if (!entry.task) return;    // Empty tasks only wake the loop.
+
+    lane.wait.record(std::chrono::nanoseconds(now > entry.postedAt ? now - entry.postedAt : 0));
+    entry.task();
+}
+
+size_t UiTaskScheduler::runFrame() {
+    postedAtLastFrame_ = getPostedTotal();
+
+    uint64_t frameStart = nowNs();
+    for (Lane& lane : lanes_) {
+        lane.maxDepth = std::max(lane.maxDepth, pendingOf(lane.posted.load(std::memory_order_relaxed), lane.executed));
+    }
+
+    size_t ran = 0;
+
+    // 1. Critical: everything posted before now, whatever it costs.
+    Lane& critical = lanes_[static_cast<size_t>(TaskLane::Critical)];
+    ran += critical.queue.processAll([&](Entry&& entry) {
+        runEntry(critical, entry, frameStart);
+    });
+
+    // 2. Budgeted lanes in priority order. The budget includes the critical work.
+    uint64_t deadline = frameStart + static_cast<uint64_t>(std::max<int64_t>(frameBudget_.count(), 0));
+    uint64_t now = nowNs();
+    std::array<size_t, TASK_LANE_COUNT> ranInLane{};
+    for (size_t i = 1; i < TASK_LANE_COUNT && now < deadline; ++i) {
+        Lane& lane = lanes_[i];
+        // Bound the drain to the tasks present now, so a task that reposts
+        // itself cannot keep the lane busy for the rest of the budget.
+        size_t available = pendingOf(lane.posted.load(std::memory_order_acquire), lane.executed);
+        for (; available > 0 && now < deadline; --available) {
+            auto entry = lane.queue.tryPop();
+            if (!entry) break;
+            runEntry(lane, *entry, now);
+            ++ranInLane[i];
+            now = nowNs();
+        }
+    }
+
+    // 3. Starvation protection: once the budget is spent, every lane still
+    //    below its minimum makes progress anyway.
+    bool overBudget = now >= deadline;
+    for (size_t i = 1; i < TASK_LANE_COUNT; ++i) {
+        Lane& lane = lanes_[i];
+        for (size_t n = ranInLane[i]; overBudget && n < minTasksPerLane_; ++n) {
+            auto entry = lane.queue.tryPop();
+            if (!entry) break;
+            runEntry(lane, *entry, now);
+            ++lane.guaranteedRuns;
+            ++ranInLane[i];
+            now = nowNs();
+        }
+        ran += ranInLane[i];
+        if (!lane.queue.isEmpty()) {
+            ++lane.carriedFrames;
+        }
+    }
+
+    return ran;
+}
+
+// ============================================================================
+// METRICS
+// ============================================================================
+
+TaskLaneStats UiTaskScheduler::getLaneStats(TaskLane lane) const noexcept {
+    const Lane& source = lanes_[static_cast<size_t>(lane)];
+    uint64_t posted = source.posted.load(std::memory_order_relaxed);
+    return TaskLaneStats{
+        .posted = posted - source.postedBase,
+        .executed = source.executed - source.executedBase,
+        .depth = pendingOf(posted, source.executed),
+        .maxDepth = source.maxDepth,
+        .carriedFrames = source.carriedFrames,
+        .guaranteedRuns = source.guaranteedRuns
+    };
+}
+
+void UiTaskScheduler::resetStats() noexcept {
+    for (Lane& lane : lanes_) {
+        lane.postedBase = lane.posted.load(std::memory_order_relaxed);
+        lane.executedBase = lane.executed;
+        lane.maxDepth = 0;
+        lane.carriedFrames = 0;
+        lane.guaranteedRuns = 0;
+        lane.wait.reset();
+    }
+}
+
+} // namespace frqs::core
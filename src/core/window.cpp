@@ -12,8 +12,10 @@
  * (mostly Win32 API functions) to the `Window::Impl` struct.
  */
 
+#include "event/event_dispatcher.hpp"
 #include "widget/internal.hpp"
 #include "window_impl.hpp"
+#include "core/application.hpp"
 #include "core/window_registry.hpp"
 
 #ifdef _DEBUG
@@ -27,7 +29,7 @@ namespace frqs::platform {
 
 // Forward declaration of internal widget function to link widget to a window.
 namespace frqs::widget::internal {
-    void setWidgetWindowHandle(Widget* widget, void* hwnd);
+    void setWidgetInvalidationSink(Widget* widget, InvalidationSink* sink);
 }
 
 namespace frqs::core {
@@ -98,6 +100,11 @@ Window::~Window() noexcept {
     if (pImpl_->hwnd) {
         DestroyWindow(pImpl_->hwnd);
     }
+
+    // The widget tree may outlive this window; stop it from posting to a dead sink.
+    if (auto* rootAsWidget = widget::asWidget(pImpl_->rootWidget.get())) {
+        widget::internal::setWidgetInvalidationSink(rootAsWidget, nullptr);
+    }
 }
 
 // ============================================================================
@@ -339,14 +346,20 @@ void Window::close() noexcept {
 // ============================================================================
 
 void Window::setRootWidget(std::shared_ptr<widget::IWidget> root) {
+    pImpl_->hover.clear(pImpl_->lastMousePos, 0);
+    pImpl_->focus.clearFocus();
+    if (auto* oldRoot = widget::asWidget(pImpl_->rootWidget.get())) {
+        widget::internal::setWidgetInvalidationSink(oldRoot, nullptr);
+    }
+
     pImpl_->rootWidget = std::move(root);
     if (pImpl_->rootWidget) {
         // The root widget always occupies the entire client area of the window.
         pImpl_->rootWidget->setRect(getClientRect());
         
-        // Give the widget tree a handle to this window so it can post invalidation requests.
-        if (auto* rootAsWidget = dynamic_cast<widget::Widget*>(pImpl_->rootWidget.get())) {
-            widget::internal::setWidgetWindowHandle(rootAsWidget, pImpl_->hwnd);
+        // Attach the widget tree to this window's sink so it can post invalidation requests.
+        if (auto* rootAsWidget = widget::asWidget(pImpl_->rootWidget.get())) {
+            widget::internal::setWidgetInvalidationSink(rootAsWidget, pImpl_.get());
         }
         
         invalidate(); // Request a full repaint to draw the new widget.
@@ -362,29 +375,59 @@ std::shared_ptr<widget::IWidget> Window::getRootWidget() const noexcept {
 // ============================================================================
 
 void Window::invalidate() noexcept {
-    if (pImpl_->dirtyRects) {
-        pImpl_->dirtyRects->markFullRedraw();
-    }
+    // Deferred: coalesced with widget invalidations and flushed once per frame.
+    pImpl_->invalidateAll();
+}
+
+void Window::invalidateRect(const widget::Rect<int32_t, uint32_t>& rect) noexcept {
+    pImpl_->invalidateRect(rect);
+}
+
+void Window::flushInvalidations() noexcept {
     // InvalidateRect tells the OS that the window's contents are invalid
     // and a WM_PAINT message should be sent when the application is idle.
-    if (pImpl_->hwnd) {
-        InvalidateRect(pImpl_->hwnd, nullptr, FALSE);
-    }
+    pImpl_->flushInvalidations();
 }
 
-void Window::invalidateRect(const widget::Rect<int32_t, uint32_t>& rect) noexcept {
-    if (pImpl_->dirtyRects) {
-        pImpl_->dirtyRects->addDirtyRect(rect);
-    }
-    if (pImpl_->hwnd) {
-        RECT r = {
-            static_cast<LONG>(rect.x),
-            static_cast<LONG>(rect.y),
-            static_cast<LONG>(rect.getRight()),
-            static_cast<LONG>(rect.getBottom())
-        };
-        InvalidateRect(pImpl_->hwnd, &r, FALSE);
-    }
+size_t Window::runLayoutPass() {
+    return pImpl_->runLayoutPass();
+}
+
+bool Window::paint(std::chrono::steady_clock::time_point frameTime) {
+    return pImpl_->paintFrame(frameTime);
+}
+
+void Window::present() {
+    pImpl_->present();
+}
+
+std::optional<std::chrono::steady_clock::time_point> Window::getNextPaintTime() const noexcept {
+    return pImpl_->throttle.getRetryTime();
+}
+
+void Window::setFrameRatePolicy(const FrameRatePolicy& policy) noexcept {
+    pImpl_->throttle.setPolicy(policy);
+}
+
+const FrameRatePolicy& Window::getFrameRatePolicy() const noexcept {
+    return pImpl_->throttle.getPolicy();
+}
+
+void Window::requestAnimationFrame() noexcept {
+    pImpl_->animationRequested = true;
+    Application::instance().requestAnimationFrame();
+}
+
+FrameRateTier Window::getFrameRateTier() const noexcept {
+    return pImpl_->throttle.getTier();
+}
+
+const WindowFrameStats& Window::getFrameStats() const noexcept {
+    return pImpl_->throttle.getStats();
+}
+
+void Window::resetFrameStats() noexcept {
+    pImpl_->throttle.resetStats();
 }
 
 void Window::forceRedraw() noexcept {
@@ -395,10 +438,85 @@ void Window::forceRedraw() noexcept {
     }
 }
 
+void Window::setAutoDamage(bool enabled) noexcept {
+    if (pImpl_->autoDamage == enabled) return;
+    pImpl_->autoDamage = enabled;
+    if (!enabled) {
+        pImpl_->damageTracker.reset();
+    }
+    invalidate();
+}
+
+bool Window::isAutoDamageEnabled() const noexcept {
+    return pImpl_->autoDamage;
+}
+
 // ============================================================================
 // EVENT DISPATCH & UNSAFE BACKDOOR
 // ============================================================================
 
+/**
+ * @brief Gets the creation time of the input behind an event, or 0 for non-input events.
+ * @details A coalesced move reports its oldest sample: that is when the user started waiting.
+ * @internal
+ */
+static uint64_t inputTimestamp(const event::Event& event) noexcept {
+    return std::visit([](const auto& evt) -> uint64_t {
+        using T = std::decay_t<decltype(evt)>;
+        if constexpr (std::is_same_v<T, event::MouseMoveEvent>) {
+            return evt.sampleCount > 0 ? evt.samples[0].timestamp : evt.timestamp;
+        } else if constexpr (requires { evt.timestamp; }) {
+            return evt.timestamp;
+        } else {
+            return 0;
+        }
+    }, event);
+}
+
+void Window::flushPendingInput() {
+    auto& impl = *pImpl_;
+    if (!impl.hasPendingMove) return;
+    
+    event::MouseMoveEvent move = impl.pendingMove;
+    impl.hasPendingMove = false;
+    
+    // Hand the samples to the event; moves queued during dispatch go to the other buffer.
+    impl.dispatchSamples.swap(impl.moveSamples);
+    move.samples = impl.dispatchSamples.data();
+    move.sampleCount = static_cast<uint32_t>(impl.dispatchSamples.size());
+    
+    dispatchEvent(event::Event(move));
+    impl.dispatchSamples.clear();
+}
+
+widget::IWidget* Window::getHoveredWidget() const noexcept {
+    return pImpl_->hover.getHovered();
+}
+
+bool Window::setFocusedWidget(widget::IWidget* widget) {
+    return pImpl_->focus.setFocus(pImpl_->rootWidget, widget);
+}
+
+widget::IWidget* Window::getFocusedWidget() const noexcept {
+    return pImpl_->focus.getFocused();
+}
+
+void Window::setEventRecorder(std::shared_ptr<event::EventRecorder> recorder) noexcept {
+    pImpl_->recorder = std::move(recorder);
+}
+
+std::shared_ptr<event::EventRecorder> Window::getEventRecorder() const noexcept {
+    return pImpl_->recorder;
+}
+
+LatencyMonitor& Window::getLatencyMonitor() noexcept {
+    return pImpl_->latency;
+}
+
+const LatencyMonitor& Window::getLatencyMonitor() const noexcept {
+    return pImpl_->latency;
+}
+
 void* Window::getNativeHandleUnsafe() const noexcept {
     return pImpl_->hwnd;
 }
@@ -406,25 +524,59 @@ void* Window::getNativeHandleUnsafe() const noexcept {
 void Window::dispatchEvent(const event::Event& event) {
     if (!pImpl_->rootWidget) return;
     
+    // A coalesced move still waiting for the frame must be seen before anything that follows it.
+    if (pImpl_->hasPendingMove && !std::holds_alternative<event::MouseMoveEvent>(event)) {
+        flushPendingInput();
+    }
+
+    if (pImpl_->recorder) {
+        pImpl_->recorder->record(id_.value, event);
+    }
+
+    // Any invalidation during routing means the event changes the next frame;
+    // its creation time is held until that frame is presented.
+    uint64_t epoch = pImpl_->treeEpoch;
+    routeEvent(event);
+    if (pImpl_->treeEpoch != epoch) {
+        if (uint64_t origin = inputTimestamp(event)) {
+            pImpl_->latency.notePending(event.index(), origin);
+        }
+    }
+}
+
+void Window::routeEvent(const event::Event& event) {
+    
     // --- MOUSE & FILE DROP EVENTS: Use hit-testing to find the target widget ---
     // Events with positional data are dispatched to the top-most widget under the cursor.
-    auto processPositionalEvent = [&](const widget::Point<int32_t>& pos) {
+    auto processPositionalEvent = [&](const widget::Point<int32_t>& pos, bool press = false) {
         auto* target = pImpl_->rootWidget->hitTest(pos);
+        if (press) {
+            // Click-to-focus: the pressed widget (or its nearest focusable ancestor)
+            // takes focus before it sees the press; clicking elsewhere clears it.
+            pImpl_->focus.focusFromPointer(pImpl_->rootWidget, target);
+        }
         if (target) {
             // Attempt to handle the event at the target. If it's not handled,
             // bubble the event up the widget hierarchy to its parents.
             for (auto* current = target; current != nullptr; current = current->getParent()) {
-                if (current->onEvent(event)) return;
+                if (current->wantsEvent(event) && current->onEvent(event)) return;
             }
         }
     };
 
     if (auto* mouseMove = std::get_if<event::MouseMoveEvent>(&event)) {
-        processPositionalEvent(mouseMove->position);
+        // The hover cache resolves the target (usually without a hit test) and
+        // delivers enter/leave transitions before the move itself.
+        auto* target = pImpl_->hover.update(pImpl_->rootWidget, mouseMove->position,
+                                            pImpl_->treeEpoch, mouseMove->timestamp);
+        for (auto* current = target; current != nullptr; current = current->getParent()) {
+            if (current->wantsEvent(event) && current->onEvent(event)) return;
+        }
         return;
     }
     if (auto* mouseButton = std::get_if<event::MouseButtonEvent>(&event)) {
-        processPositionalEvent(mouseButton->position);
+        processPositionalEvent(mouseButton->position,
+                               mouseButton->action == event::MouseButtonEvent::Action::Press);
         return;
     }
     if (auto* mouseWheel = std::get_if<event::MouseWheelEvent>(&event)) {
@@ -438,23 +590,25 @@ void Window::dispatchEvent(const event::Event& event) {
     
     // --- KEYBOARD EVENTS: Send to the focused widget ---
     if (std::holds_alternative<event::KeyEvent>(event)) {
-        // TODO: Implement proper focus management to find the correct target.
-        // For now, all keyboard events are sent to the root widget.
-        pImpl_->rootWidget->onEvent(event);
+        // Delivered to the focused widget and bubbled up its parents; no tree search.
+        pImpl_->focus.dispatchKey(pImpl_->rootWidget, event);
         return;
     }
     
     // --- WINDOW-WIDE EVENTS: Broadcast to the entire tree ---
     // Events like Resize or Paint apply to all widgets, so we broadcast them
-    // by calling onEvent on the root, which should then propagate to children.
+    // with broadcastToWidgetTree, which uses each subtree's event mask to skip
+    // the branches where no widget wants the event.
     if (std::holds_alternative<event::ResizeEvent>(event) ||
         std::holds_alternative<event::PaintEvent>(event)) {
-        pImpl_->rootWidget->onEvent(event);
+        event::broadcastToWidgetTree(pImpl_->rootWidget.get(), event);
         return;
     }
     
     // For any other event type, we just send it to the root as a default action.
-    pImpl_->rootWidget->onEvent(event);
+    if (pImpl_->rootWidget->wantsEvent(event)) {
+        pImpl_->rootWidget->onEvent(event);
+    }
 }
 
 } // namespace frqs::core
\ No newline at end of file
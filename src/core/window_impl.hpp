@@ -12,10 +12,22 @@
 #pragma once
 
 #include "core/window.hpp"
+#include "core/frame_throttle.hpp"
+#include "core/latency_monitor.hpp"
+#include "event/event_dispatcher.hpp"
+#include "event/event_trace.hpp"
 #include "platform/win32_safe.hpp"
 #include "render/dirty_rect.hpp"
+#include "render/display_list.hpp"
 #include "render/renderer_d2d.hpp"
+#include "widget/animation.hpp"
+#include "widget/focus_manager.hpp"
+#include "widget/hover_tracker.hpp"
+#include "widget/invalidation_sink.hpp"
+#include <algorithm>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace frqs::core {
 
@@ -32,8 +44,17 @@ namespace frqs::core {
  * these details from the public `window.hpp` header, we achieve a clean
  * separation of interface and implementation, reduce compile times, and
  * prevent platform-specific headers from leaking into client code.
+ *
+ * It is also the widget tree's `InvalidationSink`: widget invalidations are
+ * collected in `pendingInvalidations` and painted once per frame by
+ * `beginPaint()`/`present()` (or handed to the OS by `flushInvalidations()`
+ * when an external loop drives the window). Layout requests wait in
+ * `layoutQueue` for `runLayoutPass()`, which runs before every paint.
  */
-struct Window::Impl {
+struct Window::Impl final : widget::InvalidationSink {
+    /** @brief Fills the surface under the widget tree, in both paint paths. */
+    static constexpr widget::Color BACKGROUND_COLOR{240, 240, 245};
+
     // --- Platform and Rendering ---
     /** @brief The native handle to the window (e.g., HWND on Windows). */
     platform::NativeHandle hwnd = nullptr;
@@ -41,6 +62,20 @@ struct Window::Impl {
     std::unique_ptr<render::RendererD2D> renderer;
     /** @brief Manages the regions of the window that need to be redrawn. */
     std::unique_ptr<render::DirtyRectManager> dirtyRects;
+    /** @brief Invalidations requested since the last flush, already coalesced. */
+    std::unique_ptr<render::DirtyRectManager> pendingInvalidations;
+    /** @brief Advances on every flush; lets widgets drop duplicate requests within a frame. */
+    uint64_t invalidationGeneration = 0;
+    /** @brief Counts invalidation requests and tree changes; drops the hover cache when it moves. */
+    uint64_t treeEpoch = 0;
+    /** @brief Display lists used to derive damage when auto-damage is enabled. */
+    std::unique_ptr<render::DamageTracker> damageTracker;
+    /** @brief Widgets waiting for the next layout pass, in request order. */
+    std::vector<widget::Widget*> layoutQueue;
+    /** @brief The round of the layout pass being run, by tree depth (reused between passes). */
+    std::vector<std::pair<uint32_t, widget::Widget*>> layoutBatch;
+    /** @brief `true` between `beginPaint()` and `present()`. */
+    bool painting = false;
 
     // --- Window Properties ---
     /** @brief The text displayed in the window's title bar. */
@@ -53,6 +88,34 @@ struct Window::Impl {
     // --- Widget Hierarchy ---
     /** @brief The root widget of the UI hierarchy contained within this window. */
     std::shared_ptr<widget::IWidget> rootWidget;
+
+    // --- Pointer Input ---
+    /** @brief Cached hover path; skips hit tests while the cursor stays over the same leaf. */
+    widget::HoverTracker hover;
+    /** @brief The latest mouse move not yet dispatched (deltas accumulated). */
+    event::MouseMoveEvent pendingMove {};
+    /** @brief `true` if `pendingMove` holds a move waiting for the next frame. */
+    bool hasPendingMove = false;
+    /** @brief Raw samples folded into `pendingMove`, oldest first. */
+    std::vector<event::MouseMoveEvent> moveSamples;
+    /** @brief Samples of the move currently being dispatched (swapped with `moveSamples`). */
+    std::vector<event::MouseMoveEvent> dispatchSamples;
+    /** @brief Position of the last raw mouse move, used to compute deltas. */
+    widget::Point<int32_t> lastMousePos {0, 0};
+    /** @brief `true` once `TrackMouseEvent` has been armed for WM_MOUSELEAVE. */
+    bool trackingMouseLeave = false;
+
+    // --- Keyboard Input ---
+    /** @brief Owns keyboard focus; key events are delivered straight to the focused widget. */
+    widget::FocusManager focus;
+
+    // --- Diagnostics ---
+    /** @brief Records dispatched events for later replay; nullptr when not recording. */
+    std::shared_ptr<event::EventRecorder> recorder;
+    /** @brief Input-to-present latency; fed by `dispatchEvent` and closed out after each present. */
+    LatencyMonitor latency;
+    /** @brief Applies the frame-rate policy and counts this window's frames. */
+    FrameThrottle throttle;
     
     // --- State Flags ---
     /** @brief `true` if the window is currently visible. */
@@ -71,16 +134,190 @@ struct Window::Impl {
     bool closed = false;
     /** @brief `true` while the user is actively resizing or moving the window. */
     bool inSizeMove = false;
+    /** @brief `true` if damage is derived from display-list diffs instead of widget invalidations. */
+    bool autoDamage = false;
+    /** @brief Set by `requestAnimationFrame()`, consumed by the next loop frame. */
+    bool animationRequested = false;
 
-    Impl() = default;
-    ~Impl() noexcept = default;
+    Impl() {
+        moveSamples.reserve(32);
+        dispatchSamples.reserve(32);
+    }
+    ~Impl() noexcept override = default;
 
     /**
-     * @brief Initializes the dirty rectangle manager with the window's initial size.
+     * @brief Initializes the dirty rectangle managers with the window's initial size.
      */
     void initializeDirtyRects() {
         widget::Rect<int32_t, uint32_t> bounds(0, 0, size.w, size.h);
         dirtyRects = std::make_unique<render::DirtyRectManager>(bounds);
+        pendingInvalidations = std::make_unique<render::DirtyRectManager>(bounds);
+    }
+
+    // ========================================================================
+    // INVALIDATION SINK
+    // ========================================================================
+
+    void invalidateRect(const widget::Rect<int32_t, uint32_t>& rect) noexcept override {
+        ++treeEpoch;
+        if (pendingInvalidations) {
+            pendingInvalidations->addDirtyRect(rect);
+        }
+    }
+
+    void invalidateAll() noexcept override {
+        ++treeEpoch;
+        if (pendingInvalidations) {
+            pendingInvalidations->markFullRedraw();
+        }
+    }
+
+    void noteTreeChanged() noexcept override {
+        ++treeEpoch;
+    }
+
+    [[nodiscard]] uint64_t getGeneration() const noexcept override {
+        return invalidationGeneration;
+    }
+
+    void requestFocus(widget::IWidget* widget) override {
+        focus.setFocus(rootWidget, widget);
+    }
+
+    void releaseFocus(widget::IWidget* widget) override {
+        if (focus.getFocused() == widget) {
+            focus.clearFocus();
+        }
+    }
+
+    void requestLayout(widget::Widget* widget) override {
+        layoutQueue.push_back(widget);
+    }
+
+    void cancelLayout(widget::Widget* widget) noexcept override {
+        std::erase(layoutQueue, widget);
+        // Also a widget destroyed by a layout of the round in progress.
+        for (auto& entry : layoutBatch) {
+            if (entry.second == widget) {
+                entry.second = nullptr;
+            }
+        }
+    }
+
+    // ========================================================================
+    // LAYOUT PASS
+    // ========================================================================
+
+    /** @brief Rounds after which requests made by layouts themselves wait for the next frame. */
+    static constexpr int MAX_LAYOUT_ROUNDS = 8;
+
+    /**
+     * @brief Lays out every widget that requested it since the last pass.
+     *
+     * Each round runs the queued widgets shallowest first: a parent's layout
+     * resizes its children before they run, so a child queued by both its
+     * own change and its parent's layout still runs once. Requests made
+     * during a round (e.g. by a child that was not queued yet) form the next
+     * one. A layout cycle is cut after `MAX_LAYOUT_ROUNDS`.
+     *
+     * @return The number of layouts run.
+     */
+    size_t runLayoutPass() {
+        size_t laidOut = 0;
+        for (int round = 0; round < MAX_LAYOUT_ROUNDS && !layoutQueue.empty(); ++round) {
+            layoutBatch.clear();
+            for (auto* widget : layoutQueue) {
+                uint32_t depth = 0;
+                for (auto* parent = widget->getParent(); parent; parent = parent->getParent()) {
+                    ++depth;
+                }
+                layoutBatch.emplace_back(depth, widget);
+            }
+            layoutQueue.clear();
+            std::stable_sort(layoutBatch.begin(), layoutBatch.end(),
+                             [](const auto& a, const auto& b) { return a.first < b.first; });
+
+            // Index loop: a layout may cancel entries of this round.
+            for (size_t i = 0; i < layoutBatch.size(); ++i) {
+                if (auto* widget = layoutBatch[i].second) {
+                    widget->performLayout();
+                    ++laidOut;
+                }
+            }
+        }
+        layoutBatch.clear();
+        return laidOut;
+    }
+
+    /**
+     * @brief Moves pending invalidations into the frame's dirty rects and starts a new generation.
+     * @details With auto-damage, invalidations only say that the frame must be
+     *          recorded again; the damage itself comes from the display-list diff.
+     * @return `true` if anything was pending.
+     */
+    bool absorbPendingInvalidations() noexcept {
+        ++invalidationGeneration;
+        if (!pendingInvalidations || !pendingInvalidations->isDirty()) return false;
+
+        if (dirtyRects && !autoDamage) {
+            if (pendingInvalidations->needsFullRedraw()) {
+                dirtyRects->markFullRedraw();
+            } else {
+                for (const auto& rect : pendingInvalidations->getDirtyRects()) {
+                    dirtyRects->addDirtyRect(rect);
+                }
+            }
+        }
+        pendingInvalidations->clear();
+        return true;
+    }
+
+    /**
+     * @brief Issues one OS invalidation per coalesced region requested since the last flush.
+     */
+    void flushInvalidations() noexcept {
+        if (!pendingInvalidations || !pendingInvalidations->isDirty()) {
+            ++invalidationGeneration;
+            return;
+        }
+
+        if (hwnd) {
+            if (pendingInvalidations->needsFullRedraw()) {
+                InvalidateRect(hwnd, nullptr, FALSE);
+            } else {
+                for (const auto& rect : pendingInvalidations->getDirtyRects()) {
+                    RECT r = {
+                        static_cast<LONG>(rect.x),
+                        static_cast<LONG>(rect.y),
+                        static_cast<LONG>(rect.getRight()),
+                        static_cast<LONG>(rect.getBottom())
+                    };
+                    InvalidateRect(hwnd, &r, FALSE);
+                }
+            }
+        }
+        absorbPendingInvalidations();
+    }
+
+    // ========================================================================
+    // MOUSE MOVE COALESCING
+    // ========================================================================
+
+    /**
+     * @brief Folds a raw mouse move into the pending one; dispatched once per frame.
+     */
+    void queueMouseMove(const event::MouseMoveEvent& evt) {
+        moveSamples.push_back(evt);
+        if (!hasPendingMove) {
+            pendingMove = evt;
+            hasPendingMove = true;
+            return;
+        }
+        pendingMove.position = evt.position;
+        pendingMove.delta = widget::Point<int32_t>(pendingMove.delta.x + evt.delta.x,
+                                                   pendingMove.delta.y + evt.delta.y);
+        pendingMove.modifiers = evt.modifiers;
+        pendingMove.timestamp = evt.timestamp;
     }
 
     /**
@@ -102,10 +339,13 @@ struct Window::Impl {
      * @brief Updates the bounds of the renderer and dirty rect manager when the window is resized.
      */
     void updateDirtyRectBounds() {
+        widget::Rect<int32_t, uint32_t> bounds(0, 0, size.w, size.h);
         if (dirtyRects) {
-            widget::Rect<int32_t, uint32_t> bounds(0, 0, size.w, size.h);
             dirtyRects->setBounds(bounds);
         }
+        if (pendingInvalidations) {
+            pendingInvalidations->setBounds(bounds);
+        }
         
         // Resize the renderer's device-dependent resources to match the new window size.
         if (renderer) {
@@ -125,6 +365,11 @@ struct Window::Impl {
 
         size = widget::Size<uint32_t>(newWidth, newHeight);
         updateDirtyRectBounds();
+
+        // The resized surface keeps none of the old frame that a diff could build on.
+        if (damageTracker) {
+            damageTracker->reset();
+        }
         
         // The root widget always fills the entire client area.
         if (rootWidget) {
@@ -139,33 +384,154 @@ struct Window::Impl {
     }
     
     /**
-     * @brief Renders the window's content.
+     * @brief Renders the window's content immediately (WM_PAINT, resize, `forceRedraw`).
+     * @details The whole surface is drawn even if nothing was invalidated:
+     *          the OS asks for it because the previous contents are gone.
+     */
+    void render() {
+        if (beginPaint(true)) {
+            present();
+        }
+    }
+
+    /**
+     * @brief Paints the frame of the application loop if there is damage and the policy admits it.
+     * @details Held-back damage stays in the dirty rects for the next admitted frame.
+     * @return `true` if a drawing session was started; `present()` ends it.
+     */
+    bool paintFrame(FrameThrottle::Clock::time_point frameTime) {
+        bool animating = std::exchange(animationRequested, false);
+        runLayoutPass();
+
+        bool damaged = (pendingInvalidations && pendingInvalidations->isDirty())
+                    || (dirtyRects && dirtyRects->isDirty());
+        if (!damaged) {
+            throttle.noteIdle();
+            absorbPendingInvalidations();   // Starts the next generation
+            return false;
+        }
+
+        // Occlusion is only asked about when it matters (a visible window with damage).
+        bool shown = visible && !minimized;
+        bool occluded = shown && renderer && renderer->isOccluded();
+        animating = animating || widget::Animator::isAnimatingUnder(rootWidget.get());
+        auto tier = FrameThrottle::classify(visible, minimized, occluded, focused, animating);
+        if (!throttle.admit(tier, frameTime)) {
+            absorbPendingInvalidations();
+            return false;
+        }
+        return beginPaint(false);
+    }
+
+    /**
+     * @brief Runs the layout pass and draws the frame, without presenting it yet.
      *
      * The rendering pipeline is as follows:
-     * 1. Checks if rendering is possible (renderer and root widget exist, window is visible).
-     * 2. Begins a Direct2D drawing session.
-     * 3. Clears the background with a default color.
-     * 4. Traverses the widget tree, telling each widget to render itself.
-     * 5. Ends the Direct2D drawing session, presenting the final image.
-     * 6. Clears the list of dirty rectangles, as they have now been repainted.
+     * 1. Lays out the containers that requested it (`runLayoutPass()`).
+     * 2. Moves pending invalidations into the frame's dirty rects; without
+     *    any (and unless `force`), there is nothing to paint.
+     * 3. Checks if rendering is possible (renderer and root widget exist, window is visible).
+     * 4. Begins a Direct2D drawing session, clears the background, and
+     *    traverses the widget tree, telling each widget to render itself.
+     *
+     * @param force Paint even if nothing was invalidated.
+     * @return `true` if a drawing session was started; `present()` ends it.
      */
-    void render() {
-        if (!renderer || !rootWidget || !visible || minimized) return;
+    bool beginPaint(bool force) {
+        runLayoutPass();
+
+        // Anything queued since the last flush is painted by this frame.
+        bool pending = absorbPendingInvalidations();
+        if (!renderer || !rootWidget || !visible || minimized) return false;
+        if (!force && !pending && !(dirtyRects && dirtyRects->isDirty())) return false;
+
+        if (autoDamage) {
+            // A forced paint means the surface lost its contents: no diff can be trusted.
+            if (force && damageTracker) {
+                damageTracker->reset();
+            }
+            return beginPaintWithAutoDamage();
+        }
         
         renderer->beginRender();
         
         // Clear the entire render target with a background color.
-        renderer->clear(widget::Color(240, 240, 245));
+        renderer->clear(BACKGROUND_COLOR);
         
         // Recursively render the widget tree, starting from the root.
         rootWidget->render(*renderer);
         
-        renderer->endRender();
+        painting = true;
+        return true;
+    }
+
+    /**
+     * @brief Ends the drawing session started by `beginPaint()`, presenting the frame.
+     */
+    void present() {
+        if (!painting) return;
+        painting = false;
+
+        bool presented = renderer->endRender();
+        if (autoDamage) {
+            if (presented) {
+                damageTracker->commit();
+            } else {
+                // The render target was recreated; its contents are gone. Left
+                // without a baseline, the next frame is drawn in full.
+                damageTracker->reset();
+            }
+        } else if (hwnd) {
+            // The whole surface was redrawn: cancel any WM_PAINT the OS still owes us.
+            ValidateRect(hwnd, nullptr);
+        }
         
         // All invalid regions have been redrawn, so clear the dirty rects.
         if (dirtyRects) {
+            uint64_t area = 0;
+            for (const auto& rect : dirtyRects->getDirtyRects()) {
+                area += static_cast<uint64_t>(rect.w) * rect.h;
+            }
+            throttle.noteDamage(area);
             dirtyRects->clear();
         }
+        latency.notePresented(event::eventTimestampNow());
+        throttle.notePresented();
+    }
+
+    /**
+     * @brief Draws the frame using display-list diffing.
+     *
+     * 1. Records the widget tree into a display list (no drawing happens).
+     * 2. Diffs it per widget against the last presented list; changed items add
+     *    their old and new bounds to the dirty rect manager.
+     * 3. Replays the list into the renderer, clipped to each dirty rect.
+     *    Nothing is drawn at all if the frame is identical to the previous one.
+     *
+     * @return `true` if a drawing session was started; `present()` ends it.
+     */
+    bool beginPaintWithAutoDamage() {
+        if (!damageTracker) {
+            damageTracker = std::make_unique<render::DamageTracker>(renderer.get());
+        }
+        if (!dirtyRects) {
+            initializeDirtyRects();
+        }
+
+        widget::Rect<int32_t, uint32_t> surface(0, 0, size.w, size.h);
+        damageTracker->record(*rootWidget, surface, BACKGROUND_COLOR);
+        damageTracker->computeDamage(*dirtyRects);
+
+        if (!dirtyRects->isDirty()) {
+            damageTracker->commit();
+            latency.notePresented(event::eventTimestampNow());
+            return false;
+        }
+
+        renderer->beginRender();
+        damageTracker->present(*renderer, *dirtyRects);
+        painting = true;
+        return true;
     }
 };
 
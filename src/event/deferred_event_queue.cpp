@@ -0,0 +1,173 @@
+/**
+ * @file deferred_event_queue.cpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Implementation of the bounded deferred-event ring buffer.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "event/deferred_event_queue.hpp"
+#include <bit>
+#include <type_traits>
+
+namespace frqs::event {
+
+// `tryPush` copies events into the ring inside a noexcept function.
+static_assert(std::is_nothrow_copy_assignable_v<Event>, "Event copies must not throw");
+
+namespace {
+
+/**
+ * @brief Copies an event without pointers into dispatch-time storage.
+ * @details A coalesced `MouseMoveEvent`'s samples live only while the window
+ *          dispatches it; by the time the queue drains they would dangle.
+ */
+Event withoutTransientData(const Event& event) noexcept {
+    Event copy = event;
+    if (auto* move = std::get_if<MouseMoveEvent>(&copy)) {
+        move->samples = nullptr;
+        move->sampleCount = 0;
+    }
+    return copy;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// CONSTRUCTION
+// ============================================================================
+
+DeferredEventQueue::DeferredEventQueue(size_t capacity) {
+    size_t size = std::bit_ceil(capacity < 2 ? size_t{2} : capacity);
+    cells_ = std::make_unique<Cell[]>(size);
+    mask_ = size - 1;
+    for (size_t i = 0; i < size; ++i) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+// ============================================================================
+// PUBLISH
+// ============================================================================
+
+bool DeferredEventQueue::publish(const Event& event, uint64_t key) {
+    Event record = withoutTransientData(event);
+    if (key == NO_KEY) {
+        if (!tryPush(record, NO_KEY)) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        published_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    std::lock_guard lock(keyedMutex_);
+    auto [it, inserted] = keyed_.try_emplace(key);
+    it->second = record;
+    if (!inserted) {
+        // Already queued: the marker in the ring will pick up the new value.
+        coalesced_.fetch_add(1, std::memory_order_relaxed);
+        published_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    if (!tryPush(Event{}, key)) {
+        keyed_.erase(it);
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    published_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+// ============================================================================
+// RING OPERATIONS
+// ============================================================================
+
+/**
+ * @brief Claims the next slot and writes the event into it.
+ * @return `false` if the ring is full.
+ */
+bool DeferredEventQueue::tryPush(const Event& event, uint64_t key) noexcept {
+    size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &cells_[pos & mask_];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;                     // Full: the consumer has not freed this slot yet
+        } else {
+            pos = enqueuePos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->event = event;
+    cell->key = key;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+/**
+ * @brief Takes the oldest event; resolves keyed markers to their latest value.
+ * @return `false` if the ring is empty or the oldest slot is still being written.
+ */
+bool DeferredEventQueue::tryPop(Event& out) {
+    size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &cells_[pos & mask_];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+        if (diff == 0) {
+            if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = dequeuePos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    uint64_t key = cell->key;
+    if (key == NO_KEY) {
+        out = cell->event;                    // A plain copy (see the static_assert above)
+    }
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+
+    if (key != NO_KEY) {
+        std::lock_guard lock(keyedMutex_);
+        auto node = keyed_.extract(key);
+        out = node ? node.mapped() : Event{};
+    }
+    return true;
+}
+
+// ============================================================================
+// QUERY
+// ============================================================================
+
+size_t DeferredEventQueue::getPendingCount() const noexcept {
+    size_t head = dequeuePos_.load(std::memory_order_relaxed);
+    size_t tail = enqueuePos_.load(std::memory_order_relaxed);
+    return tail >= head ? tail - head : 0;
+}
+
+DeferredEventStats DeferredEventQueue::getStats() const noexcept {
+    return DeferredEventStats{
+        .published = published_.load(std::memory_order_relaxed),
+        .delivered = delivered_.load(std::memory_order_relaxed),
+        .dropped = dropped_.load(std::memory_order_relaxed),
+        .coalesced = coalesced_.load(std::memory_order_relaxed)
+    };
+}
+
+} // namespace frqs::event
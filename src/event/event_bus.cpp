@@ -14,6 +14,8 @@
  */
 
 #include "event/event_bus.hpp"
+#include <array>
+#include <thread>
 
 namespace frqs::event {
 
@@ -22,7 +24,232 @@ namespace frqs::event {
 // ============================================================================
 
 // Most of the EventBus is implemented in the header via template methods.
-// This file is the location for any future non-templated method definitions.
+// The write side (snapshot rebuilds) and the per-thread snapshot cache live here.
+
+namespace {
+
+/**
+ * @brief One cached snapshot of one bus on one thread.
+ */
+struct CachedSnapshot {
+    uint64_t busId = 0;
+    uint64_t version = 0;
+    std::shared_ptr<const void> snapshot;
+};
+
+/**
+ * @brief Per-thread snapshot cache, so publishing writes no shared memory.
+ *
+ * Snapshots replaced while a publish is running on this thread (re-entrant
+ * subscribe + publish) are parked in `retired` until the outermost publish
+ * returns, because the outer loop may still be iterating them.
+ */
+struct SnapshotCache {
+    static constexpr size_t SLOTS = 4;
+
+    std::array<CachedSnapshot, SLOTS> slots;
+    size_t nextVictim = 0;
+    uint32_t depth = 0;
+    std::vector<std::shared_ptr<const void>> retired;
+};
+
+thread_local SnapshotCache t_snapshots;
+
+std::atomic<uint64_t> g_nextBusId{1};
+
+} // anonymous namespace
+
+EventBus::EventBus(size_t deferredCapacity)
+    : snapshot_(std::make_shared<const Snapshot>())
+    , busId_(g_nextBusId.fetch_add(1, std::memory_order_relaxed))
+    , deferred_(deferredCapacity)
+{}
+
+/**
+ * @brief Registers a listener on the given channels and republishes them.
+ * @return The new listener's ID.
+ */
+ListenerId EventBus::addListener(EventListener callback, int priority, EventMask channels) {
+    std::lock_guard lock(mutex_);
+
+    ListenerId id = nextId_++;
+    listeners_.push_back(std::make_shared<const ListenerInfo>(ListenerInfo{
+        .id = id,
+        .callback = std::move(callback),
+        .priority = priority,
+        .channels = channels
+    }));
+    rebuildChannels(channels);
+    return id;
+}
+
+bool EventBus::unsubscribe(ListenerId id) {
+    std::vector<std::shared_ptr<const ListenerInfo>> removed;
+    std::vector<std::shared_ptr<const Snapshot>> draining;
+    {
+        std::lock_guard lock(mutex_);
+
+        auto it = std::find_if(listeners_.begin(), listeners_.end(),
+            [id](const auto& info) { return info->id == id; });
+        if (it == listeners_.end()) {
+            return false;
+        }
+
+        EventMask channels = (*it)->channels;
+        removed.push_back(std::move(*it));
+        listeners_.erase(it);
+        rebuildChannels(channels);
+        draining = collectRetired();
+    }
+
+    quiesce(draining, removed);
+    return true;
+}
+
+void EventBus::unsubscribeAll() {
+    std::vector<std::shared_ptr<const ListenerInfo>> removed;
+    std::vector<std::shared_ptr<const Snapshot>> draining;
+    {
+        std::lock_guard lock(mutex_);
+        removed.swap(listeners_);
+        rebuildChannels(EVENT_MASK_ALL);
+        draining = collectRetired();
+    }
+
+    quiesce(draining, removed);
+}
+
+/**
+ * @details The version bump in `rebuildChannels` and a reader's pin are both
+ *          sequentially consistent, and `beginRead` re-checks the version
+ *          after pinning: a publish either pinned an old snapshot before the
+ *          bump (and is counted here) or moves to the new one. A snapshot
+ *          with no readers can therefore never be iterated again.
+ */
+void EventBus::quiesce(const std::vector<std::shared_ptr<const Snapshot>>& draining,
+                       const std::vector<std::shared_ptr<const ListenerInfo>>& removed) {
+    if (t_snapshots.depth != 0) {
+        return;  // Inside a listener: waiting could wait on ourselves
+    }
+
+    for (const auto& snapshot : draining) {
+        while (snapshot->readers.load(std::memory_order_seq_cst) != 0) {
+            std::this_thread::yield();
+        }
+    }
+    // Stale caches still hold the ListenerInfo; drop what the callback captured now.
+    for (const auto& listener : removed) {
+        listener->callback = nullptr;
+    }
+}
+
+std::vector<std::shared_ptr<const EventBus::Snapshot>> EventBus::collectRetired() {
+    std::vector<std::shared_ptr<const Snapshot>> alive;
+    std::erase_if(retired_, [&](const std::weak_ptr<const Snapshot>& weak) {
+        auto snapshot = weak.lock();
+        if (!snapshot) return true;
+        alive.push_back(std::move(snapshot));
+        return false;
+    });
+    return alive;
+}
+
+/**
+ * @brief Builds a new snapshot sharing the untouched channels and rebuilding the rest.
+ *
+ * Threads still publishing from the old snapshot keep it alive through their
+ * cache; it is released once each of them has moved on. Until then it stays
+ * in `retired_`, where unsubscribing finds the readers it has to wait for.
+ */
+void EventBus::rebuildChannels(EventMask channels) {
+    auto next = std::make_shared<Snapshot>();
+    next->channels = snapshot_->channels;
+    EventMask active = EVENT_MASK_NONE;
+
+    for (size_t index = 0; index < CHANNEL_COUNT; ++index) {
+        EventMask bit = EventMask{1} << index;
+        Channel& channel = next->channels[index];
+
+        if (channels & bit) {
+            channel.clear();
+            for (const auto& listener : listeners_) {
+                if (listener->channels & bit) {
+                    channel.push_back(listener);
+                }
+            }
+            // Higher priority first; equal priorities keep subscription order.
+            std::stable_sort(channel.begin(), channel.end(),
+                [](const auto& a, const auto& b) { return a->priority > b->priority; });
+        }
+        if (!channel.empty()) {
+            active |= bit;
+        }
+    }
+
+    retired_.push_back(snapshot_);
+    snapshot_ = std::move(next);
+    activeChannels_.store(active, std::memory_order_release);
+    version_.fetch_add(1, std::memory_order_seq_cst);
+}
+
+/**
+ * @brief Pins this thread's snapshot of the bus, refreshing it only if the bus changed.
+ *
+ * The common case is two atomic loads, one increment of the snapshot's
+ * reader count and a scan of a few thread-local slots.
+ */
+const EventBus::Snapshot* EventBus::beginRead() const {
+    SnapshotCache& cache = t_snapshots;
+    ++cache.depth;
+
+    uint64_t version = version_.load(std::memory_order_seq_cst);
+    CachedSnapshot* slot = nullptr;
+    for (auto& candidate : cache.slots) {
+        if (candidate.busId == busId_) {
+            slot = &candidate;
+            break;
+        }
+    }
+    if (slot && slot->version == version) {
+        auto* snapshot = static_cast<const Snapshot*>(slot->snapshot.get());
+        snapshot->readers.fetch_add(1, std::memory_order_seq_cst);
+        // Replaced between the load and the pin: an unsubscribe may not have seen the pin.
+        if (version_.load(std::memory_order_seq_cst) == version) {
+            return snapshot;
+        }
+        snapshot->readers.fetch_sub(1, std::memory_order_release);
+    }
+
+    // Miss: take and pin the current snapshot under the lock (writers never run callbacks).
+    std::shared_ptr<const Snapshot> fresh;
+    {
+        std::lock_guard lock(mutex_);
+        fresh = snapshot_;
+        fresh->readers.fetch_add(1, std::memory_order_relaxed);
+        version = version_.load(std::memory_order_relaxed);
+    }
+
+    if (!slot) {
+        slot = &cache.slots[cache.nextVictim];
+        cache.nextVictim = (cache.nextVictim + 1) % SnapshotCache::SLOTS;
+    }
+    if (slot->snapshot) {
+        cache.retired.push_back(std::move(slot->snapshot));
+    }
+    slot->busId = busId_;
+    slot->version = version;
+    slot->snapshot = std::move(fresh);
+    return static_cast<const Snapshot*>(slot->snapshot.get());
+}
+
+void EventBus::endRead(const Snapshot* snapshot) noexcept {
+    snapshot->readers.fetch_sub(1, std::memory_order_release);
+
+    SnapshotCache& cache = t_snapshots;
+    if (--cache.depth == 0) {
+        cache.retired.clear();
+    }
+}
 
 // ============================================================================
 // HELPER FUNCTIONS
@@ -9,7 +9,7 @@
  * 
  */
 
-#include "event/event.hpp"
+#include "event/event_dispatcher.hpp"
 #include "widget/iwidget.hpp"
 #include <chrono>
 
@@ -19,6 +19,45 @@ namespace frqs::event {
 // EVENT DISPATCHER (Helper Functions)
 // ============================================================================
 
+namespace {
+
+/**
+ * @brief Depth-first dispatch below `root`, with the event's mask bit precomputed.
+ */
+bool dispatchMasked(widget::IWidget* root, const Event& event, EventMask bit) {
+    if ((root->getSubtreeEventMask() & bit) == 0 || !root->isVisible()) {
+        return false;  // Nobody in this subtree wants the event
+    }
+
+    // Try children first (front-to-back for proper z-order)
+    for (const auto& child : root->getChildren()) {
+        if (dispatchMasked(child.get(), event, bit)) {
+            return true;  // Event handled by child
+        }
+    }
+
+    // Try the widget itself
+    return (root->getEventMask() & bit) != 0 && root->onEvent(event);
+}
+
+size_t broadcastMasked(widget::IWidget* root, const Event& event, EventMask bit) {
+    if ((root->getSubtreeEventMask() & bit) == 0 || !root->isVisible()) {
+        return 0;
+    }
+
+    size_t delivered = 0;
+    if (root->getEventMask() & bit) {
+        root->onEvent(event);
+        ++delivered;
+    }
+    for (const auto& child : root->getChildren()) {
+        delivered += broadcastMasked(child.get(), event, bit);
+    }
+    return delivered;
+}
+
+} // anonymous namespace
+
 /**
  * @brief Dispatches an event to the widget tree using a depth-first traversal.
  * 
@@ -27,25 +66,41 @@ namespace frqs::event {
  * to respect z-ordering). If no child handles the event, it then offers the event
  * to the widget itself. The traversal stops and returns `true` as soon as a widget
  * in the tree handles the event.
+ *
+ * Subtrees whose aggregated interest mask lacks the event's type are skipped,
+ * and widgets outside their own mask are never offered the event.
  * 
  * @param root The root widget of the tree (or subtree) to dispatch the event to.
  * @param event The event to be dispatched.
  * @return `true` if the event was handled by any widget in the tree, `false` otherwise.
  */
 bool dispatchToWidgetTree(widget::IWidget* root, const Event& event) {
-    if (!root || !root->isVisible()) {
+    if (!root) {
         return false;
     }
+    return dispatchMasked(root, event, eventMaskOf(event));
+}
 
-    // Try children first (front-to-back for proper z-order)
-    for (const auto& child : root->getChildren()) {
-        if (dispatchToWidgetTree(child.get(), event)) {
-            return true;  // Event handled by child
-        }
+/**
+ * @brief Broadcasts an event to every interested widget (parents before children).
+ *
+ * Unlike `dispatchToWidgetTree`, delivery does not stop when a widget handles
+ * the event. Only subtrees containing an interested widget are visited.
+ *
+ * @param root The root widget of the tree (or subtree).
+ * @param event The event to broadcast.
+ * @return The number of widgets the event was delivered to.
+ */
+size_t broadcastToWidgetTree(widget::IWidget* root, const Event& event) {
+    if (!root) {
+        return 0;
     }
+    return broadcastMasked(root, event, eventMaskOf(event));
+}
 
-    // Try the widget itself
-    return root->onEvent(event);
+uint64_t eventTimestampNow() noexcept {
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
 }
 
 /**
@@ -67,9 +122,7 @@ MouseMoveEvent createMouseMoveEvent(
         .position = widget::Point<int32_t>(x, y),
         .delta = widget::Point<int32_t>(x - prevX, y - prevY),
         .modifiers = modifiers,
-        .timestamp = static_cast<uint64_t>(
-            std::chrono::steady_clock::now().time_since_epoch().count()
-        )
+        .timestamp = eventTimestampNow()
     };
 }
 
@@ -94,9 +147,7 @@ MouseButtonEvent createMouseButtonEvent(
         .action = action,
         .position = widget::Point<int32_t>(x, y),
         .modifiers = modifiers,
-        .timestamp = static_cast<uint64_t>(
-            std::chrono::steady_clock::now().time_since_epoch().count()
-        )
+        .timestamp = eventTimestampNow()
     };
 }
 
@@ -117,9 +168,7 @@ KeyEvent createKeyEvent(
         .keyCode = keyCode,
         .action = action,
         .modifiers = modifiers,
-        .timestamp = static_cast<uint64_t>(
-            std::chrono::steady_clock::now().time_since_epoch().count()
-        )
+        .timestamp = eventTimestampNow()
     };
 }
 
@@ -201,6 +250,9 @@ const char* getEventTypeName(const Event& event) {
         else if constexpr (std::is_same_v<T, ResizeEvent>) return "Resize";
         else if constexpr (std::is_same_v<T, PaintEvent>) return "Paint";
         else if constexpr (std::is_same_v<T, FileDropEvent>) return "FileDrop";
+        else if constexpr (std::is_same_v<T, MouseWheelEvent>) return "MouseWheel";
+        else if constexpr (std::is_same_v<T, MouseHoverEvent>) return "MouseHover";
+        else if constexpr (std::is_same_v<T, FocusEvent>) return "Focus";
         else return "Unknown";
     }, event);
 }
@@ -0,0 +1,86 @@
+/**
+ * @file event_payload.cpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Implementation of the out-of-line event payload arena.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "event/event_payload.hpp"
+
+namespace frqs::event {
+
+// ============================================================================
+// PAYLOAD ARENA
+// ============================================================================
+
+PayloadArena& PayloadArena::instance() {
+    static PayloadArena arena;
+    return arena;
+}
+
+PayloadHandle PayloadArena::storeFiles(std::vector<std::filesystem::path> files) {
+    std::lock_guard lock(mutex_);
+
+    uint32_t index;
+    if (!freeSlots_.empty()) {
+        index = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        index = static_cast<uint32_t>(slots_.size());
+        slots_.emplace_back();
+    }
+
+    Slot& slot = slots_[index];
+    slot.live = true;
+    slot.files = std::move(files);
+    ++liveCount_;
+    return PayloadHandle{.index = index, .generation = slot.generation};
+}
+
+std::span<const std::filesystem::path> PayloadArena::getFiles(PayloadHandle handle) const {
+    std::lock_guard lock(mutex_);
+    if (!handle.isValid() || handle.index >= slots_.size()) return {};
+
+    const Slot& slot = slots_[handle.index];
+    if (!slot.live || slot.generation != handle.generation) return {};
+    // The vector's buffer does not move when `slots_` grows, so the span outlives the lock.
+    return slot.files;
+}
+
+void PayloadArena::release(PayloadHandle handle) {
+    std::vector<std::filesystem::path> released;
+    {
+        std::lock_guard lock(mutex_);
+        if (!handle.isValid() || handle.index >= slots_.size()) return;
+
+        Slot& slot = slots_[handle.index];
+        if (!slot.live || slot.generation != handle.generation) return;
+
+        released.swap(slot.files);            // Free outside the lock
+        slot.live = false;
+        if (++slot.generation == 0) {
+            slot.generation = 1;              // 0 is reserved for "no payload"
+        }
+        freeSlots_.push_back(handle.index);
+        --liveCount_;
+    }
+}
+
+size_t PayloadArena::getLiveCount() const {
+    std::lock_guard lock(mutex_);
+    return liveCount_;
+}
+
+// ============================================================================
+// FILE DROP EVENT
+// ============================================================================
+
+std::span<const std::filesystem::path> FileDropEvent::getFiles() const {
+    return PayloadArena::instance().getFiles(payload);
+}
+
+} // namespace frqs::event
@@ -0,0 +1,263 @@
+/**
+ * @file event_trace.cpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Implementation of input trace recording and its binary file format.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * File layout (native endian):
+ *
+ *   "FRQT" | u16 version | u8 alternative count | u8 sizeof(alternative)... | varint record count
+ *   per record: u8 event index | varint time delta | varint window id | raw event bytes
+ *               file drops add: varint path count | (varint byte length | UTF-8 bytes)...
+ *
+ * Events are trivially copyable, so the raw bytes of the active alternative are
+ * the event; the size table in the header guards against layout changes.
+ */
+
+#include "event/event_trace.hpp"
+#include "event/event_payload.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+
+namespace frqs::event {
+
+namespace {
+
+constexpr char TRACE_MAGIC[4] = {'F', 'R', 'Q', 'T'};
+constexpr uint16_t TRACE_VERSION = 1;
+constexpr size_t ALTERNATIVE_COUNT = std::variant_size_v<Event>;
+
+/// @brief sizeof() of every Event alternative, in index order.
+constexpr auto ALTERNATIVE_SIZES = []<size_t... Is>(std::index_sequence<Is...>) {
+    return std::array<uint8_t, ALTERNATIVE_COUNT>{
+        static_cast<uint8_t>(sizeof(std::variant_alternative_t<Is, Event>))...
+    };
+}(std::make_index_sequence<ALTERNATIVE_COUNT>{});
+
+// ============================================================================
+// ENCODING HELPERS
+// ============================================================================
+
+void writeVarint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+/**
+ * @brief Bounds-checked cursor over a loaded file.
+ */
+class Reader {
+private:
+    const char* pos_;
+    const char* end_;
+
+public:
+    Reader(const char* data, size_t size) noexcept : pos_(data), end_(data + size) {}
+
+    [[nodiscard]] bool atEnd() const noexcept { return pos_ == end_; }
+
+    bool readBytes(void* out, size_t count) noexcept {
+        if (static_cast<size_t>(end_ - pos_) < count) return false;
+        std::memcpy(out, pos_, count);
+        pos_ += count;
+        return true;
+    }
+
+    bool readVarint(uint64_t& value) noexcept {
+        value = 0;
+        for (unsigned shift = 0; shift < 64 && pos_ != end_; shift += 7) {
+            auto byte = static_cast<uint8_t>(*pos_++);
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) return true;
+        }
+        return false;
+    }
+
+    bool readString(std::string& out, size_t length) {
+        if (static_cast<size_t>(end_ - pos_) < length) return false;
+        out.assign(pos_, length);
+        pos_ += length;
+        return true;
+    }
+};
+
+/**
+ * @brief Rebuilds the alternative with index `I` from its raw bytes.
+ */
+template <size_t I>
+void emplaceFromBytes(Event& out, const char* bytes) {
+    using T = std::variant_alternative_t<I, Event>;
+    T value;
+    std::memcpy(&value, bytes, sizeof(T));
+    out.emplace<I>(value);
+}
+
+template <size_t... Is>
+void emplaceFromBytes(size_t index, Event& out, const char* bytes, std::index_sequence<Is...>) {
+    ((index == Is ? (emplaceFromBytes<Is>(out, bytes), true) : false) || ...);
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// EVENT TRACE
+// ============================================================================
+
+void EventTrace::append(uint64_t time, uint64_t windowId, const Event& event) {
+    TraceRecord& record = records_.emplace_back(TraceRecord{.time = time, .windowId = windowId, .event = event});
+
+    if (auto* move = std::get_if<MouseMoveEvent>(&record.event)) {
+        move->samples = nullptr;              // Only valid during the original dispatch
+        move->sampleCount = 0;
+    } else if (auto* drop = std::get_if<FileDropEvent>(&record.event)) {
+        auto files = drop->getFiles();
+        record.payload = static_cast<uint32_t>(fileLists_.size());
+        fileLists_.emplace_back(files.begin(), files.end());
+        drop->payload = PayloadHandle{};      // Arena handles do not outlive the dispatch
+    }
+}
+
+std::span<const std::filesystem::path> EventTrace::getFiles(const TraceRecord& record) const noexcept {
+    if (record.payload >= fileLists_.size()) return {};
+    return fileLists_[record.payload];
+}
+
+void EventTrace::clear() noexcept {
+    records_.clear();
+    fileLists_.clear();
+}
+
+bool EventTrace::save(const std::filesystem::path& path) const {
+    std::string out;
+    out.reserve(16 + records_.size() * 32);
+
+    out.append(TRACE_MAGIC, sizeof(TRACE_MAGIC));
+    out.append(reinterpret_cast<const char*>(&TRACE_VERSION), sizeof(TRACE_VERSION));
+    out.push_back(static_cast<char>(ALTERNATIVE_COUNT));
+    out.append(reinterpret_cast<const char*>(ALTERNATIVE_SIZES.data()), ALTERNATIVE_SIZES.size());
+    writeVarint(out, records_.size());
+
+    uint64_t previousTime = 0;
+    for (const auto& record : records_) {
+        out.push_back(static_cast<char>(record.event.index()));
+        writeVarint(out, record.time - previousTime);
+        writeVarint(out, record.windowId);
+        previousTime = record.time;
+
+        std::visit([&out](const auto& evt) {
+            out.append(reinterpret_cast<const char*>(&evt), sizeof(evt));
+        }, record.event);
+
+        if (std::holds_alternative<FileDropEvent>(record.event)) {
+            auto files = getFiles(record);
+            writeVarint(out, files.size());
+            for (const auto& file : files) {
+                auto utf8 = file.u8string();
+                writeVarint(out, utf8.size());
+                out.append(reinterpret_cast<const char*>(utf8.data()), utf8.size());
+            }
+        }
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+    file.write(out.data(), static_cast<std::streamsize>(out.size()));
+    return static_cast<bool>(file);
+}
+
+std::optional<EventTrace> EventTrace::load(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return std::nullopt;
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    Reader reader(data.data(), data.size());
+
+    char magic[sizeof(TRACE_MAGIC)];
+    uint16_t version = 0;
+    uint8_t alternativeCount = 0;
+    std::array<uint8_t, ALTERNATIVE_COUNT> sizes{};
+    if (!reader.readBytes(magic, sizeof(magic)) || std::memcmp(magic, TRACE_MAGIC, sizeof(magic)) != 0 ||
+        !reader.readBytes(&version, sizeof(version)) || version != TRACE_VERSION ||
+        !reader.readBytes(&alternativeCount, 1) || alternativeCount != ALTERNATIVE_COUNT ||
+        !reader.readBytes(sizes.data(), sizes.size()) || sizes != ALTERNATIVE_SIZES) {
+        return std::nullopt;
+    }
+
+    uint64_t count = 0;
+    if (!reader.readVarint(count)) return std::nullopt;
+
+    EventTrace trace;
+    trace.records_.reserve(static_cast<size_t>(std::min<uint64_t>(count, data.size())));
+
+    uint64_t time = 0;
+    char bytes[256];
+    std::string utf8;
+    for (uint64_t i = 0; i < count; ++i) {
+        uint8_t index = 0;
+        uint64_t delta = 0;
+        TraceRecord record;
+        if (!reader.readBytes(&index, 1) || index >= ALTERNATIVE_COUNT ||
+            !reader.readVarint(delta) || !reader.readVarint(record.windowId) ||
+            !reader.readBytes(bytes, ALTERNATIVE_SIZES[index])) {
+            return std::nullopt;
+        }
+        time += delta;
+        record.time = time;
+        emplaceFromBytes(index, record.event, bytes, std::make_index_sequence<ALTERNATIVE_COUNT>{});
+
+        if (std::holds_alternative<FileDropEvent>(record.event)) {
+            uint64_t fileCount = 0;
+            if (!reader.readVarint(fileCount)) return std::nullopt;
+            std::vector<std::filesystem::path> files;
+            for (uint64_t f = 0; f < fileCount; ++f) {
+                uint64_t length = 0;
+                if (!reader.readVarint(length) || !reader.readString(utf8, static_cast<size_t>(length))) {
+                    return std::nullopt;
+                }
+                files.emplace_back(std::u8string(utf8.begin(), utf8.end()));
+            }
+            record.payload = static_cast<uint32_t>(trace.fileLists_.size());
+            trace.fileLists_.push_back(std::move(files));
+        }
+        trace.records_.push_back(record);
+    }
+
+    if (!reader.atEnd()) return std::nullopt;
+    return trace;
+}
+
+// ============================================================================
+// EVENT RECORDER
+// ============================================================================
+
+void EventRecorder::start() {
+    trace_.clear();
+    start_ = std::chrono::steady_clock::now();
+    recording_ = true;
+}
+
+void EventRecorder::record(uint64_t windowId, const Event& event) {
+    if (!recording_ || (eventMaskOf(event) & mask_) == 0) return;
+
+    auto elapsed = std::chrono::steady_clock::now() - start_;
+    trace_.append(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+                  windowId, event);
+}
+
+EventTrace EventRecorder::takeTrace() noexcept {
+    EventTrace taken = std::move(trace_);
+    trace_.clear();
+    return taken;
+}
+
+} // namespace frqs::event
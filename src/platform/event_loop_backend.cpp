@@ -0,0 +1,75 @@
+/**
+ * @file event_loop_backend.cpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Implementation of the headless event loop backend.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "platform/event_loop_backend.hpp"
+
+namespace frqs::platform {
+
+// ============================================================================
+// HEADLESS BACKEND
+// ============================================================================
+
+void HeadlessEventLoopBackend::postMessage(UniqueTask message) {
+    {
+        std::lock_guard lock(mutex_);
+        messages_.push_back(std::move(message));
+    }
+    condVar_.notify_one();
+}
+
+void HeadlessEventLoopBackend::postQuit() {
+    {
+        std::lock_guard lock(mutex_);
+        quitRequested_ = true;
+    }
+    condVar_.notify_one();
+}
+
+bool HeadlessEventLoopBackend::dispatchMessages() {
+    for (;;) {
+        UniqueTask message;
+        {
+            std::lock_guard lock(mutex_);
+            if (quitRequested_) {
+                quitRequested_ = false;
+                return false;
+            }
+            if (messages_.empty()) return true;
+            message = std::move(messages_.front());
+            messages_.pop_front();
+        }
+        if (message) message();     // Outside the lock: it may post more
+    }
+}
+
+bool HeadlessEventLoopBackend::waitForMessages(std::optional<std::chrono::nanoseconds> timeout) {
+    waits_.fetch_add(1, std::memory_order_relaxed);
+
+    std::unique_lock lock(mutex_);
+    auto ready = [this] { return woken_ || quitRequested_ || !messages_.empty(); };
+    bool woken = timeout ? condVar_.wait_for(lock, *timeout, ready) : (condVar_.wait(lock, ready), true);
+    woken_ = false;     // Auto-reset, like the Win32 wake event
+
+    if (woken) {
+        wakeups_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return woken;
+}
+
+void HeadlessEventLoopBackend::wake() {
+    {
+        std::lock_guard lock(mutex_);
+        woken_ = true;
+    }
+    condVar_.notify_one();
+}
+
+} // namespace frqs::platform
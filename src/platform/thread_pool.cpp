@@ -0,0 +1,282 @@
+/**
+ * @file thread_pool.cpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Implementation of the work-stealing thread pool.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "platform/thread_pool.hpp"
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+namespace frqs::platform {
+
+// ============================================================================
+// THREAD POOL PIMPL
+// ============================================================================
+
+namespace {
+
+/**
+ * @struct WorkerQueue
+ * @brief One worker's deque. The owner uses the back, thieves the front.
+ */
+struct alignas(64) WorkerQueue {
+    std::mutex mutex;
+    std::deque<UniqueTask> tasks;
+};
+
+/**
+ * @struct CurrentWorker
+ * @brief Identifies the pool and index of the calling worker thread.
+ */
+struct CurrentWorker {
+    const void* pool = nullptr;
+    size_t index = ThreadPool::ANY_WORKER;
+};
+
+thread_local CurrentWorker t_currentWorker;
+
+} // anonymous namespace
+
+/**
+ * @struct ThreadPool::Impl
+ * @brief Worker deques, threads, and the parking lot.
+ */
+struct ThreadPool::Impl {
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+
+    /** @brief Tasks in all deques; the publication idle workers check before parking. */
+    alignas(64) std::atomic<size_t> queued{0};
+    alignas(64) std::atomic<size_t> nextQueue{0};       ///< Round-robin cursor for outside submissions.
+
+    std::mutex parkMutex;
+    std::condition_variable parkCv;
+    std::atomic<uint32_t> sleepers{0};
+    uint64_t wakeEpoch = 0;                             ///< Guarded by parkMutex.
+    bool stopping = false;                              ///< Guarded by parkMutex.
+
+    std::atomic<uint64_t> submitted{0};
+    std::atomic<uint64_t> executed{0};
+    std::atomic<uint64_t> stolen{0};
+    std::atomic<uint64_t> parks{0};
+
+    /** @brief Pops the newest task of worker `index`'s own deque. */
+    std::optional<UniqueTask> popOwn(size_t index) {
+        WorkerQueue& queue = *queues[index];
+        std::lock_guard lock(queue.mutex);
+        if (queue.tasks.empty()) return std::nullopt;
+        UniqueTask task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return task;
+    }
+
+    /** @brief Takes the oldest task of the first non-empty deque after `start`. */
+    std::optional<UniqueTask> steal(size_t start, size_t skip) {
+        size_t count = queues.size();
+        for (size_t n = 0; n < count; ++n) {
+            size_t victim = (start + n) % count;
+            if (victim == skip) continue;
+
+            WorkerQueue& queue = *queues[victim];
+            std::lock_guard lock(queue.mutex);
+            if (queue.tasks.empty()) continue;
+            UniqueTask task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            return task;
+        }
+        return std::nullopt;
+    }
+
+    /** @brief Finds work for worker `index` (or an outside thread if `ANY_WORKER`). */
+    std::optional<UniqueTask> take(size_t index) {
+        if (queued.load(std::memory_order_relaxed) == 0) return std::nullopt;
+
+        std::optional<UniqueTask> task;
+        if (index != ANY_WORKER) {
+            task = popOwn(index);
+        }
+        if (!task) {
+            size_t start = index != ANY_WORKER ? index + 1 : nextQueue.load(std::memory_order_relaxed);
+            task = steal(start, index);
+            if (task && index != ANY_WORKER) {
+                stolen.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        if (task) {
+            queued.fetch_sub(1, std::memory_order_relaxed);
+        }
+        return task;
+    }
+
+    void run(UniqueTask& task) noexcept {
+        try {
+            task();
+        } catch (...) {
+            // Swallow exceptions in worker thread to prevent thread termination.
+        }
+        executed.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /** @brief Sleeps until a submission or shutdown. @return `false` once stopping with no work left. */
+    bool park() {
+        uint64_t epoch;
+        {
+            std::lock_guard lock(parkMutex);
+            if (stopping) return queued.load(std::memory_order_seq_cst) > 0;
+            epoch = wakeEpoch;
+        }
+
+        // Dekker handshake with submit(): it bumps `queued` then reads
+        // `sleepers`; we bump `sleepers` then read `queued`. One side sees the other.
+        sleepers.fetch_add(1, std::memory_order_seq_cst);
+        if (queued.load(std::memory_order_seq_cst) > 0) {
+            sleepers.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        parks.fetch_add(1, std::memory_order_relaxed);
+        std::unique_lock lock(parkMutex);
+        parkCv.wait(lock, [&] { return wakeEpoch != epoch || stopping; });
+        sleepers.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void workerLoop(const ThreadPool* pool, size_t index) {
+        t_currentWorker = CurrentWorker{.pool = pool, .index = index};
+        for (;;) {
+            if (auto task = take(index)) {
+                run(*task);
+                continue;
+            }
+            if (!park()) return;
+        }
+    }
+};
+
+// ============================================================================
+// CONSTRUCTOR / DESTRUCTOR
+// ============================================================================
+
+ThreadPool::ThreadPool(size_t workerCount) : pImpl_(std::make_unique<Impl>()) {
+    if (workerCount == 0) {
+        workerCount = getOptimalThreadCount();
+    }
+
+    pImpl_->queues.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        pImpl_->queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    pImpl_->workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        pImpl_->workers.emplace_back([this, i] { pImpl_->workerLoop(this, i); });
+    }
+}
+
+ThreadPool::~ThreadPool() noexcept {
+    {
+        std::lock_guard lock(pImpl_->parkMutex);
+        pImpl_->stopping = true;
+    }
+    pImpl_->parkCv.notify_all();
+
+    for (auto& worker : pImpl_->workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+// ============================================================================
+// SUBMISSION
+// ============================================================================
+
+void ThreadPool::submit(UniqueTask task, size_t affinity) {
+    if (!task) return;
+
+    auto& impl = *pImpl_;
+    size_t count = impl.queues.size();
+    size_t target;
+    if (affinity != ANY_WORKER) {
+        target = affinity % count;
+    } else if (t_currentWorker.pool == this) {
+        target = t_currentWorker.index;     // Keep spawned work local
+    } else {
+        target = impl.nextQueue.fetch_add(1, std::memory_order_relaxed) % count;
+    }
+
+    // Counted before it is visible, so `queued` never drops below zero when a
+    // thief takes the task at once.
+    impl.submitted.fetch_add(1, std::memory_order_relaxed);
+    impl.queued.fetch_add(1, std::memory_order_seq_cst);
+    {
+        WorkerQueue& queue = *impl.queues[target];
+        std::lock_guard lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+
+    if (impl.sleepers.load(std::memory_order_seq_cst) > 0) {
+        {
+            std::lock_guard lock(impl.parkMutex);
+            ++impl.wakeEpoch;
+        }
+        impl.parkCv.notify_one();
+    }
+}
+
+bool ThreadPool::runPendingTask() {
+    size_t index = getCurrentWorkerIndex();
+    if (auto task = pImpl_->take(index)) {
+        pImpl_->run(*task);
+        return true;
+    }
+    return false;
+}
+
+// ============================================================================
+// QUERIES
+// ============================================================================
+
+size_t ThreadPool::getWorkerCount() const noexcept {
+    return pImpl_->queues.size();
+}
+
+size_t ThreadPool::getCurrentWorkerIndex() const noexcept {
+    return t_currentWorker.pool == this ? t_currentWorker.index : ANY_WORKER;
+}
+
+ThreadPoolStats ThreadPool::getStats() const noexcept {
+    return ThreadPoolStats{
+        .submitted = pImpl_->submitted.load(std::memory_order_relaxed),
+        .executed = pImpl_->executed.load(std::memory_order_relaxed),
+        .stolen = pImpl_->stolen.load(std::memory_order_relaxed),
+        .parks = pImpl_->parks.load(std::memory_order_relaxed)
+    };
+}
+
+// ============================================================================
+// GLOBAL THREAD POOL
+// ============================================================================
+
+unsigned int getOptimalThreadCount() noexcept {
+    unsigned int hwThreads = std::thread::hardware_concurrency();
+    return hwThreads > 0 ? hwThreads : 4;  // Fallback to 4 if detection fails
+}
+
+ThreadPool& getGlobalThreadPool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+void postToThreadPool(UniqueTask task, size_t affinity) {
+    getGlobalThreadPool().submit(std::move(task), affinity);
+}
+
+} // namespace frqs::platform
@@ -0,0 +1,110 @@
+/**
+ * @file win32_event_loop.cpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Implements the Win32 event loop backend.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "platform/event_loop_backend.hpp"
+#include "platform/win32_safe.hpp"
+#include <timeapi.h>
+#include <algorithm>
+
+#pragma comment(lib, "winmm.lib") ///< Link against the multimedia timer library for timeBeginPeriod.
+
+namespace frqs::platform {
+
+// ============================================================================
+// WIN32 BACKEND
+// ============================================================================
+
+namespace {
+
+/**
+ * @class Win32EventLoopBackend
+ * @brief Blocks on the thread's message queue and an auto-reset wake event at once.
+ */
+class Win32EventLoopBackend final : public EventLoopBackend {
+private:
+    HANDLE wakeEvent_ = nullptr;    ///< Auto-reset: a `wake()` before the wait is not lost.
+    bool highResolution_ = false;   ///< A 1 ms timer period is requested.
+
+public:
+    Win32EventLoopBackend() {
+        wakeEvent_ = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+    }
+
+    ~Win32EventLoopBackend() override {
+        setHighResolutionTiming(false);
+        if (wakeEvent_) {
+            CloseHandle(wakeEvent_);
+        }
+    }
+
+    Win32EventLoopBackend(const Win32EventLoopBackend&) = delete;
+    Win32EventLoopBackend& operator=(const Win32EventLoopBackend&) = delete;
+
+    bool dispatchMessages() override {
+        NativeMessage msg;
+        // PM_REMOVE pulls messages from the queue.
+        while (PeekMessageW(&msg, nullptr, 0, 0, PM_REMOVE)) {
+            if (msg.message == WM_QUIT) {
+                // A WM_QUIT message signals that the application should terminate.
+                // This is typically posted when the last window is closed.
+                return false;
+            }
+
+            // Translates virtual-key messages into character messages.
+            TranslateMessage(&msg);
+            // Dispatches the message to a window's procedure.
+            DispatchMessageW(&msg);
+        }
+        return true;
+    }
+
+    bool waitForMessages(std::optional<std::chrono::nanoseconds> timeout) override {
+        DWORD milliseconds = INFINITE;
+        if (timeout) {
+            // Rounded up: waking before a timer is due would only spin once more.
+            auto ms = std::chrono::ceil<std::chrono::milliseconds>(*timeout).count();
+            milliseconds = static_cast<DWORD>(std::clamp<int64_t>(ms, 0, INFINITE - 1));
+        }
+
+        // MWMO_INPUTAVAILABLE also returns for input that arrived before the
+        // wait but was not removed yet, so nothing queued is slept over.
+        DWORD result = MsgWaitForMultipleObjectsEx(
+            wakeEvent_ ? 1 : 0, wakeEvent_ ? &wakeEvent_ : nullptr,
+            milliseconds, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+        return result != WAIT_TIMEOUT;
+    }
+
+    void wake() override {
+        if (wakeEvent_) {
+            SetEvent(wakeEvent_);
+        }
+    }
+
+    void setHighResolutionTiming(bool enabled) override {
+        if (enabled == highResolution_) return;
+        // Only while pacing: a raised timer rate costs power, and an idle loop
+        // does not use timeouts at all.
+        if (enabled) {
+            timeBeginPeriod(1);
+        } else {
+            timeEndPeriod(1);
+        }
+        highResolution_ = enabled;
+    }
+};
+
+} // anonymous namespace
+
+std::unique_ptr<EventLoopBackend> createNativeEventLoopBackend() {
+    return std::make_unique<Win32EventLoopBackend>();
+}
+
+} // namespace frqs::platform
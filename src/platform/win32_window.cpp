@@ -11,12 +11,52 @@
 
 #include "core/window.hpp"
 #include "core/window_impl.hpp"
+#include "event/event_dispatcher.hpp"
+#include "event/event_payload.hpp"
 #include "event/event_types.hpp"
 #include <shellapi.h>
+#include <algorithm>
+#include <chrono>
 #include <mutex>
 
 namespace frqs::platform {
 
+// ============================================================================
+// MESSAGE TIME
+// ============================================================================
+
+namespace {
+
+/**
+ * @brief The steady clock (in ns) minus the tick count (in ns), sampled once at startup.
+ * @details One offset for the whole run keeps every input on the same mapping,
+ *          so intervals between inputs are exact to the tick.
+ */
+const int64_t g_tickToSteadyNs = [] {
+    auto steadyNs = static_cast<int64_t>(event::eventTimestampNow());
+    auto tickNs = static_cast<int64_t>(GetTickCount64()) * 1'000'000;
+    return steadyNs - tickNs;
+}();
+
+/**
+ * @brief Gets when the message being handled was posted, on the event clock.
+ * @details `GetMessageTime()` is the tick count (ms) when the input entered
+ *          the queue, so a frame that falls behind reports the whole wait
+ *          instead of starting the clock when the message is finally handled.
+ *          It wraps every 49.7 days and is widened against `GetTickCount64()`.
+ */
+uint64_t messageTimestamp() noexcept {
+    uint64_t now = event::eventTimestampNow();
+    ULONGLONG ticks = GetTickCount64();
+    auto age = static_cast<DWORD>(static_cast<DWORD>(ticks) - static_cast<DWORD>(GetMessageTime()));
+    auto posted = static_cast<int64_t>(ticks - age) * 1'000'000 + g_tickToSteadyNs;
+
+    // Coarse ticks may land a few ms after `now`; an input is never from the future.
+    return std::min(static_cast<uint64_t>(std::max<int64_t>(posted, 0)), now);
+}
+
+} // anonymous namespace
+
 // ============================================================================
 // WINDOW CLASS REGISTRATION
 // ============================================================================
@@ -150,6 +190,12 @@ private:
                 return 0;
 
             case WM_SIZE: {
+                // Minimizing from the title bar bypasses Window::minimize();
+                // a minimized window reports 0x0 and stops painting.
+                pImpl->minimized = (wp == SIZE_MINIMIZED);
+                if (pImpl->minimized) return 0;
+                pImpl->maximized = (wp == SIZE_MAXIMIZED);
+
                 UINT width = LOWORD(lp);
                 UINT height = HIWORD(lp);
                 pImpl->handleSizeMessage(width, height);
@@ -229,7 +275,7 @@ private:
                     .keyCode = static_cast<uint32_t>(character),
                     .action = event::KeyEvent::Action::Press,
                     .modifiers = mods,
-                    .timestamp = static_cast<uint64_t>(GetTickCount64())
+                    .timestamp = messageTimestamp()
                 };
                 
                 window->dispatchEvent(event::Event(evt));
@@ -263,7 +309,7 @@ private:
                     .keyCode = keyCode,
                     .action = action,
                     .modifiers = mods,
-                    .timestamp = static_cast<uint64_t>(GetTickCount64())
+                    .timestamp = messageTimestamp()
                 };
                 
                 window->dispatchEvent(event::Event(evt));
@@ -297,7 +343,7 @@ private:
                     .action = event::MouseButtonEvent::Action::Press,
                     .position = widget::Point<int32_t>(x, y),
                     .modifiers = mods,
-                    .timestamp = static_cast<uint64_t>(GetTickCount64())
+                    .timestamp = messageTimestamp()
                 };
                 
                 window->dispatchEvent(event::Event(evt));
@@ -329,7 +375,7 @@ private:
                     .action = event::MouseButtonEvent::Action::Release,
                     .position = widget::Point<int32_t>(x, y),
                     .modifiers = mods,
-                    .timestamp = static_cast<uint64_t>(GetTickCount64())
+                    .timestamp = messageTimestamp()
                 };
                 
                 window->dispatchEvent(event::Event(evt));
@@ -342,7 +388,14 @@ private:
             case WM_MOUSEMOVE: {
                 if (!pImpl->rootWidget) return 0;
                 
-                static widget::Point<int32_t> lastPos(0, 0);
+                // Ask for WM_MOUSELEAVE so the hover path is cleared when the cursor exits.
+                if (!pImpl->trackingMouseLeave) {
+                    TRACKMOUSEEVENT tme = {};
+                    tme.cbSize = sizeof(tme);
+                    tme.dwFlags = TME_LEAVE;
+                    tme.hwndTrack = hwnd;
+                    pImpl->trackingMouseLeave = TrackMouseEvent(&tme) != FALSE;
+                }
                 
                 int32_t x = GET_X_LPARAM(lp);
                 int32_t y = GET_Y_LPARAM(lp);
@@ -351,16 +404,26 @@ private:
                 if (GetKeyState(VK_SHIFT) & 0x8000) mods |= static_cast<uint32_t>(event::ModifierKey::Shift);
                 if (GetKeyState(VK_MENU) & 0x8000) mods |= static_cast<uint32_t>(event::ModifierKey::Alt);
                 
+                auto& lastPos = pImpl->lastMousePos;
                 event::MouseMoveEvent evt{
                     .position = widget::Point<int32_t>(x, y),
                     .delta = widget::Point<int32_t>(x - lastPos.x, y - lastPos.y),
                     .modifiers = mods,
-                    .timestamp = static_cast<uint64_t>(GetTickCount64())
+                    .timestamp = messageTimestamp()
                 };
                 
                 lastPos = evt.position;
                 
-                window->dispatchEvent(event::Event(evt));
+                // High-rate mice can deliver several moves per frame; the
+                // application loop dispatches them as one (see flushPendingInput).
+                pImpl->queueMouseMove(evt);
+                return 0;
+            }
+
+            case WM_MOUSELEAVE: {
+                pImpl->trackingMouseLeave = false;
+                window->flushPendingInput();
+                pImpl->hover.clear(pImpl->lastMousePos, static_cast<uint64_t>(GetTickCount64()));
                 return 0;
             }
 
@@ -389,7 +452,7 @@ private:
                     .delta = delta,
                     .position = widget::Point<int32_t>(pt.x, pt.y),
                     .modifiers = mods,
-                    .timestamp = static_cast<uint64_t>(GetTickCount64())
+                    .timestamp = messageTimestamp()
                 };
                 
                 window->dispatchEvent(event::Event(evt));
@@ -412,7 +475,7 @@ private:
                 UINT fileCount = DragQueryFileW(hDrop, 0xFFFFFFFF, nullptr, 0);
                 
                 if (fileCount > 0) {
-                    std::vector<std::wstring> files;
+                    std::vector<std::filesystem::path> files;
                     files.reserve(fileCount);
                     
                     // Get each file path
@@ -425,14 +488,19 @@ private:
                         }
                     }
                     
-                    // Create FileDropEvent
-                    event::FileDropEvent evt(
-                        widget::Point<int32_t>(pt.x, pt.y),
-                        files
+                    // The paths live in the payload arena until dispatch returns.
+                    auto fileCountStored = static_cast<uint32_t>(files.size());
+                    event::ScopedPayload payload(
+                        event::PayloadArena::instance().storeFiles(std::move(files))
                     );
+                    event::FileDropEvent evt{
+                        .position = widget::Point<int32_t>(pt.x, pt.y),
+                        .fileCount = fileCountStored,
+                        .payload = payload.get()
+                    };
                     
                     // Dispatch to widget tree
-                    window->dispatchEvent(event::Event(std::move(evt)));
+                    window->dispatchEvent(event::Event(evt));
                 }
                 
                 DragFinish(hDrop);
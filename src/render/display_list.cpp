@@ -0,0 +1,599 @@
+/**
+ * @file display_list.cpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "render/display_list.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace frqs::render {
+
+namespace {
+
+using RectI = widget::Rect<int32_t, uint32_t>;
+
+// ============================================================================
+// HASH & RECT HELPERS
+// ============================================================================
+
+constexpr uint64_t FNV_OFFSET = 14695981039346656037ull;
+constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+inline uint64_t hashBytes(uint64_t h, const void* data, size_t size) noexcept {
+    auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        h ^= bytes[i];
+        h *= FNV_PRIME;
+    }
+    return h;
+}
+
+template <typename T>
+inline uint64_t hashValue(uint64_t h, const T& value) noexcept {
+    return hashBytes(h, &value, sizeof(T));
+}
+
+inline bool isEmptyRect(const RectI& r) noexcept {
+    return r.w == 0 || r.h == 0;
+}
+
+inline int32_t right(const RectI& r) noexcept {
+    return r.x + static_cast<int32_t>(r.w);
+}
+
+inline int32_t bottom(const RectI& r) noexcept {
+    return r.y + static_cast<int32_t>(r.h);
+}
+
+inline RectI unite(const RectI& a, const RectI& b) noexcept {
+    if (isEmptyRect(a)) return b;
+    if (isEmptyRect(b)) return a;
+    int32_t l = std::min(a.x, b.x);
+    int32_t t = std::min(a.y, b.y);
+    int32_t r = std::max(right(a), right(b));
+    int32_t btm = std::max(bottom(a), bottom(b));
+    return RectI(l, t, static_cast<uint32_t>(r - l), static_cast<uint32_t>(btm - t));
+}
+
+inline RectI clipTo(const RectI& a, const RectI& b) noexcept {
+    int32_t l = std::max(a.x, b.x);
+    int32_t t = std::max(a.y, b.y);
+    int32_t r = std::min(right(a), right(b));
+    int32_t btm = std::min(bottom(a), bottom(b));
+    if (r <= l || btm <= t) return RectI(l, t, 0u, 0u);
+    return RectI(l, t, static_cast<uint32_t>(r - l), static_cast<uint32_t>(btm - t));
+}
+
+inline bool overlaps(const RectI& a, const RectI& b) noexcept {
+    return a.x < right(b) && b.x < right(a) && a.y < bottom(b) && b.y < bottom(a);
+}
+
+// Grows a rect to cover stroke overhang and antialiasing fringe.
+inline RectI inflate(const RectI& r, float strokeWidth) noexcept {
+    if (isEmptyRect(r) && strokeWidth <= 0.0f) return r;
+    auto d = static_cast<int32_t>(std::ceil(strokeWidth * 0.5f)) + 1;
+    return RectI(r.x - d, r.y - d, r.w + static_cast<uint32_t>(2 * d), r.h + static_cast<uint32_t>(2 * d));
+}
+
+inline bool isDrawOp(DisplayOp op) noexcept {
+    switch (op) {
+        case DisplayOp::PushClip:
+        case DisplayOp::PopClip:
+        case DisplayOp::Save:
+        case DisplayOp::Restore:
+        case DisplayOp::SetOpacity:
+        case DisplayOp::SetTransform:
+        case DisplayOp::Translate:
+            return false;
+        default:
+            return true;
+    }
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// DISPLAY LIST
+// ============================================================================
+
+void DisplayList::clear() noexcept {
+    commands_.clear();
+    items_.clear();
+    order_.clear();
+    textPool_.clear();
+}
+
+void DisplayList::finalize() {
+    order_.resize(items_.size());
+    for (uint32_t i = 0; i < order_.size(); ++i) {
+        order_[i] = i;
+    }
+    // Ties broken by draw order, so a client drawn several times pairs up in
+    // draw order; unlike std::stable_sort, this needs no temporary buffer.
+    std::sort(order_.begin(), order_.end(), [this](uint32_t a, uint32_t b) {
+        const void* clientA = items_[a].client;
+        const void* clientB = items_[b].client;
+        if (clientA != clientB) return std::less<const void*>{}(clientA, clientB);
+        return a < b;
+    });
+}
+
+void DisplayList::replay(IExtendedRenderer& target, const RectI* clip) const {
+    for (const auto& cmd : commands_) {
+        if (clip && isDrawOp(cmd.op) && !overlaps(cmd.bounds, *clip)) {
+            continue;
+        }
+
+        switch (cmd.op) {
+            case DisplayOp::Clear:
+                target.clear(cmd.color);
+                break;
+            case DisplayOp::DrawRect:
+                target.drawRect(cmd.rect, cmd.color, cmd.params[0]);
+                break;
+            case DisplayOp::FillRect:
+                target.fillRect(cmd.rect, cmd.color);
+                break;
+            case DisplayOp::DrawText:
+                scratchText_.assign(textPool_, cmd.textOffset, cmd.textLength);
+                target.drawText(scratchText_, cmd.rect, cmd.color);
+                break;
+            case DisplayOp::PushClip:
+                target.pushClip(cmd.rect);
+                break;
+            case DisplayOp::PopClip:
+                target.popClip();
+                break;
+            case DisplayOp::DrawLine:
+                target.drawLine(cmd.start, cmd.end, cmd.color, cmd.params[0]);
+                break;
+            case DisplayOp::DrawEllipse:
+                target.drawEllipse(cmd.rect, cmd.color, cmd.params[0]);
+                break;
+            case DisplayOp::FillEllipse:
+                target.fillEllipse(cmd.rect, cmd.color);
+                break;
+            case DisplayOp::DrawRoundedRect:
+                target.drawRoundedRect(cmd.rect, cmd.params[1], cmd.params[2], cmd.color, cmd.params[0]);
+                break;
+            case DisplayOp::FillRoundedRect:
+                target.fillRoundedRect(cmd.rect, cmd.params[1], cmd.params[2], cmd.color);
+                break;
+            case DisplayOp::DrawTextEx:
+                scratchText_.assign(textPool_, cmd.textOffset, cmd.textLength);
+                scratchFont_.family.assign(textPool_, cmd.fontOffset, cmd.fontLength);
+                scratchFont_.size = cmd.fontSize;
+                scratchFont_.bold = (cmd.fontFlags & 0x1) != 0;
+                scratchFont_.italic = (cmd.fontFlags & 0x2) != 0;
+                scratchFont_.underline = (cmd.fontFlags & 0x4) != 0;
+                scratchFont_.strikethrough = (cmd.fontFlags & 0x8) != 0;
+                target.drawTextEx(scratchText_, cmd.rect, cmd.color, scratchFont_, cmd.halign, cmd.valign);
+                break;
+            case DisplayOp::DrawBitmap:
+                target.drawBitmap(cmd.bitmap, cmd.rect, cmd.params[0]);
+                break;
+            case DisplayOp::Save:
+                target.save();
+                break;
+            case DisplayOp::Restore:
+                target.restore();
+                break;
+            case DisplayOp::SetOpacity:
+                target.setOpacity(cmd.params[0]);
+                break;
+            case DisplayOp::SetTransform:
+                target.setTransform(cmd.params[0], cmd.params[1], cmd.params[2],
+                                    cmd.params[3], cmd.params[4], cmd.params[5]);
+                break;
+            case DisplayOp::Translate:
+                target.translate(cmd.params[0], cmd.params[1]);
+                break;
+        }
+    }
+}
+
+size_t DisplayList::diff(const DisplayList& previous, const DisplayList& current,
+                         DirtyRectManager& damage) {
+    size_t changed = 0;
+    auto less = std::less<const void*>{};
+
+    size_t i = 0;
+    size_t j = 0;
+    while (i < previous.order_.size() || j < current.order_.size()) {
+        const DisplayItem* prev = i < previous.order_.size() ? &previous.items_[previous.order_[i]] : nullptr;
+        const DisplayItem* cur = j < current.order_.size() ? &current.items_[current.order_[j]] : nullptr;
+
+        if (prev && cur && prev->client == cur->client) {
+            // Same widget in both frames: damage only if its output changed.
+            if (prev->hash != cur->hash) {
+                if (!isEmptyRect(prev->bounds)) damage.addDirtyRect(prev->bounds);
+                if (!isEmptyRect(cur->bounds)) damage.addDirtyRect(cur->bounds);
+                ++changed;
+            }
+            ++i;
+            ++j;
+        } else if (prev && (!cur || less(prev->client, cur->client))) {
+            // Widget disappeared (removed or hidden).
+            if (!isEmptyRect(prev->bounds)) {
+                damage.addDirtyRect(prev->bounds);
+                ++changed;
+            }
+            ++i;
+        } else {
+            // Widget appeared.
+            if (!isEmptyRect(cur->bounds)) {
+                damage.addDirtyRect(cur->bounds);
+                ++changed;
+            }
+            ++j;
+        }
+
+        if (damage.needsFullRedraw()) break;
+    }
+
+    return changed;
+}
+
+// ============================================================================
+// RECORDER - SESSION
+// ============================================================================
+
+void DisplayListRecorder::begin(DisplayList& list, const RectI& surface) {
+    list_ = &list;
+    list_->clear();
+    surface_ = surface;
+    state_ = TransformState{};
+    stateStack_.clear();
+    clipStack_.clear();
+    itemStack_.clear();
+
+    // Item 0 collects commands issued outside any widget (e.g. the window clear).
+    list_->items_.push_back(DisplayItem{nullptr, FNV_OFFSET, RectI(0, 0, 0u, 0u)});
+    itemStack_.push_back(0);
+}
+
+void DisplayListRecorder::end() {
+    if (list_) {
+        list_->finalize();
+    }
+    list_ = nullptr;
+}
+
+void DisplayListRecorder::beginWidget(const widget::IWidget* widget) {
+    if (!list_) return;
+    auto index = static_cast<uint32_t>(list_->items_.size());
+    list_->items_.push_back(DisplayItem{widget, FNV_OFFSET, RectI(0, 0, 0u, 0u)});
+    itemStack_.push_back(index);
+}
+
+void DisplayListRecorder::endWidget() {
+    if (itemStack_.size() > 1) {
+        itemStack_.pop_back();
+    }
+}
+
+// ============================================================================
+// RECORDER - HELPERS
+// ============================================================================
+
+DisplayCommand& DisplayListRecorder::emit(DisplayOp op) {
+    auto& cmd = list_->commands_.emplace_back();
+    cmd.op = op;
+    cmd.item = itemStack_.back();
+    return cmd;
+}
+
+RectI DisplayListRecorder::toDevice(const RectI& rect) const noexcept {
+    if (state_.complex) {
+        return surface_;
+    }
+    return RectI(
+        rect.x + static_cast<int32_t>(std::lround(state_.tx)),
+        rect.y + static_cast<int32_t>(std::lround(state_.ty)),
+        rect.w,
+        rect.h
+    );
+}
+
+void DisplayListRecorder::commit(DisplayCommand& cmd, const RectI& localBounds) {
+    if (isDrawOp(cmd.op)) {
+        auto device = toDevice(localBounds);
+        device = clipTo(device, clipStack_.empty() ? surface_ : clipStack_.back());
+        cmd.bounds = device;
+    }
+
+    // Fold everything that affects the output into the item's hash. Device
+    // bounds are included so that a moved widget is detected even when its
+    // local drawing calls are identical.
+    uint64_t h = hashValue(FNV_OFFSET, cmd.op);
+    h = hashValue(h, cmd.bounds);
+    h = hashValue(h, cmd.rect);
+    h = hashValue(h, cmd.start);
+    h = hashValue(h, cmd.end);
+    h = hashValue(h, cmd.color);
+    h = hashBytes(h, cmd.params, sizeof(cmd.params));
+    h = hashValue(h, cmd.bitmap);
+    h = hashValue(h, cmd.halign);
+    h = hashValue(h, cmd.valign);
+    h = hashValue(h, cmd.fontFlags);
+    h = hashValue(h, cmd.fontSize);
+    h = hashValue(h, state_.opacity);
+    if (cmd.textLength > 0) {
+        h = hashBytes(h, list_->textPool_.data() + cmd.textOffset, cmd.textLength * sizeof(wchar_t));
+    }
+    if (cmd.fontLength > 0) {
+        h = hashBytes(h, list_->textPool_.data() + cmd.fontOffset, cmd.fontLength * sizeof(wchar_t));
+    }
+
+    auto& item = list_->items_[cmd.item];
+    item.hash = hashValue(item.hash, h) * FNV_PRIME;
+    if (isDrawOp(cmd.op)) {
+        item.bounds = unite(item.bounds, cmd.bounds);
+    }
+}
+
+void DisplayListRecorder::storeText(DisplayCommand& cmd, const std::wstring& text) {
+    cmd.textOffset = static_cast<uint32_t>(list_->textPool_.size());
+    cmd.textLength = static_cast<uint32_t>(text.size());
+    list_->textPool_.append(text);
+}
+
+// ============================================================================
+// RECORDER - BASIC RENDERER INTERFACE
+// ============================================================================
+
+void DisplayListRecorder::clear(const widget::Color& color) {
+    if (!list_) return;
+    auto& cmd = emit(DisplayOp::Clear);
+    cmd.color = color;
+    // Clear ignores the transform but honours the clip.
+    cmd.bounds = clipStack_.empty() ? surface_ : clipStack_.back();
+    auto& item = list_->items_[cmd.item];
+    item.hash = hashValue(hashValue(item.hash, cmd.op), color) * FNV_PRIME;
+    item.bounds = unite(item.bounds, cmd.bounds);
+}
+
+void DisplayListRecorder::drawRect(const RectI& rect, const widget::Color& color, float strokeWidth) {
+    if (!list_) return;
+    auto& cmd = emit(DisplayOp::DrawRect);
+    cmd.rect = rect;
+    cmd.color = color;
+    cmd.params[0] = strokeWidth;
+    commit(cmd, inflate(rect, strokeWidth));
+}
+
+void DisplayListRecorder::fillRect(const RectI& rect, const widget::Color& color) {
+    if (!list_) return;
+    auto& cmd = emit(DisplayOp::FillRect);
+    cmd.rect = rect;
+    cmd.color = color;
+    commit(cmd, inflate(rect, 0.0f));
+}
+
+void DisplayListRecorder::drawText(const std::wstring& text, const RectI& rect, const widget::Color& color) {
+    if (!list_) return;
+    auto& cmd = emit(DisplayOp::DrawText);
+    cmd.rect = rect;
+    cmd.color = color;
+    storeText(cmd, text);
+    commit(cmd, inflate(rect, 0.0f));
+}
+
+void DisplayListRecorder::pushClip(const RectI& rect) {
+    if (!list_) return;
+    auto& cmd = emit(DisplayOp::PushClip);
+    cmd.rect = rect;
+    auto device = toDevice(rect);
+    clipStack_.push_back(clipTo(device, clipStack_.empty() ? surface_ : clipStack_.back()));
+    commit(cmd, rect);
+}
+
+void DisplayListRecorder::popClip() {
+    // An unbalanced pop must not reach the target, which never saw the push.
+    if (!list_ || clipStack_.empty()) return;
+    auto& cmd = emit(DisplayOp::PopClip);
+    clipStack_.pop_back();
+    commit(cmd, RectI(0, 0, 0u, 0u));
+}
+
+// ============================================================================
+// RECORDER - EXTENDED RENDERER INTERFACE
+// ============================================================================
+
+void DisplayListRecorder::drawLine(const widget::Point<int32_t>& start, const widget::Point<int32_t>& end,
+                                   const widget::Color& color, float strokeWidth) {
+    if (!list_) return;
+    auto& cmd = emit(DisplayOp::DrawLine);
+    cmd.start = start;
+    cmd.end = end;
+    cmd.color = color;
+    cmd.params[0] = strokeWidth;
+
+    int32_t l = std::min(start.x, end.x);
+    int32_t t = std::min(start.y, end.y);
+    RectI box(l, t,
+              static_cast<uint32_t>(std::max(start.x, end.x) - l),
+              static_cast<uint32_t>(std::max(start.y, end.y) - t));
+    commit(cmd, inflate(box, strokeWidth));
+}
+
+void DisplayListRecorder::drawEllipse(const RectI& rect, const widget::Color& color, float strokeWidth) {
+    if (!list_) return;
+    auto& cmd = emit(DisplayOp::DrawEllipse);
+    cmd.rect = rect;
+    cmd.color = color;
+    cmd.params[0] = strokeWidth;
+    commit(cmd, inflate(rect, strokeWidth));
+}
+
+void DisplayListRecorder::fillEllipse(const RectI& rect, const widget::Color& color) {
+    if (!list_) return;
+    auto& cmd = emit(DisplayOp::FillEllipse);
+    cmd.rect = rect;
+    cmd.color = color;
+    commit(cmd, inflate(rect, 0.0f));
+}
+
+void DisplayListRecorder::drawRoundedRect(const RectI& rect, float radiusX, float radiusY,
+                                          const widget::Color& color, float strokeWidth) {
+    if (!list_) return;
+    auto& cmd = emit(DisplayOp::DrawRoundedRect);
+    cmd.rect = rect;
+    cmd.color = color;
+    cmd.params[0] = strokeWidth;
+    cmd.params[1] = radiusX;
+    cmd.params[2] = radiusY;
+    commit(cmd, inflate(rect, strokeWidth));
+}
+
+void DisplayListRecorder::fillRoundedRect(const RectI& rect, float radiusX, float radiusY,
+                                          const widget::Color& color) {
+    if (!list_) return;
+    auto& cmd = emit(DisplayOp::FillRoundedRect);
+    cmd.rect = rect;
+    cmd.color = color;
+    cmd.params[1] = radiusX;
+    cmd.params[2] = radiusY;
+    commit(cmd, inflate(rect, 0.0f));
+}
+
+void DisplayListRecorder::drawTextEx(const std::wstring& text, const RectI& rect,
+                                     const widget::Color& color, const FontStyle& font,
+                                     TextAlign halign, VerticalAlign valign) {
+    if (!list_) return;
+    auto& cmd = emit(DisplayOp::DrawTextEx);
+    cmd.rect = rect;
+    cmd.color = color;
+    cmd.halign = halign;
+    cmd.valign = valign;
+    cmd.fontSize = font.size;
+    cmd.fontFlags = static_cast<uint8_t>(
+        (font.bold ? 0x1 : 0) | (font.italic ? 0x2 : 0) |
+        (font.underline ? 0x4 : 0) | (font.strikethrough ? 0x8 : 0));
+    storeText(cmd, text);
+    cmd.fontOffset = static_cast<uint32_t>(list_->textPool_.size());
+    cmd.fontLength = static_cast<uint32_t>(font.family.size());
+    list_->textPool_.append(font.family);
+    commit(cmd, inflate(rect, 0.0f));
+}
+
+void DisplayListRecorder::drawBitmap(void* bitmap, const RectI& destRect, float opacity) {
+    if (!list_) return;
+    auto& cmd = emit(DisplayOp::DrawBitmap);
+    cmd.bitmap = bitmap;
+    cmd.rect = destRect;
+    cmd.params[0] = opacity;
+    commit(cmd, inflate(destRect, 0.0f));
+}
+
+void DisplayListRecorder::save() {
+    if (!list_) return;
+    stateStack_.push_back(state_);
+    commit(emit(DisplayOp::Save), RectI(0, 0, 0u, 0u));
+}
+
+void DisplayListRecorder::restore() {
+    if (!list_) return;
+    if (!stateStack_.empty()) {
+        state_ = stateStack_.back();
+        stateStack_.pop_back();
+    }
+    commit(emit(DisplayOp::Restore), RectI(0, 0, 0u, 0u));
+}
+
+void DisplayListRecorder::setOpacity(float opacity) {
+    if (!list_) return;
+    auto& cmd = emit(DisplayOp::SetOpacity);
+    cmd.params[0] = opacity;
+    state_.opacity = opacity;
+    commit(cmd, RectI(0, 0, 0u, 0u));
+}
+
+void DisplayListRecorder::setTransform(float m11, float m12, float m21, float m22, float dx, float dy) {
+    if (!list_) return;
+    auto& cmd = emit(DisplayOp::SetTransform);
+    cmd.params[0] = m11;
+    cmd.params[1] = m12;
+    cmd.params[2] = m21;
+    cmd.params[3] = m22;
+    cmd.params[4] = dx;
+    cmd.params[5] = dy;
+    state_.tx = dx;
+    state_.ty = dy;
+    state_.complex = (m11 != 1.0f || m12 != 0.0f || m21 != 0.0f || m22 != 1.0f);
+    commit(cmd, RectI(0, 0, 0u, 0u));
+}
+
+void DisplayListRecorder::translate(float dx, float dy) {
+    if (!list_) return;
+    auto& cmd = emit(DisplayOp::Translate);
+    cmd.params[0] = dx;
+    cmd.params[1] = dy;
+    state_.tx += dx;
+    state_.ty += dy;
+    commit(cmd, RectI(0, 0, 0u, 0u));
+}
+
+// ============================================================================
+// RECORDER - TEXT MEASUREMENT (forwarded)
+// ============================================================================
+
+float DisplayListRecorder::measureTextWidth(const std::wstring& text, size_t length,
+                                            const FontStyle& font) const {
+    return backend_ ? backend_->measureTextWidth(text, length, font) : 0.0f;
+}
+
+size_t DisplayListRecorder::getCharPositionFromX(const std::wstring& text, float x,
+                                                 const FontStyle& font) const {
+    return backend_ ? backend_->getCharPositionFromX(text, x, font) : 0;
+}
+
+// ============================================================================
+// DAMAGE TRACKER
+// ============================================================================
+
+void DamageTracker::record(widget::IWidget& root, const RectI& surface, const widget::Color& background) {
+    recorder_.begin(lists_[current_], surface);
+    recorder_.clear(background);
+    recorder_.beginWidget(&root);
+    root.render(recorder_);
+    recorder_.endWidget();
+    recorder_.end();
+}
+
+void DamageTracker::computeDamage(DirtyRectManager& damage) {
+    if (!hasPrevious_) {
+        damage.markFullRedraw();
+        return;
+    }
+    DisplayList::diff(lists_[current_ ^ 1u], lists_[current_], damage);
+}
+
+void DamageTracker::present(IExtendedRenderer& target, const DirtyRectManager& damage) const {
+    const auto& list = lists_[current_];
+
+    if (damage.needsFullRedraw()) {
+        list.replay(target);
+        return;
+    }
+
+    for (const auto& rect : damage.getDirtyRects()) {
+        target.pushClip(rect);
+        list.replay(target, &rect);
+        target.popClip();
+    }
+}
+
+void DamageTracker::commit() noexcept {
+    current_ ^= 1u;
+    hasPrevious_ = true;
+}
+
+} // namespace frqs::render
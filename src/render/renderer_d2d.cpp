@@ -70,16 +70,23 @@ void RendererD2D::beginRender() {
     renderTarget_->BeginDraw();
 }
 
-void RendererD2D::endRender() {
-    if (!renderTarget_ || !inRender_) return;
+bool RendererD2D::endRender() {
+    if (!renderTarget_ || !inRender_) return false;
 
     HRESULT hr = renderTarget_->EndDraw();
+    inRender_ = false;
 
     if (hr == D2DERR_RECREATE_TARGET) {
         recreateDeviceResources();
+        return false;
     }
 
-    inRender_ = false;
+    return SUCCEEDED(hr);
+}
+
+bool RendererD2D::isOccluded() const noexcept {
+    return renderTarget_ &&
+           (renderTarget_->CheckWindowState() & D2D1_WINDOW_STATE_OCCLUDED) != 0;
 }
 
 // ============================================================================
@@ -123,11 +130,7 @@ void RendererD2D::drawText(
 ) {
     if (!renderTarget_) return;
 
-    FontStyle defaultFont;
-    defaultFont.family = L"Segoe UI";
-    defaultFont.size = 14.0f;
-    
-    IDWriteTextFormat* textFormat = ResourceCache::instance().getFont(defaultFont);
+    IDWriteTextFormat* textFormat = ResourceCache::instance().getFont(defaultFont_);
     if (!textFormat) return;
     
     ID2D1SolidColorBrush* brush = ResourceCache::instance().getBrush(color, renderTarget_);
@@ -557,7 +560,8 @@ bool RendererD2D::recreateDeviceResources() {
 
     HRESULT hr = factory_->CreateHwndRenderTarget(
         D2D1::RenderTargetProperties(),
-        D2D1::HwndRenderTargetProperties(hwnd_, size),
+        // Auto-damage redraws only the dirty rects; the rest of the back buffer must survive.
+        D2D1::HwndRenderTargetProperties(hwnd_, size, D2D1_PRESENT_OPTIONS_RETAIN_CONTENTS),
         &renderTarget_
     );
 
@@ -14,6 +14,7 @@
 #include "render/renderer.hpp"
 #include "platform/win32_safe.hpp"
 #include <stack>
+#include <vector>
 
 namespace frqs::render {
 
@@ -32,10 +33,14 @@ private:
     
     // State
     platform::NativeHandle hwnd_;
-    std::stack<widget::Rect<int32_t, uint32_t>> clipStack_;
-    std::stack<D2D1_MATRIX_3X2_F> transformStack_;
+    // Vector-backed stacks: push/pop reuse capacity, no per-frame allocations
+    std::stack<widget::Rect<int32_t, uint32_t>, std::vector<widget::Rect<int32_t, uint32_t>>> clipStack_;
+    std::stack<D2D1_MATRIX_3X2_F, std::vector<D2D1_MATRIX_3X2_F>> transformStack_;
     bool inRender_ = false;
 
+    // Font used by the basic drawText (built once, not per call)
+    FontStyle defaultFont_;
+
 public:
     explicit RendererD2D(platform::NativeHandle hwnd);
     ~RendererD2D() noexcept override;
@@ -49,8 +54,11 @@ public:
     // ========================================================================
 
     void beginRender();
-    void endRender();
+    /** @brief Ends the session and presents. Returns `false` if the target had to be recreated. */
+    bool endRender();
     bool isRendering() const noexcept { return inRender_; }
+    /** @brief Checks if the window is completely covered, so nothing drawn would be seen. */
+    bool isOccluded() const noexcept;
 
     // ========================================================================
     // BASIC RENDERER INTERFACE
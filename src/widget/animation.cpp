@@ -0,0 +1,260 @@
+/**
+ * @file animation.cpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Implementation of frame-clock property tweens.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "widget/animation.hpp"
+#include "core/application.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace frqs::widget {
+
+// ============================================================================
+// EASING
+// ============================================================================
+
+float ease(Easing easing, float t) noexcept {
+    t = std::clamp(t, 0.0f, 1.0f);
+    switch (easing) {
+        case Easing::Linear:
+            return t;
+        case Easing::EaseInQuad:
+            return t * t;
+        case Easing::EaseOutQuad:
+            return t * (2.0f - t);
+        case Easing::EaseInOutQuad:
+            return t < 0.5f ? 2.0f * t * t : 1.0f - 2.0f * (1.0f - t) * (1.0f - t);
+        case Easing::EaseOutCubic: {
+            float u = 1.0f - t;
+            return 1.0f - u * u * u;
+        }
+        case Easing::EaseInOutCubic: {
+            float u = 1.0f - t;
+            return t < 0.5f ? 4.0f * t * t * t : 1.0f - 4.0f * u * u * u;
+        }
+        default:
+            return t;
+    }
+}
+
+// ============================================================================
+// VALUE TRAITS
+// ============================================================================
+
+Color AnimationTraits<Color>::unpack(const AnimationValues& v) noexcept {
+    auto channel = [](double c) {
+        return static_cast<uint8_t>(std::clamp(std::lround(c), 0L, 255L));
+    };
+    return Color(channel(v[0]), channel(v[1]), channel(v[2]), channel(v[3]));
+}
+
+Rect<int32_t, uint32_t> AnimationTraits<Rect<int32_t, uint32_t>>::unpack(const AnimationValues& v) noexcept {
+    return Rect<int32_t, uint32_t>(
+        static_cast<int32_t>(std::lround(v[0])),
+        static_cast<int32_t>(std::lround(v[1])),
+        static_cast<uint32_t>(std::max(0L, std::lround(v[2]))),
+        static_cast<uint32_t>(std::max(0L, std::lround(v[3]))));
+}
+
+// ============================================================================
+// ANIMATOR
+// ============================================================================
+
+Animator* Animator::instance_ = nullptr;
+
+Animator::Animator() {
+    instance_ = this;
+}
+
+Animator::~Animator() {
+    instance_ = nullptr;
+}
+
+Animator& Animator::instance() {
+    static Animator animator;
+    return animator;
+}
+
+void Animator::animateBackgroundColor(Widget& target, const Color& to, const AnimationSpec& spec) {
+    animate(target, AnimatedProperty::BackgroundColor, target.getBackgroundColor(), to, spec,
+            [widget = &target](const Color& color) { widget->setBackgroundColor(color); });
+}
+
+void Animator::animateRect(Widget& target, const Rect<int32_t, uint32_t>& to, const AnimationSpec& spec) {
+    animate(target, AnimatedProperty::Rect, target.getRect(), to, spec,
+            [widget = &target](const Rect<int32_t, uint32_t>& rect) { widget->setRect(rect); });
+}
+
+/**
+ * @internal
+ * @details During a tick the running list must not grow: the applier being
+ *          called lives in it. New tweens wait in `started_`, and a retarget
+ *          retires the old entry instead of overwriting it.
+ */
+void Animator::start(Widget& target, AnimatedProperty property, const AnimationValues& from,
+                     const AnimationValues& to, const AnimationSpec& spec, Applier apply) {
+    if (!target.isAttached() || spec.duration <= std::chrono::milliseconds::zero()) {
+        cancel(target, property);
+        apply(to);
+        return;
+    }
+
+    Animation animation;
+    animation.target = &target;
+    animation.property = property;
+    animation.easing = spec.easing;
+    animation.from = from;
+    animation.to = to;
+    animation.start = Clock::now();
+    animation.duration = spec.duration;
+    animation.apply = std::move(apply);
+
+    if (ticking_) {
+        if (auto* running = find(animations_, &target, property)) {
+            running->target = nullptr;
+        }
+        if (auto* queued = find(started_, &target, property)) {
+            *queued = std::move(animation);
+        } else {
+            started_.push_back(std::move(animation));
+        }
+    } else if (auto* running = find(animations_, &target, property)) {
+        *running = std::move(animation);
+    } else {
+        animations_.push_back(std::move(animation));
+    }
+
+    ensureTicker();
+}
+
+void Animator::ensureTicker() {
+    auto& app = core::Application::instance();
+    if (tickerId_ == 0) {
+        tickerId_ = app.addFrameTicker([this](core::FramePacer::Clock::time_point frameTime) {
+            return tick(frameTime);
+        });
+    }
+    // The ticker may be idle: make sure this frame's animate phase runs at all.
+    app.requestAnimationFrame();
+}
+
+Animator::Animation* Animator::find(std::vector<Animation>& list, const Widget* target,
+                                    AnimatedProperty property) noexcept {
+    for (auto& animation : list) {
+        if (animation.target == target && animation.property == property) {
+            return &animation;
+        }
+    }
+    return nullptr;
+}
+
+bool Animator::cancel(const Widget& target, AnimatedProperty property) noexcept {
+    bool found = false;
+    for (auto* list : {&animations_, &started_}) {
+        if (auto* animation = find(*list, &target, property)) {
+            animation->target = nullptr;
+            found = true;
+        }
+    }
+    if (found && !ticking_) {
+        std::erase_if(animations_, [](const Animation& a) { return a.target == nullptr; });
+    }
+    return found;
+}
+
+void Animator::cancelAll(const Widget* target) noexcept {
+    bool found = false;
+    for (auto* list : {&animations_, &started_}) {
+        for (auto& animation : *list) {
+            if (animation.target == target) {
+                animation.target = nullptr;
+                found = true;
+            }
+        }
+    }
+    if (found && !ticking_) {
+        std::erase_if(animations_, [](const Animation& a) { return a.target == nullptr; });
+    }
+}
+
+void Animator::forget(const Widget* target) noexcept {
+    if (instance_ && (!instance_->animations_.empty() || !instance_->started_.empty())) {
+        instance_->cancelAll(target);
+    }
+}
+
+bool Animator::isAnimatingUnder(const IWidget* root) noexcept {
+    if (!instance_ || !root) return false;
+    auto under = [root](const Animation& a) {
+        for (const IWidget* widget = a.target; widget; widget = widget->getParent()) {
+            if (widget == root) return true;
+        }
+        return false;
+    };
+    return std::ranges::any_of(instance_->animations_, under) ||
+           std::ranges::any_of(instance_->started_, under);
+}
+
+bool Animator::isAnimating(const Widget& target, AnimatedProperty property) const noexcept {
+    auto matches = [&](const Animation& a) { return a.target == &target && a.property == property; };
+    return std::ranges::any_of(animations_, matches) || std::ranges::any_of(started_, matches);
+}
+
+size_t Animator::getActiveCount() const noexcept {
+    auto live = [](const Animation& a) { return a.target != nullptr; };
+    return static_cast<size_t>(std::ranges::count_if(animations_, live) +
+                               std::ranges::count_if(started_, live));
+}
+
+bool Animator::tick(Clock::time_point frameTime) {
+    ticking_ = true;
+    // By index, and re-checking the target after each call: a setter may
+    // cancel any tween, including ones later in the list.
+    for (size_t i = 0; i < animations_.size(); ++i) {
+        auto& animation = animations_[i];
+        if (!animation.target) continue;
+
+        // A frame time before the start (a paced deadline just behind `now`) is progress 0.
+        double progress = 1.0;
+        if (animation.duration > Clock::duration::zero()) {
+            auto elapsed = std::max(frameTime - animation.start, Clock::duration::zero());
+            progress = std::min(1.0, std::chrono::duration<double>(elapsed) /
+                                     std::chrono::duration<double>(animation.duration));
+        }
+
+        bool finished = progress >= 1.0;
+        AnimationValues values = animation.to;
+        if (!finished) {
+            double eased = ease(animation.easing, static_cast<float>(progress));
+            for (size_t c = 0; c < values.size(); ++c) {
+                values[c] = animation.from[c] + (animation.to[c] - animation.from[c]) * eased;
+            }
+        }
+
+        animation.apply(values);
+        if (finished) {
+            animations_[i].target = nullptr;
+        }
+    }
+    ticking_ = false;
+
+    // Compacting moves the survivors down in place; nothing is allocated.
+    std::erase_if(animations_, [](const Animation& a) { return a.target == nullptr; });
+    for (auto& animation : started_) {
+        if (animation.target) {
+            animations_.push_back(std::move(animation));
+        }
+    }
+    started_.clear();
+
+    return !animations_.empty();
+}
+
+} // namespace frqs::widget
@@ -33,6 +33,8 @@ Button::Button(const std::wstring& text)
     , pImpl_(std::make_unique<Impl>())
     , text_(text)
 {
+    setKind(KIND);
+    setEventMask(event::eventMask<event::MouseButtonEvent, event::MouseMoveEvent, event::MouseHoverEvent>);
     font_.size = 14.0f;
     font_.family = L"Segoe UI";
     font_.bold = false;
@@ -67,15 +69,36 @@ void Button::setBorder(const Color& color, float width) noexcept {
 
 /**
  * @brief Updates the button's state and background color, then invalidates it.
+ * @details Entering or leaving the hover state fades the color on the frame
+ *          clock; every other change shows at once.
  */
 
 void Button::setState(State state) noexcept {
     if (state_ == state) return;
+    bool hoverChange = (state_ == State::Normal && state == State::Hovered) ||
+                       (state_ == State::Hovered && state == State::Normal);
     state_ = state;
-    setBackgroundColor(getCurrentColor());
+
+    if (hoverChange) {
+        Animator::instance().animate(*this, AnimatedProperty::BackgroundColor,
+                                     getBackgroundColor(), getCurrentColor(), hoverTransition_,
+                                     [this](const Color& color) { setBackgroundColor(color); });
+    } else {
+        syncBackground();
+    }
     invalidate();
 }
 
+/**
+ * @brief Cancels a running fade and applies the state color.
+ * @internal
+ */
+
+void Button::syncBackground() noexcept {
+    Animator::instance().cancel(*this, AnimatedProperty::BackgroundColor);
+    setBackgroundColor(getCurrentColor());
+}
+
 /**
  * @brief Sets the button's enabled state.
  */
@@ -116,17 +139,19 @@ bool Button::isPointInside(const Point<int32_t>& point) const noexcept {
 
 bool Button::onEvent(const event::Event& event) {
     if (!isEnabled()) return false;
+    switch (event.index()) {
     // Handle mouse button events
-    if (auto* mouseBtn = std::get_if<event::MouseButtonEvent>(&event)) {
-        if (mouseBtn->button == event::MouseButtonEvent::Button::Left) {
-            if (mouseBtn->action == event::MouseButtonEvent::Action::Press) {
-                if (isPointInside(mouseBtn->position)) {
+    case event::eventIndex<event::MouseButtonEvent>: {
+        const auto& mouseBtn = *std::get_if<event::MouseButtonEvent>(&event);
+        if (mouseBtn.button == event::MouseButtonEvent::Button::Left) {
+            if (mouseBtn.action == event::MouseButtonEvent::Action::Press) {
+                if (isPointInside(mouseBtn.position)) {
                     setState(State::Pressed);
                     return true;
                 }
-            } else if (mouseBtn->action == event::MouseButtonEvent::Action::Release) {
+            } else if (mouseBtn.action == event::MouseButtonEvent::Action::Release) {
                 if (state_ == State::Pressed) {
-                    if (isPointInside(mouseBtn->position)) {
+                    if (isPointInside(mouseBtn.position)) {
                         // Button was clicked!
                         if (onClick_) {
                             onClick_();
@@ -139,12 +164,14 @@ bool Button::onEvent(const event::Event& event) {
                 }
             }
         }
+        break;
     }
 
     // Handle mouse move events
-    if (auto* mouseMove = std::get_if<event::MouseMoveEvent>(&event)) {
-        pImpl_->lastMousePos = mouseMove->position;
-        bool inside = isPointInside(mouseMove->position);
+    case event::eventIndex<event::MouseMoveEvent>: {
+        const auto& mouseMove = *std::get_if<event::MouseMoveEvent>(&event);
+        pImpl_->lastMousePos = mouseMove.position;
+        bool inside = isPointInside(mouseMove.position);
         if (state_ == State::Pressed) {
             return true;
         } else if (inside && state_ == State::Normal) {
@@ -154,9 +181,23 @@ bool Button::onEvent(const event::Event& event) {
             setState(State::Normal);
             return true;
         }
+        break;
     }
-    return Widget::onEvent(event);
 
+    // The window tells us when the cursor leaves, even if no further move reaches us.
+    case event::eventIndex<event::MouseHoverEvent>: {
+        const auto& hover = *std::get_if<event::MouseHoverEvent>(&event);
+        if (hover.action == event::MouseHoverEvent::Action::Leave && state_ == State::Hovered) {
+            setState(State::Normal);
+        }
+        return false;
+    }
+
+    default:
+        break;
+    }
+
+    return Widget::onEvent(event);
 }
 
 /**
@@ -166,10 +207,10 @@ bool Button::onEvent(const event::Event& event) {
 void Button::render(Renderer& renderer) {
     if (!isVisible()) return;
     auto rect = getRect();
-    auto bgColor = getCurrentColor();
+    auto bgColor = getBackgroundColor();    // The state color, or a fade towards it
 
     // Try to use extended renderer for rounded corners
-    if (auto* extRenderer = dynamic_cast<render::IExtendedRenderer*>(&renderer)) {
+    if (auto* extRenderer = renderer.getCaps().extended) {
         // Draw rounded rectangle button
         extRenderer->fillRoundedRect(rect, borderRadius_, borderRadius_, bgColor);
         
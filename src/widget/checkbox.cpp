@@ -33,6 +33,8 @@ CheckBox::CheckBox(const std::wstring& text)
     , pImpl_(std::make_unique<Impl>())
     , text_(text)
 {
+    setKind(KIND);
+    setEventMask(event::eventMask<event::MouseButtonEvent, event::MouseMoveEvent, event::MouseHoverEvent>);
     font_.size = 14.0f;
     font_.family = L"Segoe UI";
     setBackgroundColor(colors::Transparent);
@@ -112,17 +114,19 @@ void CheckBox::notifyChanged() {
 bool CheckBox::onEvent(const event::Event& event) {
     if (!enabled_) return false;
 
+    switch (event.index()) {
     // Handle mouse button events for press, release, and toggle logic
-    if (auto* mouseBtn = std::get_if<event::MouseButtonEvent>(&event)) {
-        if (mouseBtn->button == event::MouseButtonEvent::Button::Left) {
-            if (mouseBtn->action == event::MouseButtonEvent::Action::Press) {
-                if (isPointInside(mouseBtn->position)) {
+    case event::eventIndex<event::MouseButtonEvent>: {
+        const auto& mouseBtn = *std::get_if<event::MouseButtonEvent>(&event);
+        if (mouseBtn.button == event::MouseButtonEvent::Button::Left) {
+            if (mouseBtn.action == event::MouseButtonEvent::Action::Press) {
+                if (isPointInside(mouseBtn.position)) {
                     setState(State::Pressed);
                     return true;
                 }
-            } else if (mouseBtn->action == event::MouseButtonEvent::Action::Release) {
+            } else if (mouseBtn.action == event::MouseButtonEvent::Action::Release) {
                 if (state_ == State::Pressed) {
-                    if (isPointInside(mouseBtn->position)) {
+                    if (isPointInside(mouseBtn.position)) {
                         // Toggle the checked state on release inside the widget
                         toggle();
                         setState(State::Hovered);
@@ -134,14 +138,14 @@ bool CheckBox::onEvent(const event::Event& event) {
                 }
             }
         }
+        break;
     }
-    
+
     // Handle mouse move events for hover effects
-    if (auto* mouseMove = std::get_if<event::MouseMoveEvent>(&event)) {
-        pImpl_->lastMousePos = mouseMove->position;
-        
-        bool inside = isPointInside(mouseMove->position);
-        
+    case event::eventIndex<event::MouseMoveEvent>: {
+        const auto& mouseMove = *std::get_if<event::MouseMoveEvent>(&event);
+        pImpl_->lastMousePos = mouseMove.position;
+        bool inside = isPointInside(mouseMove.position);
         if (state_ == State::Pressed) {
             // If pressed, hover state doesn't change until release
             return true;
@@ -152,6 +156,20 @@ bool CheckBox::onEvent(const event::Event& event) {
             setState(State::Normal);
             return true;
         }
+        break;
+    }
+
+    // The window tells us when the cursor leaves, even if no further move reaches us.
+    case event::eventIndex<event::MouseHoverEvent>: {
+        const auto& hover = *std::get_if<event::MouseHoverEvent>(&event);
+        if (hover.action == event::MouseHoverEvent::Action::Leave && state_ == State::Hovered) {
+            setState(State::Normal);
+        }
+        return false;
+    }
+
+    default:
+        break;
     }
 
     return Widget::onEvent(event);
@@ -176,7 +194,7 @@ void CheckBox::render(Renderer& renderer) {
     );
     
     // Use the extended renderer for anti-aliased rounded corners if available
-    if (auto* extRenderer = dynamic_cast<render::IExtendedRenderer*>(&renderer)) {
+    if (auto* extRenderer = renderer.getCaps().extended) {
         // Draw the main box background
         extRenderer->fillRoundedRect(boxRect, borderRadius_, borderRadius_, boxColor_);
         
@@ -32,6 +32,8 @@ ComboBox::ComboBox()
     : Widget()
     , pImpl_(std::make_unique<Impl>())
 {
+    setKind(KIND);
+    setEventMask(event::eventMask<event::MouseButtonEvent>);
     setBackgroundColor(colors::Transparent);
 
     // Create the header button that displays the current selection and toggles the dropdown.
@@ -207,14 +209,16 @@ void ComboBox::render(Renderer& renderer) {
     
     // The header button is the primary visible component when the ComboBox is closed.
     if (headerButton_) {
+        renderer.beginWidget(headerButton_.get());
         headerButton_->render(renderer);
+        renderer.endWidget();
     }
     
     // The dropdown list is rendered only when open. It is rendered after the
     // header button, so it appears on top of it and its siblings.
     if (isOpen_ && dropdownList_) {
         // Save the renderer's state if possible, to isolate drawing the dropdown.
-        auto* extRenderer = dynamic_cast<render::IExtendedRenderer*>(&renderer);
+        auto* extRenderer = renderer.getCaps().extended;
         if (extRenderer) {
             extRenderer->save();
         }
@@ -225,7 +229,9 @@ void ComboBox::render(Renderer& renderer) {
         renderer.drawRect(dropRect, dropdownBorderColor_, borderWidth_);
         
         // Render the list view itself (items, scrollbar, etc.).
+        renderer.beginWidget(dropdownList_.get());
         dropdownList_->render(renderer);
+        renderer.endWidget();
         
         // Restore the renderer's state.
         if (extRenderer) {
@@ -260,7 +266,7 @@ void ComboBox::updateHeaderText() {
     pImpl_->adapter->updateView(selectedIndex_, tempView.get());
     
     // Attempt to cast the view to a Label to get its text.
-    if (auto* label = dynamic_cast<Label*>(tempView.get())) {
+    if (auto* label = widgetCast<Label>(tempView.get())) {
         headerButton_->setText(label->getText());
     } else {
         // Fallback if the view isn't a simple label.
@@ -26,6 +26,8 @@ namespace frqs::widget {
 Container::Container()
     : Widget()
 {
+    setKind(KIND);
+    setPassThroughType(typeid(Container));    // Handles no events itself (exact instances)
     // Default to absolute layout (manual positioning)
     layout_ = std::make_unique<AbsoluteLayout>();
 }
@@ -34,31 +36,27 @@ Container::Container()
  * @brief Sets the layout manager for the container.
  * 
  * The layout manager is responsible for arranging the child widgets within the
- * container. If auto-layout is enabled, the new layout is applied immediately.
+ * container. If auto-layout is enabled, the new layout is scheduled.
  * 
  * @param layout A unique pointer to an object implementing the ILayout interface.
  */
 void Container::setLayout(std::unique_ptr<ILayout> layout) {
     layout_ = std::move(layout);
-    if (autoLayout_) {
-        applyLayout();
-    }
+    invalidateLayout();
 }
 
 /**
  * @brief Sets the padding for the container.
  * 
  * Padding is the space between the container's border and its content.
- * If auto-layout is enabled, the layout is reapplied to account for the new padding.
+ * If auto-layout is enabled, the layout is rescheduled to account for the new padding.
  * 
  * @param padding The padding value to be applied to all sides.
  */
 void Container::setPadding(uint32_t padding) noexcept {
     if (padding_ == padding) return;
     padding_ = padding;
-    if (autoLayout_) {
-        applyLayout();
-    }
+    invalidateLayout();
 }
 
 /**
@@ -86,10 +84,33 @@ void Container::applyLayout() {
     invalidate();
 }
 
+/**
+ * @brief Schedules an automatic layout update.
+ * 
+ * While attached to a window, the update waits for the window's layout pass,
+ * where it runs once however often the container changed in between.
+ * A detached container has no frame to wait for and lays out immediately.
+ */
+void Container::invalidateLayout() {
+    if (!autoLayout_ || !layout_) return;
+    if (!requestLayout()) {
+        applyLayout();
+    }
+}
+
+/**
+ * @brief Runs the scheduled layout update from the window's layout pass.
+ */
+void Container::onLayout() {
+    if (autoLayout_) {
+        applyLayout();
+    }
+}
+
 /**
  * @brief Sets the rectangle (position and size) of the container.
  * 
- * Overrides the base Widget::setRect to also re-apply the layout if auto-layout
+ * Overrides the base Widget::setRect to also schedule the layout if auto-layout
  * is enabled, ensuring children are rearranged correctly when the container is resized.
  * 
  * @param rect The new rectangle for the container.
@@ -97,10 +118,8 @@ void Container::applyLayout() {
 void Container::setRect(const Rect<int32_t, uint32_t>& rect) {
     Widget::setRect(rect);
     
-    // Auto-apply layout when container is resized
-    if (autoLayout_ && layout_) {
-        applyLayout();
-    }
+    // Re-layout when the container is resized (once per frame while attached)
+    invalidateLayout();
 }
 
 /**
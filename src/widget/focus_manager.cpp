@@ -0,0 +1,182 @@
+/**
+ * @file focus_manager.cpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Implementation of keyboard focus tracking and key routing.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "widget/focus_manager.hpp"
+#include <algorithm>
+
+namespace frqs::widget {
+
+// ============================================================================
+// FOCUS CHANGES
+// ============================================================================
+
+bool FocusManager::setFocus(const std::shared_ptr<IWidget>& root, IWidget* widget) {
+    if (focused_.get() == widget) return false;
+
+    std::shared_ptr<IWidget> next;
+    if (widget) {
+        next = findOwner(root, widget);
+        if (!next) return false;              // Not part of this tree
+    }
+
+    // Swap first so handlers that query focus see the new state.
+    auto previous = std::move(focused_);
+    focused_ = std::move(next);
+
+    if (previous) {
+        notify(*previous, event::FocusEvent::Action::Lost);
+    }
+    if (focused_) {
+        notify(*focused_, event::FocusEvent::Action::Gained);
+    }
+    return true;
+}
+
+void FocusManager::clearFocus() {
+    if (!focused_) return;
+    auto previous = std::move(focused_);
+    notify(*previous, event::FocusEvent::Action::Lost);
+}
+
+void FocusManager::focusFromPointer(const std::shared_ptr<IWidget>& root, IWidget* target) {
+    IWidget* owner = target;
+    while (owner && !canFocus(owner)) {
+        owner = owner->getParent();
+    }
+    if (owner) {
+        setFocus(root, owner);
+    } else {
+        clearFocus();
+    }
+}
+
+// ============================================================================
+// KEY ROUTING
+// ============================================================================
+
+bool FocusManager::dispatchKey(const std::shared_ptr<IWidget>& root, const event::Event& event) {
+    if (!root) return false;
+
+    // A focused widget that was removed or hidden no longer receives keys.
+    if (focused_ && (!isAttached(focused_.get(), root.get()) || !focused_->isVisible())) {
+        clearFocus();
+    }
+
+    IWidget* target = focused_ ? focused_.get() : root.get();
+    for (IWidget* current = target; current != nullptr; current = current->getParent()) {
+        if (current->wantsEvent(event) && current->onEvent(event)) return true;
+    }
+
+    // Nobody consumed it: Tab / Shift+Tab navigate.
+    if (auto* key = std::get_if<event::KeyEvent>(&event)) {
+        bool isChar = (key->modifiers & 0x80000000) != 0;
+        bool pressed = key->action == event::KeyEvent::Action::Press ||
+                       key->action == event::KeyEvent::Action::Repeat;
+        bool plain = !event::hasModifier(key->modifiers, event::ModifierKey::Control) &&
+                     !event::hasModifier(key->modifiers, event::ModifierKey::Alt);
+        if (!isChar && pressed && plain && key->keyCode == static_cast<uint32_t>(event::KeyCode::Tab)) {
+            return focusNext(root, event::hasModifier(key->modifiers, event::ModifierKey::Shift));
+        }
+    }
+    return false;
+}
+
+// ============================================================================
+// TAB ORDER
+// ============================================================================
+
+/**
+ * @brief Moves focus along the tab order.
+ *
+ * The order is rebuilt on every call: Tab presses arrive at human speed, and
+ * a fresh walk is always consistent with the current tree. Widgets with a
+ * positive tab index come first (ascending), then index 0 in tree order;
+ * negative indices are focusable by click only.
+ */
+bool FocusManager::focusNext(const std::shared_ptr<IWidget>& root, bool backward) {
+    if (!root) return false;
+
+    tabScratch_.clear();
+    collectTabOrder(root);
+    if (tabScratch_.empty()) {
+        return false;
+    }
+
+    auto rank = [](const std::shared_ptr<IWidget>& w) {
+        int32_t index = asWidget(w.get())->getTabIndex();
+        return index > 0 ? index : INT32_MAX;
+    };
+    std::stable_sort(tabScratch_.begin(), tabScratch_.end(),
+                     [&](const auto& a, const auto& b) { return rank(a) < rank(b); });
+
+    auto it = std::find(tabScratch_.begin(), tabScratch_.end(), focused_);
+    size_t count = tabScratch_.size();
+    size_t next;
+    if (it == tabScratch_.end()) {
+        next = backward ? count - 1 : 0;
+    } else {
+        size_t current = static_cast<size_t>(it - tabScratch_.begin());
+        next = backward ? (current + count - 1) % count : (current + 1) % count;
+    }
+
+    auto target = tabScratch_[next];
+    tabScratch_.clear();                      // Do not keep widgets alive
+    return setFocus(root, target.get());
+}
+
+void FocusManager::collectTabOrder(const std::shared_ptr<IWidget>& widget) {
+    if (!widget->isVisible()) return;
+    if (canFocus(widget.get()) && asWidget(widget.get())->getTabIndex() >= 0) {
+        tabScratch_.push_back(widget);
+    }
+    for (const auto& child : widget->getChildren()) {
+        collectTabOrder(child);
+    }
+}
+
+// ============================================================================
+// INTERNAL HELPERS
+// ============================================================================
+
+bool FocusManager::isAttached(const IWidget* widget, const IWidget* root) noexcept {
+    for (const IWidget* current = widget; current != nullptr; current = current->getParent()) {
+        if (current == root) return true;
+    }
+    return false;
+}
+
+void FocusManager::notify(IWidget& widget, event::FocusEvent::Action action) {
+    if (widget.getEventMask() & event::eventMask<event::FocusEvent>) {
+        widget.onEvent(event::Event(event::FocusEvent{action}));
+    }
+}
+
+bool FocusManager::canFocus(IWidget* widget) noexcept {
+    auto* w = asWidget(widget);
+    return w && w->isFocusable() && w->isVisible();
+}
+
+/**
+ * @brief Finds the owning reference of `widget` through its parent's child list.
+ */
+std::shared_ptr<IWidget> FocusManager::findOwner(const std::shared_ptr<IWidget>& root, IWidget* widget) {
+    if (!root || !widget) return nullptr;
+    if (widget == root.get()) return root;
+    if (!isAttached(widget, root.get())) return nullptr;
+
+    IWidget* parent = widget->getParent();
+    const auto& siblings = parent->getChildren();
+    auto it = std::find_if(siblings.begin(), siblings.end(),
+                           [widget](const auto& child) { return child.get() == widget; });
+    return it != siblings.end() ? *it : nullptr;
+}
+
+} // namespace frqs::widget
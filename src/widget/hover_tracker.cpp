@@ -0,0 +1,198 @@
+/**
+ * @file hover_tracker.cpp
+ * @author zuudevs (zuudevs@gmail.com)
+ * @brief Implementation of the hover-path cache.
+ * @version 0.1
+ * @date 2025-12-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+
+#include "widget/hover_tracker.hpp"
+#include <algorithm>
+
+namespace frqs::widget {
+
+namespace {
+
+using RectType = Rect<int32_t, uint32_t>;
+
+bool containsPoint(const RectType& rect, const Point<int32_t>& point) noexcept {
+    return point.x >= rect.x && static_cast<int64_t>(point.x) < static_cast<int64_t>(rect.x) + rect.w &&
+           point.y >= rect.y && static_cast<int64_t>(point.y) < static_cast<int64_t>(rect.y) + rect.h;
+}
+
+RectType intersect(const RectType& a, const RectType& b) noexcept {
+    int64_t left = std::max<int64_t>(a.x, b.x);
+    int64_t top = std::max<int64_t>(a.y, b.y);
+    int64_t right = std::min<int64_t>(static_cast<int64_t>(a.x) + a.w, static_cast<int64_t>(b.x) + b.w);
+    int64_t bottom = std::min<int64_t>(static_cast<int64_t>(a.y) + a.h, static_cast<int64_t>(b.y) + b.h);
+    if (right <= left || bottom <= top) return RectType();
+    return RectType(static_cast<int32_t>(left), static_cast<int32_t>(top),
+                    static_cast<uint32_t>(right - left), static_cast<uint32_t>(bottom - top));
+}
+
+bool overlaps(const RectType& a, const RectType& b) noexcept {
+    auto r = intersect(a, b);
+    return r.w > 0 && r.h > 0;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// RESOLUTION
+// ============================================================================
+
+IWidget* HoverTracker::update(const std::shared_ptr<IWidget>& root, const Point<int32_t>& position,
+                              uint64_t epoch, uint64_t timestamp) {
+    if (!root) {
+        clear(position, timestamp);
+        return nullptr;
+    }
+
+    // Fast path: same tree, cursor still over the unobstructed part of the leaf.
+    if (fastValid_ && epoch == epoch_ && path_.front() == root && containsPoint(fastRect_, position)) {
+        ++fastHits_;
+        return path_.back().get();
+    }
+
+    ++fullHits_;
+    epoch_ = epoch;
+    buildPath(root, root->hitTest(position));
+    transition(position, timestamp);
+    computeFastRect();
+    return getHovered();
+}
+
+void HoverTracker::clear(const Point<int32_t>& position, uint64_t timestamp) {
+    nextPath_.clear();
+    transition(position, timestamp);
+    fastValid_ = false;
+}
+
+bool HoverTracker::isHovered(const IWidget* widget) const noexcept {
+    return std::any_of(path_.begin(), path_.end(),
+                       [widget](const auto& entry) { return entry.get() == widget; });
+}
+
+// ============================================================================
+// INTERNAL HELPERS
+// ============================================================================
+
+/**
+ * @brief Builds `nextPath_` (root to `target`) with owning references.
+ *
+ * The unchanged prefix is taken from the current path; only new levels look
+ * their widget up in the parent's child list.
+ */
+void HoverTracker::buildPath(const std::shared_ptr<IWidget>& root, IWidget* target) {
+    nextPath_.clear();
+    chain_.clear();
+    if (!target) return;
+
+    for (IWidget* w = target; w; w = w->getParent()) {
+        chain_.push_back(w);
+        if (w == root.get()) break;
+    }
+    if (chain_.back() != root.get()) return;   // Target is not part of this tree
+
+    nextPath_.push_back(root);
+    bool samePrefix = !path_.empty() && path_.front() == root;
+
+    for (size_t i = chain_.size() - 1; i-- > 0;) {
+        IWidget* wanted = chain_[i];
+        size_t depth = nextPath_.size();
+
+        if (samePrefix && depth < path_.size() && path_[depth].get() == wanted) {
+            nextPath_.push_back(path_[depth]);
+            continue;
+        }
+        samePrefix = false;
+
+        const auto& siblings = nextPath_.back()->getChildren();
+        auto it = std::find_if(siblings.begin(), siblings.end(),
+                               [wanted](const auto& child) { return child.get() == wanted; });
+        if (it == siblings.end()) break;      // Not reachable through getChildren(); stop here
+        nextPath_.push_back(*it);
+    }
+}
+
+/**
+ * @brief Diffs the current and next path, sends Leave (deepest first) and Enter (outermost first).
+ */
+void HoverTracker::transition(const Point<int32_t>& position, uint64_t timestamp) {
+    size_t common = 0;
+    size_t limit = std::min(path_.size(), nextPath_.size());
+    while (common < limit && path_[common] == nextPath_[common]) {
+        ++common;
+    }
+
+    // Swap first so handlers observe the new hover state; `nextPath_` keeps
+    // the old widgets alive until their Leave has been delivered.
+    path_.swap(nextPath_);
+
+    event::MouseHoverEvent hover{
+        .action = event::MouseHoverEvent::Action::Leave,
+        .position = position,
+        .timestamp = timestamp
+    };
+    constexpr auto interest = event::eventMask<event::MouseHoverEvent>;
+    for (size_t i = nextPath_.size(); i-- > common;) {
+        if (nextPath_[i]->getEventMask() & interest) {
+            nextPath_[i]->onEvent(event::Event(hover));
+        }
+    }
+
+    hover.action = event::MouseHoverEvent::Action::Enter;
+    for (size_t i = common; i < path_.size(); ++i) {
+        if (path_[i]->getEventMask() & interest) {
+            path_[i]->onEvent(event::Event(hover));
+        }
+    }
+
+    nextPath_.clear();
+}
+
+/**
+ * @brief Computes the region where the cached leaf is guaranteed to be the hit result.
+ *
+ * The leaf rect is clipped by every ancestor and rejected if any later (higher
+ * z-order) sibling along the path overlaps it. Paths through widgets with their
+ * own hit-testing (custom widgets, scroll views) never take the fast path.
+ */
+void HoverTracker::computeFastRect() {
+    fastValid_ = false;
+    if (path_.empty()) return;
+
+    IWidget* leaf = path_.back().get();
+    if (!leaf->getChildren().empty()) return;
+
+    RectType region = leaf->getRect();
+    for (size_t i = path_.size(); i-- > 0;) {
+        IWidget* current = path_[i].get();
+        auto kind = current->getKind();
+        if (kind == WidgetKind::Custom || kind == WidgetKind::ScrollView) return;
+
+        region = intersect(region, current->getRect());
+        if (region.w == 0 || region.h == 0) return;
+        if (i == 0) break;
+
+        auto* parent = asWidget(path_[i - 1].get());
+        if (!parent) return;
+        const auto& siblings = parent->getChildren();
+        if (siblings.size() >= parent->getHitIndexThreshold()) return;  // Indexed: hit test is cheap anyway
+
+        auto it = std::find_if(siblings.begin(), siblings.end(),
+                               [current](const auto& child) { return child.get() == current; });
+        if (it == siblings.end()) return;
+        for (++it; it != siblings.end(); ++it) {
+            if ((*it)->isVisible() && overlaps((*it)->getRect(), region)) return;
+        }
+    }
+
+    fastRect_ = region;
+    fastValid_ = true;
+}
+
+} // namespace frqs::widget
@@ -12,6 +12,7 @@
 #include "widget/image.hpp"
 #include "render/renderer.hpp"
 #include "render/renderer_d2d.hpp"  // Full header for dynamic_cast
+#include "render/display_list.hpp"
 
 namespace frqs::widget {
 
@@ -40,6 +41,8 @@ Image::Image(const std::wstring& path)
     , pImpl_(std::make_unique<Impl>())
     , imagePath_(path)
 {
+    setKind(KIND);
+    setPassThroughType(typeid(Image));    // Handles no events itself (exact instances)
     setBackgroundColor(colors::Transparent);
 }
 
@@ -82,6 +85,16 @@ void Image::setOpacity(float opacity) noexcept {
     invalidate();
 }
 
+/**
+ * @brief Tweens the opacity from its current value.
+ * @param opacity The opacity to end on.
+ * @param spec Duration and easing of the fade.
+ */
+void Image::fadeTo(float opacity, const AnimationSpec& spec) {
+    Animator::instance().animate(*this, AnimatedProperty::Opacity, opacity_, std::clamp(opacity, 0.0f, 1.0f), spec,
+                                 [this](float value) { setOpacity(value); });
+}
+
 /**
  * @brief Loads the bitmap from the specified path using the given renderer.
  * @details This is an internal method called by the rendering pipeline.
@@ -99,6 +112,12 @@ void Image::loadBitmap(Renderer& renderer) {
     auto* extRenderer = dynamic_cast<render::IExtendedRenderer*>(&renderer);
     if (!extRenderer) return;
     
+    // When the window records a display list, load through the real backend
+    if (auto* recorder = dynamic_cast<render::DisplayListRecorder*>(extRenderer)) {
+        extRenderer = recorder->getBackend();
+        if (!extRenderer) return;
+    }
+    
     // Cast to RendererD2D to access loadBitmapFromFile
     auto* d2dRenderer = dynamic_cast<render::RendererD2D*>(extRenderer);
     if (!d2dRenderer) return;
@@ -217,7 +236,7 @@ void Image::render(Renderer& renderer) {
         auto destRect = calculateDestRect();
         
         // Try to use extended renderer
-        if (auto* extRenderer = dynamic_cast<render::IExtendedRenderer*>(&renderer)) {
+        if (auto* extRenderer = renderer.getCaps().extended) {
             extRenderer->drawBitmap(bitmap_, destRect, opacity_);
         }
     }
@@ -20,6 +20,8 @@ Label::Label(const std::wstring& text)
     : Widget()
     , text_(text)  // One-time copy during construction
 {
+    setKind(KIND);
+    setPassThroughType(typeid(Label));    // Handles no events itself (exact instances)
     font_.size = 14.0f;
     font_.family = L"Segoe UI";
     setBackgroundColor(colors::Transparent);
@@ -102,7 +104,7 @@ void Label::render(Renderer& renderer) {
     if (rect.w == 0 || rect.h == 0) return;
 
     // Use extended renderer for alignment features if available
-    if (auto* extRenderer = dynamic_cast<render::IExtendedRenderer*>(&renderer)) {
+    if (auto* extRenderer = renderer.getCaps().extended) {
         extRenderer->drawTextEx(
             text_, 
             rect, 
@@ -6,6 +6,7 @@
 
 #include "widget/layout.hpp"
 #include "widget/widget.hpp" // Wajib ada untuk akses setRect/getRect dan LayoutProps
+#include "core/frame_arena.hpp"
 #include <cmath>
 #include <algorithm>
 
@@ -57,7 +58,11 @@ void FlexLayout::apply(IWidget* parent) {
     if (crossSize > 2 * padding_) crossSize -= 2 * padding_; else crossSize = 0;
 
     // 1. Kumpulkan anak-anak yang visible dan hitung total weight
-    std::vector<ChildInfo> activeChildren;
+    // Scratch list dari frame arena (tanpa heap allocation per frame)
+    auto& arena = core::FrameArena::forCurrentThread();
+    core::FrameArena::Scope arenaScope(arena);
+    core::ArenaVector<ChildInfo> activeChildren{core::ArenaAllocator<ChildInfo>(arena)};
+    activeChildren.reserve(parent->getChildren().size());
     float totalWeight = 0.0f;
     uint32_t totalFixedSize = 0;
     
@@ -66,7 +71,7 @@ void FlexLayout::apply(IWidget* parent) {
 
         ChildInfo info;
         info.widget = child.get();
-        info.typedWidget = dynamic_cast<Widget*>(child.get());
+        info.typedWidget = asWidget(child.get());
         info.isVisible = true;
 
         // Ambil LayoutProps (Safe fallback kalau bukan Widget)
@@ -39,6 +39,8 @@ ListView::ListView()
     : Widget()
     , pImpl_(std::make_unique<Impl>())
 {
+    setKind(KIND);
+    setEventMask(event::eventMask<event::MouseWheelEvent, event::MouseButtonEvent, event::MouseMoveEvent, event::MouseHoverEvent>);
     setBackgroundColor(colors::White);
 }
 
@@ -214,19 +216,34 @@ void ListView::setRect(const Rect<int32_t, uint32_t>& rect) {
  * @return `true` if the event was handled, `false` otherwise.
  */
 bool ListView::onEvent(const event::Event& event) {
+    switch (event.index()) {
     // Mouse wheel
-    if (auto* wheelEvt = std::get_if<event::MouseWheelEvent>(&event)) {
-        if (handleMouseWheel(*wheelEvt)) return true;
-    }
+    case event::eventIndex<event::MouseWheelEvent>:
+        if (handleMouseWheel(*std::get_if<event::MouseWheelEvent>(&event))) return true;
+        break;
     
     // Mouse button
-    if (auto* btnEvt = std::get_if<event::MouseButtonEvent>(&event)) {
-        if (handleMouseButton(*btnEvt)) return true;
-    }
+    case event::eventIndex<event::MouseButtonEvent>:
+        if (handleMouseButton(*std::get_if<event::MouseButtonEvent>(&event))) return true;
+        break;
     
     // Mouse move
-    if (auto* moveEvt = std::get_if<event::MouseMoveEvent>(&event)) {
-        if (handleMouseMove(*moveEvt)) return true;
+    case event::eventIndex<event::MouseMoveEvent>:
+        if (handleMouseMove(*std::get_if<event::MouseMoveEvent>(&event))) return true;
+        break;
+    
+    // Cursor left the list: drop the scrollbar highlight
+    case event::eventIndex<event::MouseHoverEvent>: {
+        const auto& hover = *std::get_if<event::MouseHoverEvent>(&event);
+        if (hover.action == event::MouseHoverEvent::Action::Leave && hoveringScrollbar_) {
+            hoveringScrollbar_ = false;
+            invalidate();
+        }
+        return false;
+    }
+    
+    default:
+        break;
     }
     
     return Widget::onEvent(event);
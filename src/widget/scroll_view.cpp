@@ -23,6 +23,8 @@ namespace frqs::widget {
  * @brief Constructs a new ScrollView widget.
  */
 ScrollView::ScrollView() : Widget() {
+    setKind(KIND);
+    setEventMask(event::eventMask<event::MouseWheelEvent, event::MouseButtonEvent, event::MouseMoveEvent, event::MouseHoverEvent>);
     setBackgroundColor(colors::White);
 }
 
@@ -62,8 +64,37 @@ void ScrollView::setContent(std::shared_ptr<IWidget> content) {
  * @param y The vertical scroll offset.
  */
 void ScrollView::scrollTo(float x, float y) {
-    scrollOffset_.x = x;
-    scrollOffset_.y = y;
+    Animator::instance().cancel(*this, AnimatedProperty::ScrollOffset);
+    applyScrollOffset(Point<float>(x, y));
+}
+
+/**
+ * @brief Glides to a specific offset over a few frames.
+ *
+ * The target is clamped up front, so the glide never stalls against the end
+ * of the content.
+ *
+ * @param x The horizontal scroll offset.
+ * @param y The vertical scroll offset.
+ * @param spec Duration and easing of the glide.
+ */
+void ScrollView::animateScrollTo(float x, float y, const AnimationSpec& spec) {
+    auto current = scrollOffset_;
+    scrollOffset_ = Point<float>(x, y);
+    clampScrollOffset();
+    auto target = scrollOffset_;
+    scrollOffset_ = current;
+
+    Animator::instance().animate(*this, AnimatedProperty::ScrollOffset, current, target, spec,
+                                 [this](const Point<float>& offset) { applyScrollOffset(offset); });
+}
+
+/**
+ * @brief Sets and clamps the offset, then repaints the view.
+ * @internal
+ */
+void ScrollView::applyScrollOffset(const Point<float>& offset) {
+    scrollOffset_ = offset;
     clampScrollOffset();
     invalidate();
 }
@@ -74,6 +105,7 @@ void ScrollView::scrollTo(float x, float y) {
  * @param dy The change in vertical scroll offset.
  */
 void ScrollView::scrollBy(float dx, float dy) {
+    Animator::instance().cancel(*this, AnimatedProperty::ScrollOffset);
     scrollOffset_.x += dx;
     scrollOffset_.y += dy;
     clampScrollOffset();
@@ -164,28 +196,34 @@ void ScrollView::setRect(const Rect<int32_t, uint32_t>& rect) {
  * @return `true` if the event was handled by the scroll view itself (e.g., scrollbar interaction), `false` otherwise.
  */
 bool ScrollView::onEvent(const event::Event& event) {
+    switch (event.index()) {
     // Mouse wheel
-    if (auto* wheelEvt = std::get_if<event::MouseWheelEvent>(&event)) {
-        if (handleMouseWheel(*wheelEvt)) {
-            return true;
-        }
-    }
+    case event::eventIndex<event::MouseWheelEvent>:
+        return handleMouseWheel(*std::get_if<event::MouseWheelEvent>(&event));
 
     // Mouse button (for dragging scrollbars)
-    if (auto* btnEvt = std::get_if<event::MouseButtonEvent>(&event)) {
-        if (handleMouseButton(*btnEvt)) {
-            return true;
-        }
-    }
+    case event::eventIndex<event::MouseButtonEvent>:
+        return handleMouseButton(*std::get_if<event::MouseButtonEvent>(&event));
 
     // Mouse move (for dragging + hover)
-    if (auto* moveEvt = std::get_if<event::MouseMoveEvent>(&event)) {
-        if (handleMouseMove(*moveEvt)) {
-            return true;
+    case event::eventIndex<event::MouseMoveEvent>:
+        return handleMouseMove(*std::get_if<event::MouseMoveEvent>(&event));
+
+    // Cursor left the view: drop the scrollbar highlights
+    case event::eventIndex<event::MouseHoverEvent>: {
+        const auto& hover = *std::get_if<event::MouseHoverEvent>(&event);
+        if (hover.action == event::MouseHoverEvent::Action::Leave &&
+            (hoveringVScroll_ || hoveringHScroll_)) {
+            hoveringVScroll_ = false;
+            hoveringHScroll_ = false;
+            invalidate();
         }
+        return false;
     }
 
-    return false;
+    default:
+        return false;
+    }
 }
 
 // ============================================================================
@@ -255,7 +293,7 @@ bool ScrollView::handleMouseButton(const event::MouseButtonEvent& evt) {
             float ratio = static_cast<float>(evt.position.y - vScrollbar.y) / vScrollbar.h;
             auto viewport = getViewportRect();
             float maxScroll = std::max(0.0f, static_cast<float>(contentSize_.h - viewport.h));
-            scrollTo(scrollOffset_.x, ratio * maxScroll);
+            animateScrollTo(scrollOffset_.x, ratio * maxScroll, jumpTransition_);
             return true;
         }
         
@@ -267,7 +305,7 @@ bool ScrollView::handleMouseButton(const event::MouseButtonEvent& evt) {
             float ratio = static_cast<float>(evt.position.x - hScrollbar.x) / hScrollbar.w;
             auto viewport = getViewportRect();
             float maxScroll = std::max(0.0f, static_cast<float>(contentSize_.w - viewport.w));
-            scrollTo(ratio * maxScroll, scrollOffset_.y);
+            animateScrollTo(ratio * maxScroll, scrollOffset_.y, jumpTransition_);
             return true;
         }
         
@@ -367,10 +405,12 @@ void ScrollView::render(Renderer& renderer) {
     }
 
     // ✅ CRITICAL FIX: Proper transform stack management
-    auto* extRenderer = dynamic_cast<render::IExtendedRenderer*>(&renderer);
+    auto* extRenderer = renderer.getCaps().extended;
     if (!extRenderer) {
         // Fallback: render without transform
+        renderer.beginWidget(content_.get());
         content_->render(renderer);
+        renderer.endWidget();
         renderScrollbars(renderer);
         return;
     }
@@ -385,7 +425,9 @@ void ScrollView::render(Renderer& renderer) {
     extRenderer->translate(-scrollOffset_.x, -scrollOffset_.y);
     
     // 4. Render content (transformed)
+    renderer.beginWidget(content_.get());
     content_->render(renderer);
+    renderer.endWidget();
     
     // 5. Restore transform
     extRenderer->restore();
@@ -42,6 +42,8 @@ Slider::Slider(Orientation orientation)
     , pImpl_(std::make_unique<Impl>())
     , orientation_(orientation)
 {
+    setKind(KIND);
+    setEventMask(event::eventMask<event::MouseButtonEvent, event::MouseMoveEvent, event::MouseHoverEvent>);
     setBackgroundColor(colors::Transparent);
 }
 
@@ -58,10 +60,32 @@ Slider::~Slider() = default;
  * @param value The new value to set.
  */
 void Slider::setValue(double value) {
+    Animator::instance().cancel(*this, AnimatedProperty::SliderValue);
+
     // Clamp and snap to step
     value = std::clamp(value, minValue_, maxValue_);
     value = snapToStep(value);
-    
+    applyValue(value);
+}
+
+/**
+ * @brief Glides the current value towards a new one.
+ * @param value The value to end on; clamped and snapped to a step.
+ * @param spec Duration and easing of the glide.
+ */
+void Slider::animateValueTo(double value, const AnimationSpec& spec) {
+    value = snapToStep(std::clamp(value, minValue_, maxValue_));
+    Animator::instance().animate(*this, AnimatedProperty::SliderValue, value_, value, spec,
+                                 [this](double current) { applyValue(current); });
+}
+
+/**
+ * @brief Stores the value (kept inside the range) and invalidates the slider.
+ * @param value The new value.
+ * @internal
+ */
+void Slider::applyValue(double value) {
+    value = std::clamp(value, minValue_, maxValue_);
     if (std::abs(value_ - value) < 1e-10) return;
     
     value_ = value;
@@ -250,15 +274,25 @@ bool Slider::handleMouseMove(const event::MouseMoveEvent& evt) {
  * @return `true` if the event was handled, `false` otherwise.
  */
 bool Slider::onEvent(const event::Event& event) {
-    if (auto* mouseBtn = std::get_if<event::MouseButtonEvent>(&event)) {
-        return handleMouseButton(*mouseBtn);
-    }
+    switch (event.index()) {
+    case event::eventIndex<event::MouseButtonEvent>:
+        return handleMouseButton(*std::get_if<event::MouseButtonEvent>(&event));
     
-    if (auto* mouseMove = std::get_if<event::MouseMoveEvent>(&event)) {
-        return handleMouseMove(*mouseMove);
+    case event::eventIndex<event::MouseMoveEvent>:
+        return handleMouseMove(*std::get_if<event::MouseMoveEvent>(&event));
+    
+    case event::eventIndex<event::MouseHoverEvent>: {
+        const auto& hover = *std::get_if<event::MouseHoverEvent>(&event);
+        if (hover.action == event::MouseHoverEvent::Action::Leave && hovered_) {
+            hovered_ = false;
+            invalidate();
+        }
+        return false;
     }
     
-    return Widget::onEvent(event);
+    default:
+        return Widget::onEvent(event);
+    }
 }
 
 /**
@@ -288,7 +322,7 @@ void Slider::render(Renderer& renderer) {
         );
         
         // Track background
-        if (auto* extRenderer = dynamic_cast<render::IExtendedRenderer*>(&renderer)) {
+        if (auto* extRenderer = renderer.getCaps().extended) {
             extRenderer->fillRoundedRect(trackRect, trackHeight_ / 2, trackHeight_ / 2, trackColor_);
             extRenderer->fillRoundedRect(fillRect, trackHeight_ / 2, trackHeight_ / 2, fillColor_);
         } else {
@@ -309,7 +343,7 @@ void Slider::render(Renderer& renderer) {
         );
         
         // Track background
-        if (auto* extRenderer = dynamic_cast<render::IExtendedRenderer*>(&renderer)) {
+        if (auto* extRenderer = renderer.getCaps().extended) {
             extRenderer->fillRoundedRect(trackRect, trackHeight_ / 2, trackHeight_ / 2, trackColor_);
             extRenderer->fillRoundedRect(fillRect, trackHeight_ / 2, trackHeight_ / 2, fillColor_);
         } else {
@@ -328,7 +362,7 @@ void Slider::render(Renderer& renderer) {
     
     Color currentThumbColor = (hovered_ || dragging_) ? thumbHoverColor_ : thumbColor_;
     
-    if (auto* extRenderer = dynamic_cast<render::IExtendedRenderer*>(&renderer)) {
+    if (auto* extRenderer = renderer.getCaps().extended) {
         extRenderer->fillEllipse(thumbRect, currentThumbColor);
         extRenderer->drawEllipse(thumbRect, thumbBorderColor_, thumbBorderWidth_);
     } else {
@@ -48,6 +48,9 @@ TextInput::TextInput()
     : Widget()
     , pImpl_(std::make_unique<Impl>()) 
 {
+    setKind(KIND);
+    setEventMask(event::eventMask<event::MouseButtonEvent, event::MouseMoveEvent, event::KeyEvent, event::FocusEvent>);
+    setFocusable(true);
     font_.size = 14.0f;
     font_.family = L"Segoe UI";
     setBackgroundColor(backgroundColor_);
@@ -171,9 +174,24 @@ void TextInput::deleteSelection() {
 
 /**
  * @brief Sets the focus state of the text input.
+ *
+ * When attached to a window the request goes through the window's focus
+ * manager, so any previously focused widget is told it lost focus.
+ *
  * @param focus `true` to give focus, `false` to remove focus.
  */
 void TextInput::setFocus(bool focus) {
+    bool routed = focus ? requestFocus() : releaseFocus();
+    if (!routed || (!focus && focused_)) {
+        applyFocus(focus);                    // Detached, or focused before it was attached
+    }
+}
+
+/**
+ * @brief Updates the visual focus state; called for `FocusEvent`s.
+ * @internal
+ */
+void TextInput::applyFocus(bool focus) {
     if (focused_ == focus) return;
     
     focused_ = focus;
@@ -610,19 +628,23 @@ default:
  */
 bool TextInput::onEvent(const event::Event& event) {
     try {
-        if (auto* mouseBtn = std::get_if<event::MouseButtonEvent>(&event)) {
-            return handleMouseEvent(*mouseBtn);
-        }
+        switch (event.index()) {
+        case event::eventIndex<event::MouseButtonEvent>:
+            return handleMouseEvent(*std::get_if<event::MouseButtonEvent>(&event));
         
-        if (auto* mouseMove = std::get_if<event::MouseMoveEvent>(&event)) {
-            return handleMouseMove(*mouseMove);
-        }
+        case event::eventIndex<event::MouseMoveEvent>:
+            return handleMouseMove(*std::get_if<event::MouseMoveEvent>(&event));
         
-        if (auto* keyEvt = std::get_if<event::KeyEvent>(&event)) {
-            return handleKeyEvent(*keyEvt);
-        }
+        case event::eventIndex<event::KeyEvent>:
+            return handleKeyEvent(*std::get_if<event::KeyEvent>(&event));
         
-        return Widget::onEvent(event);
+        case event::eventIndex<event::FocusEvent>:
+            applyFocus(std::get_if<event::FocusEvent>(&event)->action == event::FocusEvent::Action::Gained);
+            return true;
+        
+        default:
+            return Widget::onEvent(event);
+        }
     } catch (...) {
         return false;
     }
@@ -642,7 +664,7 @@ void TextInput::render(Renderer& renderer) {
     try {
         // ✅ Cache extended renderer for measurement
         if (!pImpl_->extRenderer) {
-            pImpl_->extRenderer = dynamic_cast<render::IExtendedRenderer*>(&renderer);
+            pImpl_->extRenderer = renderer.getCaps().extended;
         }
         
         auto rect = getRect();
@@ -653,7 +675,7 @@ void TextInput::render(Renderer& renderer) {
         // Border
         Color currentBorderColor = focused_ ? focusColor_ : borderColor_;
         
-        if (auto* extRenderer = dynamic_cast<render::IExtendedRenderer*>(&renderer)) {
+        if (auto* extRenderer = renderer.getCaps().extended) {
             extRenderer->drawRoundedRect(rect, borderRadius_, borderRadius_, 
                                         currentBorderColor, borderWidth_);
         } else {
@@ -697,7 +719,7 @@ void TextInput::render(Renderer& renderer) {
         
         // Render text or placeholder
         if (text_.empty() && !focused_) {
-            if (auto* extRenderer = dynamic_cast<render::IExtendedRenderer*>(&renderer)) {
+            if (auto* extRenderer = renderer.getCaps().extended) {
                 extRenderer->drawTextEx(
                     placeholder_, 
                     textRect,
@@ -710,7 +732,7 @@ void TextInput::render(Renderer& renderer) {
                 renderer.drawText(placeholder_, textRect, placeholderColor_);
             }
         } else if (!text_.empty()) {
-            if (auto* extRenderer = dynamic_cast<render::IExtendedRenderer*>(&renderer)) {
+            if (auto* extRenderer = renderer.getCaps().extended) {
                 extRenderer->drawTextEx(
                     text_, 
                     textRect,
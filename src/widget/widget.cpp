@@ -10,8 +10,9 @@
  */
 
 #include "widget/iwidget.hpp"
-#include "core/window.hpp"
-#include "platform/win32_safe.hpp"
+#include "widget/animation.hpp"
+#include "widget/invalidation_sink.hpp"
+#include "widget/spatial_index.hpp"
 #include <algorithm>
 
 namespace frqs::widget {
@@ -34,25 +35,100 @@ struct Widget::Impl {
     bool visible = true;
     IWidget* parent = nullptr;
     std::vector<std::shared_ptr<IWidget>> children;
-    HWND windowHandle = nullptr;
+    InvalidationSink* sink = nullptr;          ///< Cached on attach; null while detached.
+    const std::type_info* passThroughType = nullptr;  ///< Checked once, on the first attach.
+    bool layoutRequested = false;              ///< Queued in the sink's layout pass.
+    
+    // Per-frame invalidation dedupe
+    uint64_t invalidGeneration = UINT64_MAX;
+    Rect<int32_t, uint32_t> invalidRect;
     
     // Layout properties
     LayoutProps layoutProps;
     
+    // Keyboard focus
+    bool focusable = false;
+    int32_t tabIndex = 0;
+    
+    // Hit-test index (built lazily once the child count reaches the threshold)
+    std::unique_ptr<SpatialGrid> hitIndex;
+    bool hitIndexValid = false;
+    size_t hitIndexThreshold = DEFAULT_HIT_INDEX_THRESHOLD;
+    
     Impl() = default;
     
     /**
-     * @brief Recursively finds the top-level window handle.
-     * @return The HWND of the window containing this widget, or nullptr if not in a window.
+     * @brief Recomputes `widget`'s subtree event mask and walks up while it changes.
      */
-    HWND getWindowHandle() {
-        if (windowHandle) return windowHandle;
-        if (parent) {
-            if (auto* parentWidget = dynamic_cast<Widget*>(parent)) {
-                return parentWidget->pImpl_->getWindowHandle();
+    static void refreshEventMasks(Widget* widget) noexcept {
+        while (widget) {
+            event::EventMask subtree = widget->getEventMask();
+            for (const auto& child : widget->pImpl_->children) {
+                subtree |= child->getSubtreeEventMask();
             }
+            if (subtree == widget->getSubtreeEventMask()) return;
+            widget->storeEventMasks(widget->getEventMask(), subtree);
+            widget = asWidget(widget->pImpl_->parent);
         }
-        return nullptr;
+    }
+    
+    /**
+     * @brief Drops the mask of an exact pass-through type to nothing, once the type is complete.
+     */
+    static void resolvePassThrough(Widget* widget) noexcept {
+        auto& impl = *widget->pImpl_;
+        if (!impl.passThroughType) return;
+        if (typeid(*widget) == *impl.passThroughType &&
+            widget->getEventMask() == event::EVENT_MASK_ALL) {
+            widget->setEventMask(event::EVENT_MASK_NONE);
+        }
+        impl.passThroughType = nullptr;
+    }
+    
+    /**
+     * @brief Forwards a repaint request to the sink, dropping exact repeats within a frame.
+     */
+    void postInvalidation(const Rect<int32_t, uint32_t>& area) noexcept {
+        if (!sink || area.w == 0 || area.h == 0) return;
+        
+        uint64_t generation = sink->getGeneration();
+        if (generation == invalidGeneration && area == invalidRect) return;
+        
+        invalidGeneration = generation;
+        invalidRect = area;
+        sink->invalidateRect(area);
+    }
+    
+    /** @brief Tells the sink that hit-test results may have changed. */
+    void noteTreeChanged() noexcept {
+        if (sink) {
+            sink->noteTreeChanged();
+        }
+    }
+    
+    /**
+     * @brief Keeps the hit-test index in sync when a child moves.
+     */
+    void onChildMoved(IWidget* child, const Rect<int32_t, uint32_t>& oldRect,
+                      const Rect<int32_t, uint32_t>& newRect) {
+        if (hitIndexValid && !hitIndex->update(child, oldRect, newRect)) {
+            hitIndexValid = false;
+        }
+    }
+    
+    /**
+     * @brief Hit-tests the children through the spatial index, (re)building it if stale.
+     */
+    IWidget* indexedHitTest(const Point<int32_t>& point) {
+        if (!hitIndex) {
+            hitIndex = std::make_unique<SpatialGrid>();
+        }
+        if (!hitIndexValid) {
+            // Only Widgets report their moves; anything else is checked on every query.
+            hitIndex->build(rect, children, [](IWidget* child) { return asWidget(child) != nullptr; });
+            hitIndexValid = true;
+        }
+        return hitIndex->hitTest(point);
     }
 };
 
@@ -63,12 +139,20 @@ struct Widget::Impl {
 /**
  * @brief Constructs a new Widget.
  */
-Widget::Widget() : pImpl_(std::make_unique<Impl>()) {}
+Widget::Widget() : pImpl_(std::make_unique<Impl>()) {
+    setKind(KIND);
+}
 
 /**
  * @brief Destroys the Widget.
  */
-Widget::~Widget() noexcept = default;
+Widget::~Widget() noexcept {
+    // The window's layout queue and the animator hold raw pointers.
+    if (pImpl_ && pImpl_->sink && pImpl_->layoutRequested) {
+        pImpl_->sink->cancelLayout(this);
+    }
+    Animator::forget(this);
+}
 
 /**
  * @brief Move constructor for Widget.
@@ -91,8 +175,18 @@ Widget& Widget::operator=(Widget&& other) noexcept = default;
 void Widget::setRect(const Rect<int32_t, uint32_t>& rect) {
     if (pImpl_->rect == rect) return;
     
+    // Repaint the uncovered area as well; the sink merges both into one region.
+    invalidate();
+    auto oldRect = pImpl_->rect;
     pImpl_->rect = rect;
     invalidate();
+    pImpl_->noteTreeChanged();
+    
+    // Our own index covers our bounds; children re-enter it on the next hit test.
+    pImpl_->hitIndexValid = false;
+    if (auto* parentWidget = asWidget(pImpl_->parent)) {
+        parentWidget->pImpl_->onChildMoved(this, oldRect, rect);
+    }
 }
 
 /**
@@ -112,6 +206,7 @@ void Widget::setVisible(bool visible) noexcept {
     
     pImpl_->visible = visible;
     invalidate();
+    pImpl_->noteTreeChanged();
 }
 
 /**
@@ -147,7 +242,15 @@ IWidget* Widget::hitTest(const Point<int32_t>& point) {
         return nullptr;
     }
     
-    // 3. Test children in REVERSE order (top-most first in Z-order)
+    // 3. Large child lists: only look at the children in the grid cell under the point
+    if (pImpl_->children.size() >= pImpl_->hitIndexThreshold) {
+        if (auto* result = pImpl_->indexedHitTest(point)) {
+            return result;
+        }
+        return this;
+    }
+    
+    // 4. Test children in REVERSE order (top-most first in Z-order)
     for (auto it = pImpl_->children.rbegin(); it != pImpl_->children.rend(); ++it) {
         auto* result = (*it)->hitTest(point);
         if (result) {
@@ -155,7 +258,7 @@ IWidget* Widget::hitTest(const Point<int32_t>& point) {
         }
     }
     
-    // 4. No child was hit, so this widget is the target
+    // 5. No child was hit, so this widget is the target
     return this;
 }
 
@@ -198,7 +301,9 @@ void Widget::render(Renderer& renderer) {
     // Render children
     for (auto& child : pImpl_->children) {
         if (child->isVisible()) {
+            renderer.beginWidget(child.get());
             child->render(renderer);
+            renderer.endWidget();
         }
     }
 }
@@ -214,16 +319,26 @@ void Widget::render(Renderer& renderer) {
 void Widget::addChild(std::shared_ptr<IWidget> child) {
     if (!child) return;
 
-    if (auto* childWidget = dynamic_cast<Widget*>(child.get())) {
+    if (auto* childWidget = asWidget(child.get())) {
         if (childWidget->pImpl_->parent) {
             childWidget->pImpl_->parent->removeChild(child.get());
         }
         childWidget->pImpl_->parent = this;
-        childWidget->pImpl_->windowHandle = pImpl_->getWindowHandle();
+        internal::setWidgetInvalidationSink(childWidget, pImpl_->sink);
+    }
+
+    if (pImpl_->hitIndexValid) {
+        if (asWidget(child.get())) {
+            pImpl_->hitIndex->insert(child.get(), static_cast<uint32_t>(pImpl_->children.size()), child->getRect());
+        } else {
+            pImpl_->hitIndexValid = false;
+        }
     }
 
     pImpl_->children.push_back(std::move(child));
+    Impl::refreshEventMasks(this);
     invalidate();
+    pImpl_->noteTreeChanged();
 }
 
 /**
@@ -237,12 +352,15 @@ void Widget::removeChild(IWidget* child) {
         [child](const auto& ptr) { return ptr.get() == child; });
 
     if (it != pImpl_->children.end()) {
-        if (auto* childWidget = dynamic_cast<Widget*>(child)) {
+        if (auto* childWidget = asWidget(child)) {
             childWidget->pImpl_->parent = nullptr;
-            childWidget->pImpl_->windowHandle = nullptr;
+            internal::setWidgetInvalidationSink(childWidget, nullptr);
         }
         pImpl_->children.erase(it);
+        pImpl_->hitIndexValid = false;  // Z-orders behind the removed child shifted
+        Impl::refreshEventMasks(this);
         invalidate();
+        pImpl_->noteTreeChanged();
     }
 }
 
@@ -262,6 +380,128 @@ IWidget* Widget::getParent() const noexcept {
     return pImpl_->parent;
 }
 
+/**
+ * @brief Sets the child count at which hit-testing switches to a spatial index.
+ * @param count The threshold. Use `SIZE_MAX` to always scan linearly.
+ */
+void Widget::setHitIndexThreshold(size_t count) noexcept {
+    pImpl_->hitIndexThreshold = count;
+    if (pImpl_->children.size() < count) {
+        pImpl_->hitIndex.reset();
+        pImpl_->hitIndexValid = false;
+    }
+}
+
+/** @brief Gets the hit-test index threshold. @return The child count threshold. */
+size_t Widget::getHitIndexThreshold() const noexcept {
+    return pImpl_->hitIndexThreshold;
+}
+
+// ============================================================================
+// EVENT INTEREST
+// ============================================================================
+
+/**
+ * @brief Declares which event types this widget handles.
+ * @param mask The new interest mask; ancestors' subtree masks are updated.
+ */
+void Widget::setEventMask(event::EventMask mask) noexcept {
+    if (mask == getEventMask()) return;
+    storeEventMasks(mask, getSubtreeEventMask());
+    Impl::refreshEventMasks(this);
+}
+
+/**
+ * @brief Defers narrowing the mask until attach, when `typeid(*this)` is the final type.
+ */
+void Widget::setPassThroughType(const std::type_info& type) noexcept {
+    pImpl_->passThroughType = &type;
+}
+
+// ============================================================================
+// KEYBOARD FOCUS
+// ============================================================================
+
+/** @brief Marks the widget as focusable. @param focusable Whether it can take focus. */
+void Widget::setFocusable(bool focusable) noexcept {
+    pImpl_->focusable = focusable;
+}
+
+/** @brief Checks if the widget can take keyboard focus. */
+bool Widget::isFocusable() const noexcept {
+    return pImpl_->focusable;
+}
+
+/** @brief Sets the tab index. @param index The position in the Tab order. */
+void Widget::setTabIndex(int32_t index) noexcept {
+    pImpl_->tabIndex = index;
+}
+
+/** @brief Gets the tab index. */
+int32_t Widget::getTabIndex() const noexcept {
+    return pImpl_->tabIndex;
+}
+
+/**
+ * @brief Requests keyboard focus from the owning window.
+ * @return `true` if the widget is attached to a window.
+ */
+bool Widget::requestFocus() {
+    if (!pImpl_->sink) return false;
+    pImpl_->sink->requestFocus(this);
+    return true;
+}
+
+/**
+ * @brief Releases keyboard focus through the owning window.
+ * @return `true` if the widget is attached to a window.
+ */
+bool Widget::releaseFocus() {
+    if (!pImpl_->sink) return false;
+    pImpl_->sink->releaseFocus(this);
+    return true;
+}
+
+// ============================================================================
+// DEFERRED LAYOUT
+// ============================================================================
+
+/**
+ * @brief Checks if an invalidation sink (a window) is cached.
+ */
+bool Widget::isAttached() const noexcept {
+    return pImpl_->sink != nullptr;
+}
+
+/**
+ * @brief Queues this widget in the owning window's layout pass.
+ * @return `true` if the widget is attached to a window.
+ */
+bool Widget::requestLayout() {
+    if (!pImpl_->sink) return false;
+    if (!pImpl_->layoutRequested) {
+        pImpl_->layoutRequested = true;
+        pImpl_->sink->requestLayout(this);
+    }
+    return true;
+}
+
+/**
+ * @brief Checks if a layout request is pending.
+ */
+bool Widget::isLayoutRequested() const noexcept {
+    return pImpl_->layoutRequested;
+}
+
+/**
+ * @brief Clears the pending request and lays out the children.
+ */
+void Widget::performLayout() {
+    // Cleared first: a layout that resizes this widget again queues a new pass.
+    pImpl_->layoutRequested = false;
+    onLayout();
+}
+
 // ============================================================================
 // LAYOUT PROPERTIES
 // ============================================================================
@@ -275,7 +515,7 @@ void Widget::setLayoutWeight(float weight) noexcept {
     pImpl_->layoutProps.weight = weight;
     
     if (pImpl_->parent) {
-        if (auto* parentWidget = dynamic_cast<Widget*>(pImpl_->parent)) {
+        if (auto* parentWidget = asWidget(pImpl_->parent)) {
             parentWidget->invalidate();
         }
     }
@@ -291,7 +531,7 @@ void Widget::setMinSize(int32_t width, int32_t height) noexcept {
     pImpl_->layoutProps.minWidth = width;
     pImpl_->layoutProps.minHeight = height;
     if (pImpl_->parent) {
-        if (auto* parentWidget = dynamic_cast<Widget*>(pImpl_->parent)) {
+        if (auto* parentWidget = asWidget(pImpl_->parent)) {
             parentWidget->invalidate();
         }
     }
@@ -302,7 +542,7 @@ void Widget::setMaxSize(int32_t width, int32_t height) noexcept {
     pImpl_->layoutProps.maxWidth = width;
     pImpl_->layoutProps.maxHeight = height;
     if (pImpl_->parent) {
-        if (auto* parentWidget = dynamic_cast<Widget*>(pImpl_->parent)) {
+        if (auto* parentWidget = asWidget(pImpl_->parent)) {
             parentWidget->invalidate();
         }
     }
@@ -312,7 +552,7 @@ void Widget::setMaxSize(int32_t width, int32_t height) noexcept {
 void Widget::setMinWidth(int32_t width) noexcept {
     pImpl_->layoutProps.minWidth = width;
     if (pImpl_->parent) {
-        if (auto* parentWidget = dynamic_cast<Widget*>(pImpl_->parent)) {
+        if (auto* parentWidget = asWidget(pImpl_->parent)) {
             parentWidget->invalidate();
         }
     }
@@ -322,7 +562,7 @@ void Widget::setMinWidth(int32_t width) noexcept {
 void Widget::setMaxWidth(int32_t width) noexcept {
     pImpl_->layoutProps.maxWidth = width;
     if (pImpl_->parent) {
-        if (auto* parentWidget = dynamic_cast<Widget*>(pImpl_->parent)) {
+        if (auto* parentWidget = asWidget(pImpl_->parent)) {
             parentWidget->invalidate();
         }
     }
@@ -332,7 +572,7 @@ void Widget::setMaxWidth(int32_t width) noexcept {
 void Widget::setMinHeight(int32_t height) noexcept {
     pImpl_->layoutProps.minHeight = height;
     if (pImpl_->parent) {
-        if (auto* parentWidget = dynamic_cast<Widget*>(pImpl_->parent)) {
+        if (auto* parentWidget = asWidget(pImpl_->parent)) {
             parentWidget->invalidate();
         }
     }
@@ -342,7 +582,7 @@ void Widget::setMinHeight(int32_t height) noexcept {
 void Widget::setMaxHeight(int32_t height) noexcept {
     pImpl_->layoutProps.maxHeight = height;
     if (pImpl_->parent) {
-        if (auto* parentWidget = dynamic_cast<Widget*>(pImpl_->parent)) {
+        if (auto* parentWidget = asWidget(pImpl_->parent)) {
             parentWidget->invalidate();
         }
     }
@@ -353,7 +593,7 @@ void Widget::setAlignSelf(LayoutProps::Align align) noexcept {
     if (pImpl_->layoutProps.alignSelf == align) return;
     pImpl_->layoutProps.alignSelf = align;
     if (pImpl_->parent) {
-        if (auto* parentWidget = dynamic_cast<Widget*>(pImpl_->parent)) {
+        if (auto* parentWidget = asWidget(pImpl_->parent)) {
             parentWidget->invalidate();
         }
     }
@@ -403,38 +643,19 @@ Color Widget::getBackgroundColor() const noexcept {
 
 /**
  * @brief Invalidates the entire widget area, queuing it for a repaint.
+ * @details The request is deferred to the window's invalidation sink and
+ *          coalesced with the rest of the frame's damage.
  */
 void Widget::invalidate() noexcept {
-    HWND hwnd = pImpl_->getWindowHandle();
-    if (!hwnd) return;
-    
-    auto rect = pImpl_->rect;
-    RECT r = {
-        static_cast<LONG>(rect.x),
-        static_cast<LONG>(rect.y),
-        static_cast<LONG>(rect.getRight()),
-        static_cast<LONG>(rect.getBottom())
-    };
-    
-    InvalidateRect(hwnd, &r, FALSE);
+    pImpl_->postInvalidation(pImpl_->rect);
 }
 
 /**
  * @brief Invalidates a specific rectangular area within the widget, queuing it for a repaint.
- * @param rect The rectangle to invalidate, in parent-relative coordinates.
+ * @param rect The rectangle to invalidate, in window coordinates.
  */
 void Widget::invalidateRect(const Rect<int32_t, uint32_t>& rect) noexcept {
-    HWND hwnd = pImpl_->getWindowHandle();
-    if (!hwnd) return;
-    
-    RECT r = {
-        static_cast<LONG>(rect.x),
-        static_cast<LONG>(rect.y),
-        static_cast<LONG>(rect.getRight()),
-        static_cast<LONG>(rect.getBottom())
-    };
-    
-    InvalidateRect(hwnd, &r, FALSE);
+    pImpl_->postInvalidation(rect);
 }
 
 /**
@@ -442,18 +663,30 @@ void Widget::invalidateRect(const Rect<int32_t, uint32_t>& rect) noexcept {
  */
 namespace internal {
     /**
-     * @brief Sets the window handle for a widget and all its children recursively.
+     * @brief Attaches a widget and all its children to an invalidation sink.
      * @param widget The widget to start from.
-     * @param hwnd The window handle (as a void pointer).
+     * @param sink The owning window's sink, or nullptr to detach.
      * @internal
      */
-    void setWidgetWindowHandle(Widget* widget, void* hwnd) {
+    void setWidgetInvalidationSink(Widget* widget, InvalidationSink* sink) {
         if (!widget) return;
-        widget->pImpl_->windowHandle = static_cast<HWND>(hwnd);
+        auto& impl = *widget->pImpl_;
+        if (impl.layoutRequested && impl.sink != sink) {
+            // The request moves with the widget; a detached widget lays out on its next change.
+            impl.sink->cancelLayout(widget);
+            impl.layoutRequested = false;
+            if (sink) {
+                impl.layoutRequested = true;
+                sink->requestLayout(widget);
+            }
+        }
+        impl.sink = sink;
+        impl.invalidGeneration = UINT64_MAX;
+        Widget::Impl::resolvePassThrough(widget);
         
         for (auto& child : widget->pImpl_->children) {
-            if (auto* childWidget = dynamic_cast<Widget*>(child.get())) {
-                setWidgetWindowHandle(childWidget, hwnd);
+            if (auto* childWidget = asWidget(child.get())) {
+                setWidgetInvalidationSink(childWidget, sink);
             }
         }
     }
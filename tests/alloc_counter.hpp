@@ -0,0 +1,60 @@
+// tests/alloc_counter.hpp - Global operator new replacement that counts allocations
+//
+// Replaces every non-aligned form of the global allocation functions (single
+// and array, throwing and nothrow), all over malloc/free, so whichever form a
+// library picks pairs with a matching delete. Include from exactly one source
+// file of a test executable: replacement functions must be defined once.
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// ============================================================================
+// GLOBAL ALLOCATION COUNTER (test hook)
+// ============================================================================
+
+namespace {
+    std::atomic<bool> g_counting{false};
+    std::atomic<size_t> g_allocations{0};
+
+    void* countedAlloc(std::size_t size) noexcept {
+        if (g_counting.load(std::memory_order_relaxed)) {
+            g_allocations.fetch_add(1, std::memory_order_relaxed);
+        }
+        return std::malloc(size ? size : 1);
+    }
+}
+
+void* operator new(std::size_t size) {
+    if (void* p = countedAlloc(size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    if (void* p = countedAlloc(size)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return countedAlloc(size); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+
+/**
+ * @brief Counts global allocations performed by `fn`.
+ */
+template <typename Fn>
+size_t countAllocations(Fn&& fn) {
+    g_allocations.store(0);
+    g_counting.store(true);
+    fn();
+    g_counting.store(false);
+    return g_allocations.load();
+}
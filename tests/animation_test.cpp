@@ -0,0 +1,285 @@
+// tests/animation_test.cpp - Property tweens on the frame clock
+#include "frqs-widget.hpp"
+#include "platform/event_loop_backend.hpp"
+#include "widget/animation.hpp"
+#include "widget/internal.hpp"
+#include "widget/invalidation_sink.hpp"
+#include "alloc_counter.hpp"
+#include <memory>
+#include <print>
+
+using namespace frqs;
+using namespace frqs::widget;
+using namespace std::chrono;
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        std::println(stderr, "Assertion failed: {}", #cond); \
+        std::terminate(); \
+    }
+
+#define ASSERT_EQ(a, b) \
+    if ((a) != (b)) { \
+        std::println(stderr, "Assertion failed: {} != {}", #a, #b); \
+        std::println(stderr, "  Expected: {}", b); \
+        std::println(stderr, "  Got: {}", a); \
+        std::terminate(); \
+    }
+
+// ============================================================================
+// COUNTING SINK
+// ============================================================================
+
+/**
+ * @brief Stands in for a window: counts the rects widgets invalidate.
+ */
+class CountingSink final : public InvalidationSink {
+public:
+    int rects = 0;
+    int fullRepaints = 0;
+
+    void invalidateRect(const Rect<int32_t, uint32_t>&) noexcept override { ++rects; }
+    void invalidateAll() noexcept override { ++fullRepaints; }
+    uint64_t getGeneration() const noexcept override { return 0; }
+    void requestFocus(IWidget*) override {}
+    void releaseFocus(IWidget*) override {}
+    void requestLayout(Widget*) override {}
+    void cancelLayout(Widget*) noexcept override {}
+};
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void test_easing_endpoints() {
+    std::println("TEST: Every easing curve starts at 0 and ends at 1");
+
+    for (auto easing : {Easing::Linear, Easing::EaseInQuad, Easing::EaseOutQuad,
+                        Easing::EaseInOutQuad, Easing::EaseOutCubic, Easing::EaseInOutCubic}) {
+        ASSERT_EQ(ease(easing, 0.0f), 0.0f);
+        ASSERT_EQ(ease(easing, 1.0f), 1.0f);
+        float mid = ease(easing, 0.5f);
+        ASSERT_TRUE(mid > 0.0f && mid < 1.0f);
+    }
+    ASSERT_EQ(ease(Easing::EaseOutCubic, 2.0f), 1.0f);   // Clamped
+    std::println("  ✓ Curves pinned at both ends\n");
+}
+
+void test_detached_widget_snaps() {
+    std::println("TEST: A widget outside a window jumps straight to the target");
+
+    Button button(L"Detached");
+    button.setState(Button::State::Hovered);
+    ASSERT_TRUE(button.getBackgroundColor() == Color(41, 128, 185));
+    ASSERT_EQ(Animator::instance().getActiveCount(), size_t{0});
+    std::println("  ✓ No tween without a window\n");
+}
+
+void test_button_hover_fades() {
+    std::println("TEST: Hovering a button fades its color and repaints only the button");
+
+    CountingSink sink;
+    auto& animator = Animator::instance();
+    auto button = std::make_shared<Button>(L"Hover me");
+    button->setRect(Rect<int32_t, uint32_t>(0, 0, 80, 30));
+    internal::setWidgetInvalidationSink(button.get(), &sink);
+
+    Color normal(52, 152, 219);
+    Color hovered(41, 128, 185);
+    auto start = steady_clock::now();
+    button->setState(Button::State::Hovered);
+    ASSERT_TRUE(animator.isAnimating(*button, AnimatedProperty::BackgroundColor));
+    ASSERT_TRUE(button->getBackgroundColor() == normal);
+
+    animator.tick(start + milliseconds(60));
+    auto mid = button->getBackgroundColor();
+    ASSERT_TRUE(mid.r < normal.r && mid.r > hovered.r);
+    ASSERT_TRUE(sink.rects > 0);
+
+    // Leaving half-way turns around from the color on screen.
+    button->setState(Button::State::Normal);
+    animator.tick(steady_clock::now());
+    ASSERT_TRUE(button->getBackgroundColor().r >= mid.r);
+
+    ASSERT_TRUE(!animator.tick(steady_clock::now() + seconds(1)));
+    ASSERT_TRUE(button->getBackgroundColor() == normal);
+    ASSERT_EQ(animator.getActiveCount(), size_t{0});
+    ASSERT_EQ(sink.fullRepaints, 0);
+
+    // Pressing shows at once.
+    button->setState(Button::State::Pressed);
+    ASSERT_TRUE(!animator.isAnimating(*button, AnimatedProperty::BackgroundColor));
+    ASSERT_TRUE(button->getBackgroundColor() == Color(21, 101, 192));
+
+    internal::setWidgetInvalidationSink(button.get(), nullptr);
+    std::println("  ✓ Faded over {} rect invalidations, no full repaint\n", sink.rects);
+}
+
+void test_finished_tweens_drop_without_allocating() {
+    std::println("TEST: Ticking and dropping finished tweens does not allocate");
+
+    constexpr int WIDGETS = 32;
+    CountingSink sink;
+    auto& animator = Animator::instance();
+    std::vector<std::shared_ptr<Widget>> widgets;
+    for (int i = 0; i < WIDGETS; ++i) {
+        auto widget = std::make_shared<Widget>();
+        widget->setRect(Rect<int32_t, uint32_t>(0, i * 10, 50, 10));
+        internal::setWidgetInvalidationSink(widget.get(), &sink);
+        // Staggered durations: some finish on every tick.
+        animator.animateRect(*widget, Rect<int32_t, uint32_t>(100, i * 10, 50, 10),
+                             AnimationSpec{milliseconds(10 + i * 5), Easing::Linear});
+        widgets.push_back(widget);
+    }
+    ASSERT_EQ(animator.getActiveCount(), size_t{WIDGETS});
+
+    auto start = steady_clock::now();
+    size_t allocations = countAllocations([&] {
+        for (int frame = 1; frame <= 20; ++frame) {
+            animator.tick(start + milliseconds(frame * 10));
+        }
+    });
+
+    ASSERT_EQ(allocations, size_t{0});
+    ASSERT_EQ(animator.getActiveCount(), size_t{0});
+    for (auto& widget : widgets) {
+        ASSERT_EQ(widget->getRect().x, 100);
+        internal::setWidgetInvalidationSink(widget.get(), nullptr);
+    }
+    std::println("  ✓ {} tweens finished, 0 heap allocations\n", WIDGETS);
+}
+
+void test_destroyed_widget_is_forgotten() {
+    std::println("TEST: Destroying a widget mid-tween drops its tween");
+
+    CountingSink sink;
+    auto& animator = Animator::instance();
+    auto widget = std::make_shared<Widget>();
+    internal::setWidgetInvalidationSink(widget.get(), &sink);
+    animator.animateBackgroundColor(*widget, colors::Transparent);
+    ASSERT_EQ(animator.getActiveCount(), size_t{1});
+
+    widget.reset();
+    ASSERT_EQ(animator.getActiveCount(), size_t{0});
+    ASSERT_TRUE(!animator.tick(steady_clock::now() + seconds(1)));
+    std::println("  ✓ No dangling target\n");
+}
+
+void test_tweens_found_under_window_root() {
+    std::println("TEST: A window finds the tweens of its own widgets, at any depth");
+
+    CountingSink sink;
+    auto& animator = Animator::instance();
+    auto root = std::make_shared<Container>();
+    auto group = std::make_shared<Container>();
+    auto leaf = std::make_shared<Widget>();
+    auto otherRoot = std::make_shared<Container>();
+    group->addChild(leaf);
+    root->addChild(group);
+    internal::setWidgetInvalidationSink(root.get(), &sink);
+    ASSERT_TRUE(!Animator::isAnimatingUnder(root.get()));
+
+    animator.animateRect(*leaf, Rect<int32_t, uint32_t>(40, 0, 10, 10));
+    ASSERT_TRUE(Animator::isAnimatingUnder(root.get()));
+    ASSERT_TRUE(Animator::isAnimatingUnder(group.get()));
+    ASSERT_TRUE(!Animator::isAnimatingUnder(otherRoot.get()));
+    ASSERT_TRUE(!Animator::isAnimatingUnder(nullptr));
+
+    ASSERT_TRUE(!animator.tick(steady_clock::now() + seconds(1)));
+    ASSERT_TRUE(!Animator::isAnimatingUnder(root.get()));
+
+    internal::setWidgetInvalidationSink(root.get(), nullptr);
+    std::println("  ✓ Tweens attributed to their window\n");
+}
+
+void test_scroll_and_slider_glide() {
+    std::println("TEST: ScrollView and Slider glide, and direct input takes over");
+
+    CountingSink sink;
+    auto& animator = Animator::instance();
+
+    auto view = std::make_shared<ScrollView>();
+    auto content = std::make_shared<Widget>();
+    content->setRect(Rect<int32_t, uint32_t>(0, 0, 100, 1000));
+    view->setContent(content);
+    view->setRect(Rect<int32_t, uint32_t>(0, 0, 100, 100));
+    internal::setWidgetInvalidationSink(view.get(), &sink);
+
+    view->animateScrollTo(0.0f, 5000.0f);   // Clamped up front
+    animator.tick(steady_clock::now() + milliseconds(75));
+    float halfway = view->getScrollOffset().y;
+    ASSERT_TRUE(halfway > 0.0f);
+
+    // The wheel (scrollBy) or scrollTo stops the glide where it is.
+    view->scrollBy(0.0f, 10.0f);
+    ASSERT_TRUE(!animator.isAnimating(*view, AnimatedProperty::ScrollOffset));
+    animator.tick(steady_clock::now() + seconds(1));
+    ASSERT_TRUE(view->getScrollOffset().y == halfway + 10.0f);
+
+    auto slider = std::make_shared<Slider>();
+    internal::setWidgetInvalidationSink(slider.get(), &sink);
+    slider->animateValueTo(40.4);
+    animator.tick(steady_clock::now() + milliseconds(50));
+    double between = slider->getValue();
+    ASSERT_TRUE(between > 0.0 && between < 40.0);
+    animator.tick(steady_clock::now() + seconds(1));
+    ASSERT_EQ(slider->getValue(), 40.0);    // Snapped to the step at the end
+
+    internal::setWidgetInvalidationSink(view.get(), nullptr);
+    internal::setWidgetInvalidationSink(slider.get(), nullptr);
+    std::println("  ✓ Scrolled to {}, slider at {}\n", view->getScrollOffset().y, slider->getValue());
+}
+
+void test_frame_clock_drives_tweens() {
+    std::println("TEST: The main loop runs tweens to completion, then idles");
+
+    CountingSink sink;
+    auto& app = core::Application::instance();
+    app.setTargetFps(60);
+    app.resetLoopStats();
+
+    auto image = std::make_shared<Image>();
+    internal::setWidgetInvalidationSink(image.get(), &sink);
+    image->fadeTo(0.0f, AnimationSpec{milliseconds(100), Easing::EaseInOutQuad});
+
+    app.postDelayed([] { core::Application::instance().quit(); }, milliseconds(400));
+    app.run();
+
+    ASSERT_EQ(image->getOpacity(), 0.0f);
+    ASSERT_EQ(Animator::instance().getActiveCount(), size_t{0});
+    // About six frames of fading, then the loop sleeps until the quit timer.
+    ASSERT_TRUE(app.getLoopStats().iterations <= 16);
+
+    internal::setWidgetInvalidationSink(image.get(), nullptr);
+    std::println("  ✓ Faded out in {} loop passes\n", app.getLoopStats().iterations);
+}
+
+// ============================================================================
+// MAIN TEST RUNNER
+// ============================================================================
+
+int main() {
+    try {
+        std::println("=== FRQS-Widget Animation Tests ===\n");
+
+        auto& app = core::Application::instance();
+        app.setEventLoopBackend(std::make_unique<platform::HeadlessEventLoopBackend>());
+        app.setQuitOnLastWindowClosed(false);   // No windows in a headless run
+
+        test_easing_endpoints();
+        test_detached_widget_snaps();
+        test_button_hover_fades();
+        test_finished_tweens_drop_without_allocating();
+        test_destroyed_widget_is_forgotten();
+        test_tweens_found_under_window_root();
+        test_scroll_and_slider_glide();
+        test_frame_clock_drives_tweens();
+
+        std::println("✅ ALL TESTS PASSED!");
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::println(stderr, "\n❌ TEST FAILED: {}", e.what());
+        return 1;
+    }
+}
@@ -0,0 +1,236 @@
+// tests/coroutine_test.cpp - Task hops, cancellation and exceptions
+#include "frqs-widget.hpp"
+#include "core/coroutine.hpp"
+#include "platform/event_loop_backend.hpp"
+#include <memory>
+#include <print>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+using namespace frqs;
+using namespace std::chrono;
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        std::println(stderr, "Assertion failed: {}", #cond); \
+        std::terminate(); \
+    }
+
+#define ASSERT_EQ(a, b) \
+    if ((a) != (b)) { \
+        std::println(stderr, "Assertion failed: {} != {}", #a, #b); \
+        std::println(stderr, "  Expected: {}", b); \
+        std::println(stderr, "  Got: {}", a); \
+        std::terminate(); \
+    }
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/**
+ * @brief Sets a flag when a coroutine frame holding it is destroyed.
+ */
+struct Guard {
+    bool* destroyed;
+    ~Guard() { *destroyed = true; }
+};
+
+/**
+ * @brief A hop that parks the resumption in a slot instead of a queue.
+ */
+struct ParkHop {
+    platform::UniqueTask* slot;
+
+    bool await_ready() const noexcept { return false; }
+    template <core::detail::HopPromise Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle) {
+        *slot = core::detail::makeResumeTask(handle, handle.promise());
+    }
+    void await_resume() const noexcept {}
+};
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+core::Task<> hopAround(std::thread::id* poolThread, std::thread::id* uiThread,
+                       steady_clock::duration* delayed) {
+    co_await core::resumeOnPool();
+    *poolThread = std::this_thread::get_id();
+
+    co_await core::resumeOnUi();
+    *uiThread = std::this_thread::get_id();
+
+    auto before = steady_clock::now();
+    co_await core::delay(milliseconds(30));
+    *delayed = steady_clock::now() - before;
+
+    core::Application::instance().quit();
+}
+
+void test_hops() {
+    std::println("TEST: A task hops to the pool, back to the UI thread, then waits");
+
+    std::thread::id poolThread;
+    std::thread::id uiThread;
+    steady_clock::duration delayed{};
+    core::spawn(hopAround(&poolThread, &uiThread, &delayed));
+    core::Application::instance().run();
+
+    auto mainThread = std::this_thread::get_id();
+    ASSERT_TRUE(poolThread != std::thread::id{});
+    ASSERT_TRUE(poolThread != mainThread);
+    ASSERT_TRUE(uiThread == mainThread);
+    ASSERT_TRUE(delayed >= milliseconds(30));
+    std::println("  ✓ Delay took {} ms\n", duration_cast<milliseconds>(delayed).count());
+}
+
+core::Task<int> failAfter(int value) {
+    if (value > 1) {
+        throw std::runtime_error("too large");
+    }
+    co_return value * 10;
+}
+
+core::Task<> catchThrough(int* result, std::string* message) {
+    *result = co_await failAfter(1);
+    try {
+        co_await failAfter(2);
+    } catch (const std::runtime_error& e) {
+        *message = e.what();
+    }
+}
+
+void test_exception_through_co_await() {
+    std::println("TEST: An awaited task's exception is rethrown in the awaiting one");
+
+    int result = 0;
+    std::string message;
+    core::spawn(catchThrough(&result, &message));
+
+    ASSERT_EQ(result, 10);
+    ASSERT_TRUE(message == "too large");
+    std::println("  ✓ Result and exception delivered\n");
+}
+
+core::Task<> innerWork(bool* innerDestroyed, bool* reachedEnd) {
+    Guard guard{innerDestroyed};
+    co_await core::resumeOnUi();
+    *reachedEnd = true;
+}
+
+core::Task<> outerWork(bool* outerDestroyed, bool* innerDestroyed, bool* reachedEnd) {
+    Guard guard{outerDestroyed};
+    co_await innerWork(innerDestroyed, reachedEnd);
+    *reachedEnd = true;
+}
+
+void test_owner_expiry_unwinds_chain() {
+    std::println("TEST: Destroying the owner cancels the chain at its next hop");
+
+    bool outerDestroyed = false;
+    bool innerDestroyed = false;
+    bool reachedEnd = false;
+    auto owner = std::make_shared<int>(0);
+    core::spawn(outerWork(&outerDestroyed, &innerDestroyed, &reachedEnd),
+                core::CancellationToken::forOwner(owner));
+    ASSERT_TRUE(!innerDestroyed);   // Suspended at the hop
+
+    owner.reset();
+    core::Application::instance().pollEvents();
+
+    ASSERT_TRUE(innerDestroyed);
+    ASSERT_TRUE(outerDestroyed);
+    ASSERT_TRUE(!reachedEnd);
+    std::println("  ✓ Both frames unwound, nothing ran past the hop\n");
+}
+
+core::Task<> parked(platform::UniqueTask* slot, bool* destroyed, bool* resumed) {
+    Guard guard{destroyed};
+    co_await ParkHop{slot};
+    *resumed = true;
+}
+
+void test_dropped_hop_frees_frame() {
+    std::println("TEST: A hop dropped without running destroys the suspended frame");
+
+    platform::UniqueTask slot;
+    bool destroyed = false;
+    bool resumed = false;
+    core::spawn(parked(&slot, &destroyed, &resumed));
+    ASSERT_TRUE(static_cast<bool>(slot));
+    ASSERT_TRUE(!destroyed);
+
+    slot = nullptr;     // The queue shuts down
+    ASSERT_TRUE(destroyed);
+    ASSERT_TRUE(!resumed);
+
+    // The same hop run normally resumes once.
+    destroyed = false;
+    core::spawn(parked(&slot, &destroyed, &resumed));
+    slot();
+    ASSERT_TRUE(resumed);
+    ASSERT_TRUE(destroyed);     // Finished and freed
+    std::println("  ✓ No leaked frame\n");
+}
+
+core::Task<> throwDetached() {
+    throw std::logic_error("escaped");
+    co_return;
+}
+
+void test_detached_exception_reported() {
+    std::println("TEST: An exception escaping a spawned task is reported, not dropped");
+
+    std::string reported;
+    core::setTaskExceptionHandler([&](std::exception_ptr error) {
+        try {
+            std::rethrow_exception(error);
+        } catch (const std::logic_error& e) {
+            reported = e.what();
+        }
+    });
+    core::spawn(throwDetached());
+    ASSERT_TRUE(reported == "escaped");
+
+    // Without a handler it surfaces from the loop on the UI thread.
+    core::setTaskExceptionHandler(nullptr);
+    core::spawn(throwDetached());
+    bool rethrown = false;
+    try {
+        core::Application::instance().pollEvents();
+    } catch (const std::logic_error& e) {
+        rethrown = std::string(e.what()) == "escaped";
+    }
+    ASSERT_TRUE(rethrown);
+    std::println("  ✓ Handler called, default rethrows from the loop\n");
+}
+
+// ============================================================================
+// MAIN TEST RUNNER
+// ============================================================================
+
+int main() {
+    try {
+        std::println("=== FRQS-Widget Coroutine Tests ===\n");
+
+        auto& app = core::Application::instance();
+        app.setEventLoopBackend(std::make_unique<platform::HeadlessEventLoopBackend>());
+        app.setQuitOnLastWindowClosed(false);   // No windows in a headless run
+
+        test_hops();
+        test_exception_through_co_await();
+        test_owner_expiry_unwinds_chain();
+        test_dropped_hop_frees_frame();
+        test_detached_exception_reported();     // Last: it leaves a frame through an exception
+
+        std::println("✅ ALL TESTS PASSED!");
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::println(stderr, "\n❌ TEST FAILED: {}", e.what());
+        return 1;
+    }
+}
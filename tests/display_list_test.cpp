@@ -0,0 +1,214 @@
+// tests/display_list_test.cpp - Per-widget damage from display-list diffing
+#include "frqs-widget.hpp"
+#include "render/display_list.hpp"
+#include <print>
+#include <vector>
+
+using namespace frqs;
+using namespace frqs::widget;
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        std::println(stderr, "Assertion failed: {}", #cond); \
+        std::terminate(); \
+    }
+
+#define ASSERT_EQ(a, b) \
+    if ((a) != (b)) { \
+        std::println(stderr, "Assertion failed: {} != {}", #a, #b); \
+        std::println(stderr, "  Expected: {}", b); \
+        std::println(stderr, "  Got: {}", a); \
+        std::terminate(); \
+    }
+
+using RectI = Rect<int32_t, uint32_t>;
+
+// ============================================================================
+// SCENE HELPERS
+// ============================================================================
+
+const RectI SURFACE(0, 0, 1000u, 1000u);
+
+/**
+ * @brief One widget's output in a recorded frame: a filled rect.
+ */
+struct Item {
+    const Widget* widget;
+    RectI rect;
+    Color color;
+};
+
+/**
+ * @brief Records a frame the way a window does: a clear, then one item per widget.
+ */
+void record(render::DisplayList& list, const std::vector<Item>& items) {
+    render::DisplayListRecorder recorder;
+    recorder.begin(list, SURFACE);
+    recorder.clear(Color(240, 240, 245));
+    for (const auto& item : items) {
+        recorder.beginWidget(item.widget);
+        recorder.fillRect(item.rect, item.color);
+        recorder.endWidget();
+    }
+    recorder.end();
+}
+
+/**
+ * @brief Diffs two frames into a fresh damage set.
+ */
+struct Damage {
+    render::DirtyRectManager rects{SURFACE};
+    size_t changed = 0;
+
+    Damage(const std::vector<Item>& before, const std::vector<Item>& after) {
+        render::DisplayList previous;
+        render::DisplayList current;
+        record(previous, before);
+        record(current, after);
+        changed = render::DisplayList::diff(previous, current, rects);
+    }
+
+    /** @brief Checks if some damaged rect contains `rect` entirely. */
+    bool covers(const RectI& rect) const {
+        for (const auto& dirty : rects.getDirtyRects()) {
+            if (dirty.x <= rect.x && dirty.y <= rect.y &&
+                dirty.getRight() >= rect.getRight() && dirty.getBottom() >= rect.getBottom()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** @brief Checks if any damaged rect overlaps `rect`. */
+    bool touches(const RectI& rect) const {
+        for (const auto& dirty : rects.getDirtyRects()) {
+            auto overlap = dirty.intersect(rect);
+            if (overlap.w > 0 && overlap.h > 0) return true;
+        }
+        return false;
+    }
+};
+
+// Far apart, so the damage set never merges two of them.
+const RectI TOP_LEFT(0, 0, 50u, 50u);
+const RectI TOP_RIGHT(900, 0, 50u, 50u);
+const RectI BOTTOM_LEFT(0, 900, 50u, 50u);
+const RectI BOTTOM_RIGHT(900, 900, 50u, 50u);
+const RectI CENTER(475, 475, 50u, 50u);
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void test_identical_frame_is_clean() {
+    std::println("TEST: An identical frame produces no damage");
+
+    Widget a, b;
+    std::vector<Item> frame = {{&a, TOP_LEFT, colors::Red}, {&b, CENTER, colors::Blue}};
+    Damage damage(frame, frame);
+
+    ASSERT_EQ(damage.changed, size_t{0});
+    ASSERT_TRUE(!damage.rects.isDirty());
+    std::println("  ✓ Nothing to draw\n");
+}
+
+void test_moved_item_damages_both_places() {
+    std::println("TEST: A moved widget damages its old and new bounds only");
+
+    Widget moved, still;
+    Damage damage({{&moved, TOP_LEFT, colors::Red}, {&still, BOTTOM_RIGHT, colors::Blue}},
+                  {{&moved, TOP_RIGHT, colors::Red}, {&still, BOTTOM_RIGHT, colors::Blue}});
+
+    ASSERT_EQ(damage.changed, size_t{1});
+    ASSERT_TRUE(damage.covers(TOP_LEFT));
+    ASSERT_TRUE(damage.covers(TOP_RIGHT));
+    ASSERT_TRUE(!damage.touches(BOTTOM_RIGHT));
+    ASSERT_TRUE(!damage.rects.needsFullRedraw());
+    std::println("  ✓ {} damaged rects\n", damage.rects.getDirtyRects().size());
+}
+
+void test_recoloured_item_damages_its_bounds() {
+    std::println("TEST: A recoloured widget damages its own bounds");
+
+    Widget recoloured, still;
+    Damage damage({{&recoloured, CENTER, colors::Red}, {&still, TOP_LEFT, colors::Blue}},
+                  {{&recoloured, CENTER, colors::Green}, {&still, TOP_LEFT, colors::Blue}});
+
+    ASSERT_EQ(damage.changed, size_t{1});
+    ASSERT_TRUE(damage.covers(CENTER));
+    ASSERT_TRUE(!damage.touches(TOP_LEFT));
+    std::println("  ✓ Only the recoloured widget\n");
+}
+
+void test_inserted_and_removed_items() {
+    std::println("TEST: Inserted and removed widgets damage where they are or were");
+
+    Widget removed, inserted, still;
+    Damage damage({{&removed, BOTTOM_LEFT, colors::Red}, {&still, TOP_LEFT, colors::Blue}},
+                  {{&still, TOP_LEFT, colors::Blue}, {&inserted, TOP_RIGHT, colors::Green}});
+
+    ASSERT_EQ(damage.changed, size_t{2});
+    ASSERT_TRUE(damage.covers(BOTTOM_LEFT));
+    ASSERT_TRUE(damage.covers(TOP_RIGHT));
+    ASSERT_TRUE(!damage.touches(TOP_LEFT));
+    std::println("  ✓ Appearance and disappearance both repainted\n");
+}
+
+void test_reordered_unchanged_items_are_clean() {
+    std::println("TEST: Matching is by widget, not by position in the frame");
+
+    Widget a, b, c;
+    Damage damage({{&a, TOP_LEFT, colors::Red}, {&b, CENTER, colors::Blue}, {&c, TOP_RIGHT, colors::Green}},
+                  {{&c, TOP_RIGHT, colors::Green}, {&a, TOP_LEFT, colors::Red}, {&b, CENTER, colors::Blue}});
+
+    ASSERT_EQ(damage.changed, size_t{0});
+    ASSERT_TRUE(!damage.rects.isDirty());
+    std::println("  ✓ No damage\n");
+}
+
+void test_unbalanced_pop_clip_is_dropped() {
+    std::println("TEST: A pop without a matching push is not recorded");
+
+    render::DisplayList list;
+    render::DisplayListRecorder recorder;
+    recorder.begin(list, SURFACE);
+    recorder.popClip();
+    recorder.pushClip(CENTER);
+    recorder.popClip();
+    recorder.popClip();
+    recorder.end();
+
+    size_t pushes = 0;
+    size_t pops = 0;
+    for (const auto& cmd : list.getCommands()) {
+        pushes += cmd.op == render::DisplayOp::PushClip ? 1 : 0;
+        pops += cmd.op == render::DisplayOp::PopClip ? 1 : 0;
+    }
+    ASSERT_EQ(pushes, size_t{1});
+    ASSERT_EQ(pops, size_t{1});
+    std::println("  ✓ Clips stay balanced on replay\n");
+}
+
+// ============================================================================
+// MAIN TEST RUNNER
+// ============================================================================
+
+int main() {
+    try {
+        std::println("=== FRQS-Widget Display List Tests ===\n");
+
+        test_identical_frame_is_clean();
+        test_moved_item_damages_both_places();
+        test_recoloured_item_damages_its_bounds();
+        test_inserted_and_removed_items();
+        test_reordered_unchanged_items_are_clean();
+        test_unbalanced_pop_clip_is_dropped();
+
+        std::println("✅ ALL TESTS PASSED!");
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::println(stderr, "\n❌ TEST FAILED: {}", e.what());
+        return 1;
+    }
+}
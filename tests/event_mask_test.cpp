@@ -0,0 +1,171 @@
+// tests/event_mask_test.cpp - Event interest masks and pass-through widgets
+#include "frqs-widget.hpp"
+#include "widget/internal.hpp"
+#include "widget/invalidation_sink.hpp"
+#include <memory>
+#include <print>
+
+using namespace frqs;
+using namespace frqs::widget;
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        std::println(stderr, "Assertion failed: {}", #cond); \
+        std::terminate(); \
+    }
+
+#define ASSERT_EQ(a, b) \
+    if ((a) != (b)) { \
+        std::println(stderr, "Assertion failed: {} != {}", #a, #b); \
+        std::println(stderr, "  Expected: {}", b); \
+        std::println(stderr, "  Got: {}", a); \
+        std::terminate(); \
+    }
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/**
+ * @brief Stands in for a window; attaching to it settles pass-through masks.
+ */
+class NullSink final : public InvalidationSink {
+public:
+    void invalidateRect(const Rect<int32_t, uint32_t>&) noexcept override {}
+    void invalidateAll() noexcept override {}
+    uint64_t getGeneration() const noexcept override { return 0; }
+    void requestFocus(IWidget*) override {}
+    void releaseFocus(IWidget*) override {}
+    void requestLayout(Widget*) override {}
+    void cancelLayout(Widget*) noexcept override {}
+};
+
+/**
+ * @brief A container subclass that handles clicks itself and never narrows its mask.
+ */
+class ClickableContainer : public Container {
+public:
+    int clicks = 0;
+
+    bool onEvent(const event::Event& event) override {
+        if (std::holds_alternative<event::MouseButtonEvent>(event)) {
+            ++clicks;
+            return true;
+        }
+        return false;
+    }
+};
+
+/**
+ * @brief A label subclass that counts key presses.
+ */
+class KeyLabel : public Label {
+public:
+    int keys = 0;
+
+    KeyLabel() : Label(L"keys") {}
+
+    bool onEvent(const event::Event& event) override {
+        if (std::holds_alternative<event::KeyEvent>(event)) {
+            ++keys;
+        }
+        return false;
+    }
+};
+
+event::Event click() {
+    return event::MouseButtonEvent{
+        .button = event::MouseButtonEvent::Button::Left,
+        .action = event::MouseButtonEvent::Action::Press,
+        .position = Point<int32_t>(5, 5)
+    };
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void test_plain_widgets_pass_through() {
+    std::println("TEST: Plain containers and labels drop to an empty mask once attached");
+
+    NullSink sink;
+    auto root = std::make_shared<Container>();
+    auto label = std::make_shared<Label>(L"text");
+    ASSERT_TRUE(root->getEventMask() == event::EVENT_MASK_ALL);     // Not settled yet
+
+    root->addChild(label);
+    internal::setWidgetInvalidationSink(root.get(), &sink);
+    ASSERT_TRUE(root->getEventMask() == event::EVENT_MASK_NONE);
+    ASSERT_TRUE(label->getEventMask() == event::EVENT_MASK_NONE);
+    ASSERT_TRUE(root->getSubtreeEventMask() == event::EVENT_MASK_NONE);
+
+    // Nothing below wants a click: dispatch skips the whole tree.
+    ASSERT_TRUE(!event::dispatchToWidgetTree(root.get(), click()));
+
+    internal::setWidgetInvalidationSink(root.get(), nullptr);
+    std::println("  ✓ Pass-through masks settled\n");
+}
+
+void test_subclass_override_receives_clicks() {
+    std::println("TEST: A subclass overriding onEvent still receives clicks");
+
+    NullSink sink;
+    auto root = std::make_shared<Container>();
+    auto middle = std::make_shared<Container>();
+    auto clickable = std::make_shared<ClickableContainer>();
+    auto keyLabel = std::make_shared<KeyLabel>();
+    middle->addChild(clickable);
+    middle->addChild(keyLabel);
+    root->addChild(middle);
+    internal::setWidgetInvalidationSink(root.get(), &sink);
+
+    ASSERT_TRUE(clickable->getEventMask() == event::EVENT_MASK_ALL);
+    ASSERT_TRUE(keyLabel->getEventMask() == event::EVENT_MASK_ALL);
+    ASSERT_TRUE(middle->getEventMask() == event::EVENT_MASK_NONE);
+    ASSERT_TRUE((root->getSubtreeEventMask() & event::eventMask<event::MouseButtonEvent>) != 0);
+
+    ASSERT_TRUE(event::dispatchToWidgetTree(root.get(), click()));
+    ASSERT_EQ(clickable->clicks, 1);
+
+    event::broadcastToWidgetTree(root.get(), event::KeyEvent{
+        .keyCode = 65, .action = event::KeyEvent::Action::Press});
+    ASSERT_EQ(keyLabel->keys, 1);
+
+    internal::setWidgetInvalidationSink(root.get(), nullptr);
+    std::println("  ✓ Click and key delivered through pass-through parents\n");
+}
+
+void test_explicit_mask_survives_attach() {
+    std::println("TEST: A mask set explicitly on a plain container is kept");
+
+    NullSink sink;
+    auto root = std::make_shared<Container>();
+    root->setEventMask(event::eventMask<event::KeyEvent>);
+    internal::setWidgetInvalidationSink(root.get(), &sink);
+
+    ASSERT_TRUE(root->getEventMask() == event::eventMask<event::KeyEvent>);
+
+    internal::setWidgetInvalidationSink(root.get(), nullptr);
+    std::println("  ✓ Explicit mask untouched\n");
+}
+
+// ============================================================================
+// MAIN TEST RUNNER
+// ============================================================================
+
+int main() {
+    try {
+        std::println("=== FRQS-Widget Event Mask Tests ===\n");
+
+        test_plain_widgets_pass_through();
+        test_subclass_override_receives_clicks();
+        test_explicit_mask_survives_attach();
+
+        std::println("✅ ALL TESTS PASSED!");
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::println(stderr, "\n❌ TEST FAILED: {}", e.what());
+        return 1;
+    }
+}
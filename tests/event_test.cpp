@@ -1,9 +1,16 @@
+#include "event/deferred_event_queue.hpp"
 #include "event/event_bus.hpp"
+#include "event/event_payload.hpp"
+#include "event/event_trace.hpp"
 #include "event/event_types.hpp"
 #include "event/event.hpp"
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 // Simple assertion macro
@@ -83,7 +90,7 @@ int test_typed_subscription() {
     ASSERT_EQ(keyCalls, 0);
     
     // Dispatch KeyEvent
-    bus.dispatch(Event(KeyEvent{KeyEvent::Action::Press, 65, 65}));
+    bus.dispatch(Event(KeyEvent{.keyCode = 65, .action = KeyEvent::Action::Press}));
     ASSERT_EQ(mouseCalls, 1);
     ASSERT_EQ(keyCalls, 1);
     
@@ -118,7 +125,7 @@ int test_priority() {
     // Suppress unused warnings
     (void)id1; (void)id2; (void)id3;
 
-    bus.dispatch(Event(WindowCloseEvent{}));
+    bus.dispatch(Event(PaintEvent{}));
     
     ASSERT_EQ(order.size(), 3);
     ASSERT_EQ(order[0], 3); // Priority 3
@@ -149,7 +156,7 @@ int test_propagation_stop() {
     
     (void)id1; (void)id2;
 
-    bool handled = bus.dispatch(Event(WindowCloseEvent{}));
+    bool handled = bus.dispatch(Event(PaintEvent{}));
     
     ASSERT_EQ(callCount, 1);
     ASSERT_TRUE(handled);
@@ -181,7 +188,7 @@ int test_scoped_listener() {
         );
         
         bus.dispatch(Event(MouseMoveEvent{Point<int32_t>(0,0)}));
-        bus.dispatch(Event(KeyEvent{KeyEvent::Action::Press, 0, 0}));
+        bus.dispatch(Event(KeyEvent{.keyCode = 0, .action = KeyEvent::Action::Press}));
         
         ASSERT_EQ(mouseCalled, 1);
         ASSERT_EQ(keyCalled, 1);
@@ -196,7 +203,7 @@ int test_scoped_listener() {
     return 0;
 }
 
-// Fixed FileDropEvent Test
+// FileDropEvent Test: paths live out of line in the payload arena
 int test_file_drop() {
     std::cout << "Running test_file_drop..." << std::endl;
 
@@ -205,22 +212,271 @@ int test_file_drop() {
         "C:\\test\\file2.jpg"
     };
 
-    // Fix: Swap arguments (Position first, then Files)
-    FileDropEvent evt{widget::Point<int32_t>(100, 200), files};
+    PayloadHandle handle = PayloadArena::instance().storeFiles(files);
+    FileDropEvent evt{
+        .position = Point<int32_t>(100, 200),
+        .fileCount = 2,
+        .payload = handle
+    };
 
-    // Fix: Access members directly (no payload->)
-    ASSERT_EQ(evt.paths.size(), 2);
+    ASSERT_EQ(evt.getFiles().size(), 2);
     ASSERT_EQ(evt.position.x, 100);
     ASSERT_EQ(evt.position.y, 200);
     
     // Verify paths content
-    ASSERT_TRUE(evt.paths[0] == "C:\\test\\file1.txt");
+    ASSERT_TRUE(evt.getFiles()[0] == "C:\\test\\file1.txt");
     
-    // Verify Event variant wrapping
+    // Verify Event variant wrapping (copies the handle, not the paths)
     Event wrappedEvt = evt;
     auto* ptr = std::get_if<FileDropEvent>(&wrappedEvt);
     ASSERT_TRUE(ptr != nullptr);
-    ASSERT_EQ(ptr->paths.size(), 2);
+    ASSERT_EQ(ptr->getFiles().size(), 2);
+
+    // Released payloads resolve to nothing
+    PayloadArena::instance().release(handle);
+    ASSERT_EQ(ptr->getFiles().size(), 0);
+
+    std::cout << "  Passed!" << std::endl;
+    return 0;
+}
+
+// EventTrace Test: recorded events survive a save/load round trip
+int test_event_trace() {
+    std::cout << "Running test_event_trace..." << std::endl;
+
+    EventRecorder recorder;
+    recorder.start();
+    recorder.record(1, Event(KeyEvent{.keyCode = 65, .action = KeyEvent::Action::Press}));
+    recorder.record(1, Event(PaintEvent{}));   // Not an input event: filtered out
+
+    PayloadHandle handle = PayloadArena::instance().storeFiles({"dropped.txt"});
+    recorder.record(2, Event(FileDropEvent{.position = Point<int32_t>(5, 6), .fileCount = 1, .payload = handle}));
+    PayloadArena::instance().release(handle);
+
+    const EventTrace& trace = recorder.getTrace();
+    ASSERT_EQ(trace.size(), 2);
+
+    auto path = std::filesystem::temp_directory_path() / "frqs_event_test.frqt";
+    ASSERT_TRUE(trace.save(path));
+    auto loaded = EventTrace::load(path);
+    std::filesystem::remove(path);
+    ASSERT_TRUE(loaded.has_value());
+    ASSERT_EQ(loaded->size(), 2);
+
+    auto records = loaded->getRecords();
+    ASSERT_EQ(records[0].windowId, 1);
+    ASSERT_EQ(std::get<KeyEvent>(records[0].event).keyCode, 65);
+    ASSERT_EQ(records[1].windowId, 2);
+    ASSERT_EQ(records[1].time, trace.getRecords()[1].time);
+    // The paths were copied into the trace; the arena payload is gone
+    ASSERT_EQ(loaded->getFiles(records[1]).size(), 1);
+    ASSERT_TRUE(loaded->getFiles(records[1])[0] == "dropped.txt");
+
+    std::cout << "  Passed!" << std::endl;
+    return 0;
+}
+
+// Re-entrancy: listeners subscribe, publish and unsubscribe from inside a publish
+int test_reentrant_subscribe_publish() {
+    std::cout << "Running test_reentrant_subscribe_publish..." << std::endl;
+
+    EventBus bus;
+    std::vector<std::string> calls;
+    ListenerId late = 0;
+    ListenerId once = 0;
+
+    once = bus.subscribe([&](const Event&) {
+        calls.push_back("once");
+        bus.unsubscribe(once);      // Removing itself must not wait on itself
+        return false;
+    }, 2);
+
+    bus.subscribeType<KeyEvent>([&](const KeyEvent& e) {
+        calls.push_back("outer " + std::to_string(e.keyCode));
+        if (e.keyCode == 1) {
+            late = bus.subscribeType<KeyEvent>([&](const KeyEvent& inner) {
+                calls.push_back("late " + std::to_string(inner.keyCode));
+                return false;
+            });
+            bus.broadcast(Event(KeyEvent{.keyCode = 2, .action = KeyEvent::Action::Press}));
+        }
+        return false;
+    }, 1);
+
+    bus.broadcast(Event(KeyEvent{.keyCode = 1, .action = KeyEvent::Action::Press}));
+
+    // The nested publish sees the new listener; the outer one keeps its snapshot.
+    std::vector<std::string> expected = {"once", "outer 1", "outer 2", "late 2"};
+    ASSERT_TRUE(calls == expected);
+    ASSERT_EQ(bus.getListenerCount(), 2);
+
+    calls.clear();
+    bus.broadcast(Event(KeyEvent{.keyCode = 3, .action = KeyEvent::Action::Press}));
+    expected = {"outer 3", "late 3"};
+    ASSERT_TRUE(calls == expected);
+    ASSERT_TRUE(bus.unsubscribe(late));
+
+    std::cout << "  Passed!" << std::endl;
+    return 0;
+}
+
+// Quiescence: unsubscribe from another thread returns only once the listener is idle
+int test_cross_thread_unsubscribe() {
+    std::cout << "Running test_cross_thread_unsubscribe..." << std::endl;
+
+    EventBus bus;
+    std::atomic<bool> inCallback{false};
+    std::atomic<bool> stop{false};
+    std::atomic<int> calls{0};
+    auto captured = std::make_shared<int>(0);
+
+    ListenerId id = bus.subscribeType<MouseMoveEvent>([&, captured](const MouseMoveEvent&) {
+        inCallback.store(true);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        calls.fetch_add(1);
+        inCallback.store(false);
+        return false;
+    });
+
+    std::thread publisher([&] {
+        while (!stop.load()) {
+            bus.broadcast(Event(MouseMoveEvent{Point<int32_t>(1, 1)}));
+        }
+    });
+
+    while (!inCallback.load()) {
+        std::this_thread::yield();
+    }
+    ASSERT_TRUE(bus.unsubscribe(id));
+
+    // The publisher still caches the old snapshot, but the listener is done and released.
+    ASSERT_TRUE(!inCallback.load());
+    ASSERT_EQ(captured.use_count(), 1);
+    int after = calls.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_EQ(calls.load(), after);
+
+    stop.store(true);
+    publisher.join();
+
+    std::cout << "  Passed!" << std::endl;
+    return 0;
+}
+
+// Deferred queue: a keyed event keeps its first position but carries the newest value
+int test_deferred_keyed_coalescing() {
+    std::cout << "Running test_deferred_keyed_coalescing..." << std::endl;
+
+    DeferredEventQueue queue(16);
+    auto move = [](int32_t x) { return Event(MouseMoveEvent{Point<int32_t>(x, 0)}); };
+
+    MouseMoveEvent sampled{Point<int32_t>(9, 9)};
+    sampled.samples = &sampled;     // Dispatch-time storage; must not survive queueing
+    sampled.sampleCount = 1;
+
+    ASSERT_TRUE(queue.publish(move(1), 7));
+    ASSERT_TRUE(queue.publish(move(2)));
+    ASSERT_TRUE(queue.publish(move(3), 7));     // Replaces x=1 in its slot
+    ASSERT_TRUE(queue.publish(move(4), 8));
+    ASSERT_TRUE(queue.publish(Event(sampled)));
+
+    std::vector<int32_t> order;
+    bool samplesCleared = false;
+    size_t delivered = queue.drain([&](const Event& event) {
+        const auto& e = std::get<MouseMoveEvent>(event);
+        order.push_back(e.position.x);
+        if (e.position.x == 9) {
+            samplesCleared = e.samples == nullptr && e.sampleCount == 0;
+        }
+    });
+
+    ASSERT_EQ(delivered, 4);
+    std::vector<int32_t> expected = {3, 2, 4, 9};
+    ASSERT_TRUE(order == expected);
+    ASSERT_TRUE(samplesCleared);
+
+    DeferredEventStats stats = queue.getStats();
+    ASSERT_EQ(stats.published, 5);
+    ASSERT_EQ(stats.coalesced, 1);
+    ASSERT_EQ(stats.delivered, 4);
+
+    // After the drain the key queues afresh.
+    ASSERT_TRUE(queue.publish(move(5), 7));
+    ASSERT_EQ(queue.getPendingCount(), 1);
+
+    std::cout << "  Passed!" << std::endl;
+    return 0;
+}
+
+// Deferred queue: a full ring drops and counts, then accepts again after a drain
+int test_deferred_overflow() {
+    std::cout << "Running test_deferred_overflow..." << std::endl;
+
+    DeferredEventQueue queue(4);
+    ASSERT_EQ(queue.getCapacity(), 4);
+
+    int accepted = 0;
+    for (int32_t i = 0; i < 6; ++i) {
+        accepted += queue.publish(Event(MouseMoveEvent{Point<int32_t>(i, 0)})) ? 1 : 0;
+    }
+    ASSERT_EQ(accepted, 4);
+    ASSERT_TRUE(!queue.publish(Event(PaintEvent{}), 3));    // A new key needs a slot too
+    ASSERT_TRUE(!queue.publish(Event(PaintEvent{})));
+
+    DeferredEventStats stats = queue.getStats();
+    ASSERT_EQ(stats.published, 4);
+    ASSERT_EQ(stats.dropped, 4);
+
+    std::vector<int32_t> order;
+    queue.drain([&](const Event& event) { order.push_back(std::get<MouseMoveEvent>(event).position.x); });
+    std::vector<int32_t> expected = {0, 1, 2, 3};     // The oldest ones were kept
+    ASSERT_TRUE(order == expected);
+
+    ASSERT_TRUE(queue.publish(Event(PaintEvent{}), 3));
+    ASSERT_EQ(queue.getStats().dropped, 4);
+
+    std::cout << "  Passed!" << std::endl;
+    return 0;
+}
+
+// Deferred queue: producers on several threads, drained while they publish
+int test_deferred_multi_producer() {
+    std::cout << "Running test_deferred_multi_producer..." << std::endl;
+
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 5000;
+    DeferredEventQueue queue(PRODUCERS * PER_PRODUCER);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&queue, p] {
+            for (int i = 0; i < PER_PRODUCER; ++i) {
+                queue.publish(Event(MouseMoveEvent{Point<int32_t>(p, i)}));
+            }
+        });
+    }
+
+    std::vector<int32_t> next(PRODUCERS, 0);
+    bool ordered = true;
+    size_t delivered = 0;
+    auto consume = [&](const Event& event) {
+        const auto& e = std::get<MouseMoveEvent>(event);
+        ordered = ordered && e.position.y == next[e.position.x];
+        next[e.position.x] = e.position.y + 1;
+    };
+    while (delivered < size_t{PRODUCERS * PER_PRODUCER}) {
+        delivered += queue.drain(consume);
+        std::this_thread::yield();
+    }
+    for (auto& producer : producers) producer.join();
+
+    ASSERT_TRUE(ordered);
+    for (int p = 0; p < PRODUCERS; ++p) {
+        ASSERT_EQ(next[p], PER_PRODUCER);
+    }
+    DeferredEventStats stats = queue.getStats();
+    ASSERT_EQ(stats.dropped, 0);
+    ASSERT_EQ(stats.delivered, static_cast<uint64_t>(PRODUCERS * PER_PRODUCER));
 
     std::cout << "  Passed!" << std::endl;
     return 0;
@@ -236,7 +492,13 @@ int main() {
     if (test_priority() != 0) return 1;
     if (test_propagation_stop() != 0) return 1;
     if (test_scoped_listener() != 0) return 1;
+    if (test_reentrant_subscribe_publish() != 0) return 1;
+    if (test_cross_thread_unsubscribe() != 0) return 1;
+    if (test_deferred_keyed_coalescing() != 0) return 1;
+    if (test_deferred_overflow() != 0) return 1;
+    if (test_deferred_multi_producer() != 0) return 1;
     if (test_file_drop() != 0) return 1;
+    if (test_event_trace() != 0) return 1;
     
     std::cout << "\nAll tests passed successfully!" << std::endl;
     return 0;
@@ -0,0 +1,204 @@
+// tests/focus_manager_test.cpp - Tab order, focus transitions and key routing
+#include "frqs-widget.hpp"
+#include "widget/focus_manager.hpp"
+#include <memory>
+#include <print>
+#include <string>
+#include <vector>
+
+using namespace frqs;
+using namespace frqs::widget;
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        std::println(stderr, "Assertion failed: {}", #cond); \
+        std::terminate(); \
+    }
+
+#define ASSERT_EQ(a, b) \
+    if ((a) != (b)) { \
+        std::println(stderr, "Assertion failed: {} != {}", #a, #b); \
+        std::println(stderr, "  Expected: {}", b); \
+        std::println(stderr, "  Got: {}", a); \
+        std::terminate(); \
+    }
+
+using Log = std::vector<std::string>;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/**
+ * @brief A focusable widget that logs focus changes ("+name" / "-name") and keys ("key:name").
+ */
+class FocusLogger : public Widget {
+public:
+    bool consumeKeys = false;
+
+    FocusLogger(std::string name, Log& log, int32_t tabIndex) : name_(std::move(name)), log_(log) {
+        setFocusable(true);
+        setTabIndex(tabIndex);
+    }
+
+    [[nodiscard]] const std::string& getName() const noexcept { return name_; }
+
+    bool onEvent(const event::Event& event) override {
+        if (auto* focus = std::get_if<event::FocusEvent>(&event)) {
+            log_.push_back((focus->action == event::FocusEvent::Action::Gained ? "+" : "-") + name_);
+        } else if (std::holds_alternative<event::KeyEvent>(event)) {
+            log_.push_back("key:" + name_);
+            return consumeKeys;
+        }
+        return false;
+    }
+
+private:
+    std::string name_;
+    Log& log_;
+};
+
+event::Event tab(bool shift = false) {
+    return event::KeyEvent{
+        .keyCode = static_cast<uint32_t>(event::KeyCode::Tab),
+        .action = event::KeyEvent::Action::Press,
+        .modifiers = shift ? static_cast<uint32_t>(event::ModifierKey::Shift) : 0u,
+        .timestamp = 0
+    };
+}
+
+/**
+ * @brief root ─ zeroA(0), three(3), negative(-1), group ─ one(1), zeroB(0), hidden(0)
+ */
+struct Scene {
+    Log log;
+    std::shared_ptr<Container> root = std::make_shared<Container>();
+    std::shared_ptr<Container> group = std::make_shared<Container>();
+    std::shared_ptr<FocusLogger> zeroA = std::make_shared<FocusLogger>("zeroA", log, 0);
+    std::shared_ptr<FocusLogger> three = std::make_shared<FocusLogger>("three", log, 3);
+    std::shared_ptr<FocusLogger> negative = std::make_shared<FocusLogger>("negative", log, -1);
+    std::shared_ptr<FocusLogger> one = std::make_shared<FocusLogger>("one", log, 1);
+    std::shared_ptr<FocusLogger> zeroB = std::make_shared<FocusLogger>("zeroB", log, 0);
+    std::shared_ptr<FocusLogger> hidden = std::make_shared<FocusLogger>("hidden", log, 0);
+    std::shared_ptr<IWidget> tree = root;
+
+    Scene() {
+        root->addChild(zeroA);
+        root->addChild(three);
+        root->addChild(negative);
+        group->addChild(one);
+        group->addChild(zeroB);
+        group->addChild(hidden);
+        root->addChild(group);
+        hidden->setVisible(false);
+    }
+
+    /** @brief Gets the name of the focused widget, or "" if none. */
+    [[nodiscard]] std::string focusedName(const FocusManager& focus) const {
+        for (const auto& widget : {zeroA, three, negative, one, zeroB, hidden}) {
+            if (widget.get() == focus.getFocused()) return widget->getName();
+        }
+        return {};
+    }
+};
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void test_tab_order() {
+    std::println("TEST: Positive indices first (ascending), then 0 in tree order; negative skipped");
+
+    Scene scene;
+    FocusManager focus;
+
+    Log order;
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(focus.focusNext(scene.tree));
+        order.push_back(scene.focusedName(focus));
+    }
+    ASSERT_TRUE((order == Log{"one", "three", "zeroA", "zeroB", "one"}));   // Wraps around
+
+    Log reverse;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(focus.focusNext(scene.tree, true));
+        reverse.push_back(scene.focusedName(focus));
+    }
+    ASSERT_TRUE((reverse == Log{"zeroB", "zeroA", "three", "one"}));
+    std::println("  ✓ one, three, zeroA, zeroB\n");
+}
+
+void test_negative_index_focusable_by_pointer() {
+    std::println("TEST: A negative index is reachable by click, and Tab moves on from it");
+
+    Scene scene;
+    FocusManager focus;
+
+    // A press on a non-focusable container focuses nothing; on the widget, it does.
+    focus.focusFromPointer(scene.tree, scene.group.get());
+    ASSERT_TRUE(focus.getFocused() == nullptr);
+    focus.focusFromPointer(scene.tree, scene.negative.get());
+    ASSERT_TRUE(focus.getFocused() == scene.negative.get());
+
+    // Not in the tab order: Tab starts from the beginning, Shift+Tab from the end.
+    ASSERT_TRUE(focus.dispatchKey(scene.tree, tab()));
+    ASSERT_EQ(scene.focusedName(focus), std::string("one"));
+    focus.setFocus(scene.tree, scene.negative.get());
+    ASSERT_TRUE(focus.dispatchKey(scene.tree, tab(true)));
+    ASSERT_EQ(scene.focusedName(focus), std::string("zeroB"));
+    std::println("  ✓ Click focus and Tab from outside the order\n");
+}
+
+void test_transitions_and_key_routing() {
+    std::println("TEST: Lost before Gained; keys go to the focused widget and bubble");
+
+    Scene scene;
+    FocusManager focus;
+
+    ASSERT_TRUE(focus.setFocus(scene.tree, scene.zeroA.get()));
+    ASSERT_TRUE(!focus.setFocus(scene.tree, scene.zeroA.get()));     // Already focused
+    ASSERT_TRUE(focus.setFocus(scene.tree, scene.one.get()));
+    ASSERT_TRUE((scene.log == Log{"+zeroA", "-zeroA", "+one"}));
+
+    // A consumed Tab is the widget's, not navigation.
+    scene.log.clear();
+    scene.one->consumeKeys = true;
+    ASSERT_TRUE(focus.dispatchKey(scene.tree, tab()));
+    ASSERT_TRUE((scene.log == Log{"key:one"}));
+    ASSERT_TRUE(focus.getFocused() == scene.one.get());
+
+    // A widget outside the tree cannot take focus.
+    Log strayLog;
+    auto stray = std::make_shared<FocusLogger>("stray", strayLog, 0);
+    ASSERT_TRUE(!focus.setFocus(scene.tree, stray.get()));
+
+    // The focused widget leaves the tree: it loses focus, and keys go to the root.
+    scene.log.clear();
+    scene.group->removeChild(scene.one.get());
+    ASSERT_TRUE(!focus.dispatchKey(scene.tree, event::KeyEvent{
+        .keyCode = 'A', .action = event::KeyEvent::Action::Press, .modifiers = 0, .timestamp = 0}));
+    ASSERT_TRUE((scene.log == Log{"-one"}));
+    ASSERT_TRUE(focus.getFocused() == nullptr);
+    std::println("  ✓ Transitions and routing\n");
+}
+
+// ============================================================================
+// MAIN TEST RUNNER
+// ============================================================================
+
+int main() {
+    try {
+        std::println("=== FRQS-Widget Focus Manager Tests ===\n");
+
+        test_tab_order();
+        test_negative_index_focusable_by_pointer();
+        test_transitions_and_key_routing();
+
+        std::println("✅ ALL TESTS PASSED!");
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::println(stderr, "\n❌ TEST FAILED: {}", e.what());
+        return 1;
+    }
+}
@@ -0,0 +1,200 @@
+// tests/frame_alloc_test.cpp - Steady-state frames must not touch the heap
+#include "frqs-widget.hpp"
+#include "core/frame_arena.hpp"
+#include "platform/event_loop_backend.hpp"
+#include "render/display_list.hpp"
+#include "alloc_counter.hpp"
+#include <print>
+
+using namespace frqs;
+using namespace frqs::widget;
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        std::println(stderr, "Assertion failed: {}", #cond); \
+        std::terminate(); \
+    }
+
+#define ASSERT_EQ(a, b) \
+    if ((a) != (b)) { \
+        std::println(stderr, "Assertion failed: {} != {}", #a, #b); \
+        std::println(stderr, "  Expected: {}", b); \
+        std::println(stderr, "  Got: {}", a); \
+        std::terminate(); \
+    }
+
+// ============================================================================
+// HEADLESS FRAME
+// ============================================================================
+
+constexpr int FRAME_COUNT = 200;
+constexpr int WARMUP_FRAMES = 4;
+
+struct Scene {
+    Rect<int32_t, uint32_t> bounds {0, 0, 800u, 600u};
+    std::shared_ptr<Container> root;
+    std::shared_ptr<ScrollView> scrollView;
+    render::DisplayList list;
+    render::DisplayListRecorder recorder;
+    render::DirtyRectManager dirtyRects {bounds};
+
+    Scene() {
+        root = createFlexColumn(4, 8);
+
+        auto header = std::make_shared<Label>(L"Header");
+        header->setRect(Rect(0, 0, 800u, 40u));
+        root->addChild(header);
+
+        auto body = createFlexRow(4, 0);
+        body->setLayoutWeight(1.0f);
+        for (int i = 0; i < 8; ++i) {
+            auto cell = std::make_shared<Widget>();
+            cell->setLayoutWeight(1.0f);
+            body->addChild(cell);
+        }
+        root->addChild(body);
+
+        auto rows = createVStack(2, 0);
+        for (int i = 0; i < 200; ++i) {
+            auto row = std::make_shared<Label>(L"Row item");
+            row->setRect(Rect(0, 0, 760u, 20u));
+            rows->addChild(row);
+        }
+        rows->setRect(Rect(0, 0, 760u, 200u * 22u));
+
+        scrollView = std::make_shared<ScrollView>();
+        scrollView->setLayoutWeight(2.0f);
+        scrollView->setContent(rows);
+        root->addChild(scrollView);
+    }
+
+    // One frame: layout pass, record, damage query, end-of-frame reset.
+    void frame() {
+        root->setRect(bounds);  // Re-runs FlexLayout on the whole tree
+
+        recorder.begin(list, bounds);
+        recorder.clear(Color(240, 240, 245));
+        root->render(recorder);
+        recorder.end();
+
+        dirtyRects.addDirtyRect(scrollView->getRect());
+        size_t count = 0;
+        for (const auto& r : dirtyRects.getDirtyRects()) {
+            count += r.w > 0 ? 1 : 0;
+        }
+        (void)count;
+        dirtyRects.clear();
+
+        core::FrameArena::forCurrentThread().reset();
+    }
+};
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void test_idle_frames(Scene& scene) {
+    std::println("TEST: Idle frames ({})", FRAME_COUNT);
+
+    for (int i = 0; i < WARMUP_FRAMES; ++i) scene.frame();
+
+    size_t allocations = countAllocations([&] {
+        for (int i = 0; i < FRAME_COUNT; ++i) scene.frame();
+    });
+
+    ASSERT_EQ(allocations, size_t{0});
+    std::println("  ✓ 0 heap allocations\n");
+}
+
+void test_scrolling_frames(Scene& scene) {
+    std::println("TEST: Scrolling frames ({})", FRAME_COUNT);
+
+    for (int i = 0; i < WARMUP_FRAMES; ++i) {
+        scene.scrollView->scrollBy(0.0f, 3.0f);
+        scene.frame();
+    }
+
+    size_t allocations = countAllocations([&] {
+        for (int i = 0; i < FRAME_COUNT; ++i) {
+            scene.scrollView->scrollBy(0.0f, (i / 50) % 2 == 0 ? 3.0f : -3.0f);
+            scene.frame();
+        }
+    });
+
+    ASSERT_EQ(allocations, size_t{0});
+    std::println("  ✓ 0 heap allocations\n");
+}
+
+void test_arena_growth_settles() {
+    std::println("TEST: Arena grows once, then stays put");
+
+    core::FrameArena arena(64);
+    for (int frame = 0; frame < 3; ++frame) {
+        {
+            core::FrameArena::Scope scope(arena);
+            core::ArenaVector<int> values{core::ArenaAllocator<int>(arena)};
+            values.reserve(256);
+            for (int i = 0; i < 256; ++i) values.push_back(i);
+        }   // Everything using the arena ends before the frame does
+        arena.reset();
+    }
+
+    ASSERT_EQ(arena.getGrowCount(), size_t{1});
+    std::println("  ✓ Capacity: {} bytes after {} grow\n", arena.getCapacity(), arena.getGrowCount());
+}
+
+void test_application_frames_reset_arena() {
+    std::println("TEST: Frames run by the application release the thread's arena");
+
+    auto& app = core::Application::instance();
+    auto& arena = core::FrameArena::forCurrentThread();
+    size_t usedDuringFrame = 0;
+
+    for (int frame = 0; frame < 3; ++frame) {
+        app.postToUiThread([&] {
+            (void)arena.allocate(512, alignof(std::max_align_t));
+            usedDuringFrame = arena.getUsed();
+        });
+        app.pollEvents();
+
+        ASSERT_TRUE(usedDuringFrame >= 512);
+        ASSERT_EQ(arena.getUsed(), size_t{0});
+    }
+
+    // Idle frames through the whole pipeline stay off the heap too.
+    for (int i = 0; i < WARMUP_FRAMES; ++i) app.pollEvents();
+    size_t allocations = countAllocations([&] {
+        for (int i = 0; i < FRAME_COUNT; ++i) app.pollEvents();
+    });
+
+    ASSERT_EQ(allocations, size_t{0});
+    ASSERT_EQ(arena.getUsed(), size_t{0});
+    std::println("  ✓ Arena empty after every pollEvents, 0 heap allocations\n");
+}
+
+// ============================================================================
+// MAIN TEST RUNNER
+// ============================================================================
+
+int main() {
+    try {
+        std::println("=== FRQS-Widget Frame Allocation Tests ===\n");
+
+        auto& app = core::Application::instance();
+        app.setEventLoopBackend(std::make_unique<platform::HeadlessEventLoopBackend>());
+        app.setQuitOnLastWindowClosed(false);   // No windows in a headless run
+
+        Scene scene;
+        test_idle_frames(scene);
+        test_scrolling_frames(scene);
+        test_arena_growth_settles();
+        test_application_frames_reset_arena();
+
+        std::println("✅ ALL TESTS PASSED!");
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::println(stderr, "\n❌ TEST FAILED: {}", e.what());
+        return 1;
+    }
+}
@@ -0,0 +1,167 @@
+// tests/frame_pacer_test.cpp - Frame deadlines, spin margin and interval percentiles
+#include "frqs-widget.hpp"
+#include "core/frame_pacer.hpp"
+#include <print>
+
+using namespace frqs;
+using namespace std::chrono;
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        std::println(stderr, "Assertion failed: {}", #cond); \
+        std::terminate(); \
+    }
+
+#define ASSERT_EQ(a, b) \
+    if ((a) != (b)) { \
+        std::println(stderr, "Assertion failed: {} != {}", #a, #b); \
+        std::println(stderr, "  Expected: {}", b); \
+        std::println(stderr, "  Got: {}", a); \
+        std::terminate(); \
+    }
+
+using Clock = core::FramePacer::Clock;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/** @brief Where every schedule here starts; the pacer's loop calls never read the clock. */
+const Clock::time_point T0 = Clock::time_point(seconds(100));
+
+/** @brief Gets the time `ms` milliseconds after T0. */
+Clock::time_point at(int64_t ms) {
+    return T0 + milliseconds(ms);
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void test_missed_periods_keep_phase() {
+    std::println("TEST: A late frame skips the missed periods and keeps the schedule's phase");
+
+    core::FramePacer pacer(100);    // 10 ms
+    pacer.beginFrame(at(0));
+    ASSERT_TRUE(pacer.scheduleNextFrame(at(0)) == at(10));
+
+    // Slightly late: the frame is still stamped with its deadline.
+    pacer.beginFrame(at(11));
+    ASSERT_TRUE(pacer.getFrameTime() == at(10));
+    ASSERT_TRUE(pacer.scheduleNextFrame(at(11)) == at(20));
+
+    // 35 ms late: three periods dropped, next deadline back on the 10 ms grid.
+    pacer.beginFrame(at(55));
+    ASSERT_TRUE(pacer.getFrameTime() == at(50));
+    ASSERT_TRUE(pacer.scheduleNextFrame(at(55)) == at(60));
+    ASSERT_EQ(pacer.getStats().missedFrames, uint64_t{3});
+    ASSERT_EQ(pacer.getStats().frames, uint64_t{2});
+
+    // Woken early by input: not a paced frame, the schedule stays put.
+    pacer.beginFrame(at(57));
+    ASSERT_TRUE(pacer.getFrameTime() == at(57));
+    ASSERT_TRUE(pacer.scheduleNextFrame(at(57)) == at(60));
+    ASSERT_EQ(pacer.getStats().frames, uint64_t{2});
+
+    // Idle, then a new burst: anchored afresh, the idle gap is not a missed frame.
+    pacer.stop();
+    pacer.beginFrame(at(1003));
+    ASSERT_TRUE(pacer.scheduleNextFrame(at(1003)) == at(1013));
+    ASSERT_EQ(pacer.getStats().missedFrames, uint64_t{3});
+    std::println("  ✓ Deadlines stay on the grid\n");
+}
+
+void test_spin_margin_adapts() {
+    std::println("TEST: The spin margin follows the measured oversleep, within bounds");
+
+    core::FramePacer pacer(60);
+    // Deadlines in the past: finishWait measures, then has nothing left to spin.
+    const auto deadline = Clock::now() - seconds(1);
+
+    auto wakeAfter = [&](microseconds oversleep) {
+        pacer.finishWait(deadline, pacer.getSleepUntil(deadline) + oversleep);
+        return duration_cast<microseconds>(pacer.getStats().spinMargin);
+    };
+
+    // Grows to just above the oversleep.
+    ASSERT_TRUE(wakeAfter(microseconds(3000)) == microseconds(3250));
+    ASSERT_TRUE(pacer.getStats().maxOversleep == microseconds(3000));
+
+    // Decays slowly while sleeps are accurate, down to the floor.
+    auto previous = wakeAfter(microseconds(0));
+    ASSERT_TRUE(previous < microseconds(3250) && previous > microseconds(2900));
+    for (int i = 0; i < 200; ++i) {
+        auto margin = wakeAfter(microseconds(0));
+        ASSERT_TRUE(margin <= previous);
+        previous = margin;
+    }
+    ASSERT_TRUE(previous == microseconds(250));
+
+    // Capped at 4 ms, and at half the period for fast targets.
+    ASSERT_TRUE(wakeAfter(microseconds(20000)) == microseconds(4000));
+    core::FramePacer fast(240);
+    fast.finishWait(deadline, fast.getSleepUntil(deadline) + milliseconds(20));
+    ASSERT_TRUE(fast.getStats().spinMargin == fast.getPeriod() / 2);
+    ASSERT_EQ(pacer.getStats().spins, uint64_t{0});
+    std::println("  ✓ Margin {} us after a 20 ms oversleep\n", previous.count());
+}
+
+void test_interval_percentiles() {
+    std::println("TEST: Interval percentiles and mean over the recent history");
+
+    core::FramePacer pacer(100);
+    ASSERT_TRUE(pacer.getIntervalPercentile(50) == nanoseconds(0));
+
+    pacer.beginFrame(at(0));
+    pacer.scheduleNextFrame(at(0));
+    int64_t now = 0;
+    auto frameAt = [&](int64_t lateMs) {
+        now = duration_cast<milliseconds>(*pacer.scheduleNextFrame(at(now)) - T0).count() + lateMs;
+        pacer.beginFrame(at(now));
+    };
+
+    // 97 on time, 3 hitches of 30 ms.
+    for (int i = 0; i < 100; ++i) {
+        frameAt(i % 33 == 32 ? 30 : 0);
+    }
+    ASSERT_EQ(pacer.getIntervalCount(), size_t{100});
+    ASSERT_TRUE(pacer.getIntervalPercentile(50) == milliseconds(10));
+    ASSERT_TRUE(pacer.getIntervalPercentile(97) == milliseconds(10));
+    ASSERT_TRUE(pacer.getIntervalPercentile(99) == milliseconds(40));
+    ASSERT_TRUE(pacer.getIntervalPercentile(100) == milliseconds(40));
+    ASSERT_TRUE(pacer.getMeanInterval() == microseconds(10900));
+    ASSERT_EQ(pacer.getStats().missedFrames, uint64_t{9});
+
+    // Only the last HISTORY_SIZE intervals count.
+    for (size_t i = 0; i < core::FramePacer::HISTORY_SIZE; ++i) {
+        frameAt(0);
+    }
+    ASSERT_EQ(pacer.getIntervalCount(), core::FramePacer::HISTORY_SIZE);
+    ASSERT_TRUE(pacer.getIntervalPercentile(100) == milliseconds(10));
+
+    pacer.resetStats();
+    ASSERT_EQ(pacer.getIntervalCount(), size_t{0});
+    ASSERT_EQ(pacer.getStats().frames, uint64_t{0});
+    std::println("  ✓ p50 10 ms, p99 40 ms\n");
+}
+
+// ============================================================================
+// MAIN TEST RUNNER
+// ============================================================================
+
+int main() {
+    try {
+        std::println("=== FRQS-Widget Frame Pacer Tests ===\n");
+
+        test_missed_periods_keep_phase();
+        test_spin_margin_adapts();
+        test_interval_percentiles();
+
+        std::println("✅ ALL TESTS PASSED!");
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::println(stderr, "\n❌ TEST FAILED: {}", e.what());
+        return 1;
+    }
+}
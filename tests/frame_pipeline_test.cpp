@@ -0,0 +1,317 @@
+// tests/frame_pipeline_test.cpp - One layout per container, fixed phase order, per-window frame rates
+#include "frqs-widget.hpp"
+#include "platform/event_loop_backend.hpp"
+#include "widget/internal.hpp"
+#include "widget/invalidation_sink.hpp"
+#include <algorithm>
+#include <memory>
+#include <print>
+#include <vector>
+
+using namespace frqs;
+using namespace frqs::widget;
+using namespace std::chrono;
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        std::println(stderr, "Assertion failed: {}", #cond); \
+        std::terminate(); \
+    }
+
+#define ASSERT_EQ(a, b) \
+    if ((a) != (b)) { \
+        std::println(stderr, "Assertion failed: {} != {}", #a, #b); \
+        std::println(stderr, "  Expected: {}", b); \
+        std::println(stderr, "  Got: {}", a); \
+        std::terminate(); \
+    }
+
+// ============================================================================
+// RECORDING SINK
+// ============================================================================
+
+/**
+ * @brief Stands in for a window: queues layout requests until `runLayouts()`.
+ */
+class RecordingSink final : public InvalidationSink {
+public:
+    std::vector<Widget*> queued;
+    std::vector<Widget*> cancelled;
+    int invalidations = 0;
+
+    void invalidateRect(const Rect<int32_t, uint32_t>&) noexcept override { ++invalidations; }
+    void invalidateAll() noexcept override { ++invalidations; }
+    uint64_t getGeneration() const noexcept override { return 0; }
+    void requestFocus(IWidget*) override {}
+    void releaseFocus(IWidget*) override {}
+
+    void requestLayout(Widget* widget) override { queued.push_back(widget); }
+    void cancelLayout(Widget* widget) noexcept override {
+        cancelled.push_back(widget);
+        std::erase(queued, widget);
+    }
+
+    size_t runLayouts() {
+        auto batch = std::move(queued);
+        queued.clear();
+        for (auto* widget : batch) {
+            widget->performLayout();
+        }
+        return batch.size();
+    }
+};
+
+/**
+ * @brief Stretches every child over the parent and counts how often it ran.
+ */
+class CountingLayout final : public ILayout {
+public:
+    int* applies;
+
+    explicit CountingLayout(int* counter) : applies(counter) {}
+
+    void apply(IWidget* parent) override {
+        ++*applies;
+        for (const auto& child : parent->getChildren()) {
+            child->setRect(parent->getRect());
+        }
+    }
+    Size<uint32_t> getMinimumSize() const noexcept override { return {}; }
+    Size<uint32_t> getPreferredSize() const noexcept override { return {}; }
+};
+
+/** @brief Creates a container laid out by a `CountingLayout`. */
+std::shared_ptr<Container> createCounted(int* counter) {
+    auto container = std::make_shared<Container>();
+    container->setLayout(std::make_unique<CountingLayout>(counter));
+    return container;
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void test_attached_layout_is_deferred() {
+    std::println("TEST: Changes to an attached container collapse into one layout");
+
+    RecordingSink sink;
+    int applies = 0;
+    auto panel = createCounted(&applies);
+    auto child = std::make_shared<Widget>();
+    panel->addChild(child);
+    applies = 0;
+    internal::setWidgetInvalidationSink(panel.get(), &sink);
+
+    panel->setRect(Rect<int32_t, uint32_t>(0, 0, 100, 100));
+    panel->setRect(Rect<int32_t, uint32_t>(0, 0, 200, 100));
+    panel->setPadding(4);
+    panel->setRect(Rect<int32_t, uint32_t>(0, 0, 200, 200));
+
+    ASSERT_EQ(sink.queued.size(), size_t{1});
+    ASSERT_TRUE(panel->isLayoutRequested());
+    ASSERT_EQ(applies, 0);
+    ASSERT_EQ(child->getRect().w, uint32_t{0});
+
+    ASSERT_EQ(sink.runLayouts(), size_t{1});
+    ASSERT_EQ(applies, 1);
+    ASSERT_TRUE(!panel->isLayoutRequested());
+    ASSERT_EQ(child->getRect().w, uint32_t{200});
+    ASSERT_EQ(child->getRect().h, uint32_t{200});
+
+    internal::setWidgetInvalidationSink(panel.get(), nullptr);
+    std::println("  ✓ Four changes, one layout\n");
+}
+
+void test_detached_layout_is_immediate() {
+    std::println("TEST: A detached container still lays out right away");
+
+    int applies = 0;
+    auto panel = createCounted(&applies);
+    auto child = std::make_shared<Widget>();
+    panel->addChild(child);
+    panel->setRect(Rect<int32_t, uint32_t>(0, 0, 120, 60));
+
+    ASSERT_TRUE(!panel->isLayoutRequested());
+    ASSERT_EQ(child->getRect().w, uint32_t{120});
+    std::println("  ✓ Laid out without a window ({} layouts)\n", applies);
+}
+
+void test_removed_container_cancels_request() {
+    std::println("TEST: Removing or destroying a queued container cancels its request");
+
+    RecordingSink sink;
+    auto root = std::make_shared<Container>();
+    root->setAutoLayout(false);
+    internal::setWidgetInvalidationSink(root.get(), &sink);
+
+    int applies = 0;
+    auto inner = createCounted(&applies);
+    root->addChild(inner);
+    inner->setRect(Rect<int32_t, uint32_t>(0, 0, 50, 50));
+    ASSERT_EQ(sink.queued.size(), size_t{1});
+
+    root->removeChild(inner.get());
+    ASSERT_TRUE(sink.queued.empty());
+    ASSERT_EQ(sink.cancelled.size(), size_t{1});
+    ASSERT_TRUE(!inner->isLayoutRequested());
+
+    // A queued widget destroyed while attached takes its request with it.
+    auto orphan = createCounted(&applies);
+    internal::setWidgetInvalidationSink(orphan.get(), &sink);
+    orphan->setPadding(2);
+    ASSERT_EQ(sink.queued.size(), size_t{1});
+    orphan.reset();
+    ASSERT_TRUE(sink.queued.empty());
+    ASSERT_EQ(sink.cancelled.size(), size_t{2});
+
+    internal::setWidgetInvalidationSink(root.get(), nullptr);
+    std::println("  ✓ No dangling layout requests\n");
+}
+
+void test_phase_order() {
+    std::println("TEST: A frame runs input, tasks, animate, layout, paint, present");
+
+    auto& app = core::Application::instance();
+    std::vector<core::FramePhase> phases;
+    app.setFramePhaseHook([&](core::FramePhase phase, steady_clock::time_point, nanoseconds duration) {
+        ASSERT_TRUE(duration >= nanoseconds(0));
+        phases.push_back(phase);
+    });
+
+    int taskPhase = -1;
+    app.postToUiThread([&] { taskPhase = static_cast<int>(phases.size()); });
+    app.pollEvents();
+    app.setFramePhaseHook(nullptr);
+
+    std::vector<core::FramePhase> expected = {
+        core::FramePhase::Input, core::FramePhase::Tasks, core::FramePhase::Animate,
+        core::FramePhase::Layout, core::FramePhase::Paint, core::FramePhase::Present
+    };
+    ASSERT_TRUE(phases == expected);
+    ASSERT_EQ(taskPhase, 1);    // After input ended, inside the task phase
+    ASSERT_TRUE(app.getFramePhaseTimes(core::FramePhase::Paint).getCount() >= 1);
+    std::println("  ✓ {} phases in order\n", phases.size());
+}
+
+void test_ticker_runs_at_frame_times() {
+    std::println("TEST: Frame tickers run once per paced frame, then the loop idles");
+
+    constexpr int TICKS = 6;
+    auto& app = core::Application::instance();
+    app.setTargetFps(60);
+    app.resetLoopStats();
+
+    std::vector<core::FramePacer::Clock::time_point> times;
+    core::FrameTickerId id = 0;
+    id = app.addFrameTicker([&](core::FramePacer::Clock::time_point frameTime) {
+        times.push_back(frameTime);
+        if (static_cast<int>(times.size()) < TICKS) return true;
+
+        // Done: unregister from inside the tick, then quit once the loop idled a while.
+        auto& application = core::Application::instance();
+        application.removeFrameTicker(id);
+        application.postDelayed([] { core::Application::instance().quit(); }, milliseconds(100));
+        return false;
+    });
+    app.run();
+
+    ASSERT_EQ(times.size(), size_t{TICKS});
+    // Paced frames report their deadlines: whole periods apart whatever the jitter.
+    auto period = app.getFramePacer().getPeriod();
+    for (size_t i = 2; i < times.size(); ++i) {
+        auto step = times[i] - times[i - 1];
+        ASSERT_TRUE(step >= period);
+        ASSERT_EQ((step % period).count(), decltype(period)::rep{0});
+    }
+    ASSERT_TRUE(app.getLoopStats().iterations <= TICKS + 4);
+    std::println("  ✓ {} ticks, {} loop passes\n", times.size(), app.getLoopStats().iterations);
+}
+
+void test_background_window_throttled() {
+    std::println("TEST: A background window paints every fourth frame of a 60 fps loop");
+
+    core::FrameThrottle throttle;   // Default policy: focused unlimited, background 15 fps
+    auto period = duration_cast<steady_clock::duration>(seconds(1)) / 60;
+    auto start = steady_clock::now();
+
+    int painted = 0;
+    for (int frame = 0; frame < 60; ++frame) {
+        auto tier = core::FrameThrottle::classify(true, false, false, false, false);
+        if (throttle.admit(tier, start + period * frame)) {
+            ++painted;
+            throttle.notePresented();
+        } else {
+            // Held back: the loop is asked to come back no later than the next slot.
+            ASSERT_TRUE(throttle.getRetryTime().has_value());
+        }
+    }
+
+    ASSERT_EQ(painted, 15);
+    ASSERT_EQ(throttle.getStats().reducedRate, uint64_t{15});
+    ASSERT_EQ(throttle.getStats().throttled, uint64_t{45});
+    ASSERT_TRUE(throttle.getTier() == core::FrameRateTier::Reduced);
+
+    // Focus brings it back to every frame, and so does an animation.
+    auto focused = core::FrameThrottle::classify(true, false, false, true, false);
+    ASSERT_TRUE(throttle.admit(focused, start + period * 60));
+    ASSERT_TRUE(throttle.admit(focused, start + period * 61));
+    auto animating = core::FrameThrottle::classify(true, false, false, false, true);
+    ASSERT_TRUE(animating == core::FrameRateTier::Full);
+    ASSERT_TRUE(throttle.admit(animating, start + period * 62));
+    ASSERT_TRUE(throttle.admit(animating, start + period * 63));
+    std::println("  ✓ {} of 60 frames painted in the background\n", painted);
+}
+
+void test_hidden_and_occluded_windows_paused() {
+    std::println("TEST: Minimized and covered windows paint nothing");
+
+    core::FrameThrottle throttle;
+    auto now = steady_clock::now();
+
+    auto minimized = core::FrameThrottle::classify(true, true, false, true, true);
+    ASSERT_TRUE(minimized == core::FrameRateTier::Hidden);
+    ASSERT_TRUE(!throttle.admit(minimized, now));
+    ASSERT_TRUE(!throttle.getRetryTime().has_value());   // Restoring sends a message
+
+    auto covered = core::FrameThrottle::classify(true, false, true, false, true);
+    ASSERT_TRUE(covered == core::FrameRateTier::Occluded);
+    ASSERT_TRUE(!throttle.admit(covered, now));
+    ASSERT_TRUE(throttle.getRetryTime() == now + throttle.getPolicy().occlusionProbe);
+
+    throttle.noteIdle();
+    ASSERT_TRUE(!throttle.getRetryTime().has_value());
+    ASSERT_EQ(throttle.getStats().hidden, uint64_t{1});
+    ASSERT_EQ(throttle.getStats().occluded, uint64_t{1});
+    ASSERT_EQ(throttle.getStats().presented, uint64_t{0});
+    std::println("  ✓ Paused, occluded window probed every {} ms\n",
+                 throttle.getPolicy().occlusionProbe.count());
+}
+
+// ============================================================================
+// MAIN TEST RUNNER
+// ============================================================================
+
+int main() {
+    try {
+        std::println("=== FRQS-Widget Frame Pipeline Tests ===\n");
+
+        test_attached_layout_is_deferred();
+        test_detached_layout_is_immediate();
+        test_removed_container_cancels_request();
+        test_background_window_throttled();
+        test_hidden_and_occluded_windows_paused();
+
+        auto& app = core::Application::instance();
+        app.setEventLoopBackend(std::make_unique<platform::HeadlessEventLoopBackend>());
+        app.setQuitOnLastWindowClosed(false);   // No windows in a headless run
+        test_phase_order();
+        test_ticker_runs_at_frame_times();
+
+        std::println("✅ ALL TESTS PASSED!");
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::println(stderr, "\n❌ TEST FAILED: {}", e.what());
+        return 1;
+    }
+}
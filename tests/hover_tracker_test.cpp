@@ -0,0 +1,194 @@
+// tests/hover_tracker_test.cpp - Hover path caching and enter/leave ordering
+#include "frqs-widget.hpp"
+#include "widget/hover_tracker.hpp"
+#include <memory>
+#include <print>
+#include <string>
+#include <vector>
+
+using namespace frqs;
+using namespace frqs::widget;
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        std::println(stderr, "Assertion failed: {}", #cond); \
+        std::terminate(); \
+    }
+
+#define ASSERT_EQ(a, b) \
+    if ((a) != (b)) { \
+        std::println(stderr, "Assertion failed: {} != {}", #a, #b); \
+        std::println(stderr, "  Expected: {}", b); \
+        std::println(stderr, "  Got: {}", a); \
+        std::terminate(); \
+    }
+
+using RectI = Rect<int32_t, uint32_t>;
+using Log = std::vector<std::string>;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/**
+ * @brief Logs the hover transitions it receives as "+name" (enter) and "-name" (leave).
+ */
+class HoverLogger : public Widget {
+public:
+    HoverLogger(std::string name, Log& log, const RectI& rect) : name_(std::move(name)), log_(log) {
+        setRect(rect);
+    }
+
+    bool onEvent(const event::Event& event) override {
+        if (auto* hover = std::get_if<event::MouseHoverEvent>(&event)) {
+            log_.push_back((hover->action == event::MouseHoverEvent::Action::Enter ? "+" : "-") + name_);
+        }
+        return false;
+    }
+
+private:
+    std::string name_;
+    Log& log_;
+};
+
+/**
+ * @brief root
+ *        ├─ left   (0..200)   ├─ a, b
+ *        └─ right  (200..400) └─ c
+ */
+struct Scene {
+    Log log;
+    std::shared_ptr<HoverLogger> root = std::make_shared<HoverLogger>("root", log, RectI(0, 0, 400u, 400u));
+    std::shared_ptr<HoverLogger> left = std::make_shared<HoverLogger>("left", log, RectI(0, 0, 200u, 400u));
+    std::shared_ptr<HoverLogger> right = std::make_shared<HoverLogger>("right", log, RectI(200, 0, 200u, 400u));
+    std::shared_ptr<HoverLogger> a = std::make_shared<HoverLogger>("a", log, RectI(10, 10, 50u, 50u));
+    std::shared_ptr<HoverLogger> b = std::make_shared<HoverLogger>("b", log, RectI(10, 100, 50u, 50u));
+    std::shared_ptr<HoverLogger> c = std::make_shared<HoverLogger>("c", log, RectI(210, 10, 50u, 50u));
+    std::shared_ptr<IWidget> tree = root;
+
+    Scene() {
+        left->addChild(a);
+        left->addChild(b);
+        right->addChild(c);
+        root->addChild(left);
+        root->addChild(right);
+    }
+
+    /** @brief Moves the cursor; the tree is unchanged unless `epoch` differs. */
+    IWidget* move(HoverTracker& tracker, int32_t x, int32_t y, uint64_t epoch = 1) {
+        return tracker.update(tree, Point<int32_t>(x, y), epoch, 0);
+    }
+};
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void test_enter_leave_order() {
+    std::println("TEST: Leave goes deepest first, enter outermost first, shared ancestors untouched");
+
+    Scene scene;
+    HoverTracker tracker;
+
+    ASSERT_TRUE(scene.move(tracker, 20, 20) == scene.a.get());
+    ASSERT_TRUE((scene.log == Log{"+root", "+left", "+a"}));
+
+    scene.log.clear();
+    ASSERT_TRUE(scene.move(tracker, 20, 110) == scene.b.get());
+    ASSERT_TRUE((scene.log == Log{"-a", "+b"}));
+
+    scene.log.clear();
+    ASSERT_TRUE(scene.move(tracker, 220, 20) == scene.c.get());
+    ASSERT_TRUE((scene.log == Log{"-b", "-left", "+right", "+c"}));
+    ASSERT_TRUE(tracker.isHovered(scene.right.get()));
+    ASSERT_TRUE(!tracker.isHovered(scene.left.get()));
+
+    // Onto the parent itself: only the child is left.
+    scene.log.clear();
+    ASSERT_TRUE(scene.move(tracker, 300, 300) == scene.right.get());
+    ASSERT_TRUE((scene.log == Log{"-c"}));
+
+    // Out of the window.
+    scene.log.clear();
+    tracker.clear(Point<int32_t>(-1, -1), 0);
+    ASSERT_TRUE((scene.log == Log{"-right", "-root"}));
+    ASSERT_TRUE(tracker.getHovered() == nullptr);
+    std::println("  ✓ Transitions in order\n");
+}
+
+void test_fast_rect_skips_hit_tests() {
+    std::println("TEST: Moves within the unobstructed leaf skip the hit test");
+
+    Scene scene;
+    HoverTracker tracker;
+    scene.move(tracker, 20, 20);
+    ASSERT_EQ(tracker.getFullHits(), size_t{1});
+
+    for (int32_t x = 11; x < 60; x += 7) {
+        ASSERT_TRUE(scene.move(tracker, x, 30) == scene.a.get());
+    }
+    ASSERT_EQ(tracker.getFullHits(), size_t{1});
+    ASSERT_EQ(tracker.getFastHits(), size_t{7});
+
+    // Out of the leaf: a full hit test again.
+    scene.move(tracker, 100, 300);
+    ASSERT_EQ(tracker.getFullHits(), size_t{2});
+    std::println("  ✓ {} fast hits\n", tracker.getFastHits());
+}
+
+void test_tree_change_drops_fast_rect() {
+    std::println("TEST: A changed tree epoch re-resolves, even inside the old fast rect");
+
+    Scene scene;
+    HoverTracker tracker;
+    scene.move(tracker, 20, 20);
+    scene.log.clear();
+
+    // `a` moves away from under a still cursor; the window's epoch changes.
+    scene.a->setRect(RectI(100, 300, 50u, 50u));
+    ASSERT_TRUE(scene.move(tracker, 20, 20, 2) == scene.left.get());
+    ASSERT_TRUE((scene.log == Log{"-a"}));
+    ASSERT_EQ(tracker.getFullHits(), size_t{2});
+
+    // A later sibling covering part of the leaf: no fast rect for it at all.
+    Log& log = scene.log;
+    auto cover = std::make_shared<HoverLogger>("cover", log, RectI(130, 330, 50u, 50u));
+    scene.left->addChild(cover);
+    scene.move(tracker, 110, 310, 3);
+    ASSERT_TRUE(tracker.getHovered() == scene.a.get());
+    size_t fullBefore = tracker.getFullHits();
+    scene.move(tracker, 111, 311, 3);
+    ASSERT_EQ(tracker.getFullHits(), fullBefore + 1);
+
+    // A hovered widget removed from the tree still gets its Leave.
+    log.clear();
+    std::weak_ptr<HoverLogger> removed = scene.a;
+    scene.left->removeChild(scene.a.get());
+    scene.a.reset();
+    ASSERT_TRUE(!removed.expired());        // Kept alive by the hover path
+    scene.move(tracker, 111, 311, 4);
+    ASSERT_TRUE((log == Log{"-a"}));
+    ASSERT_TRUE(removed.expired());
+    std::println("  ✓ Epoch, overlap and removal handled\n");
+}
+
+// ============================================================================
+// MAIN TEST RUNNER
+// ============================================================================
+
+int main() {
+    try {
+        std::println("=== FRQS-Widget Hover Tracker Tests ===\n");
+
+        test_enter_leave_order();
+        test_fast_rect_skips_hit_tests();
+        test_tree_change_drops_fast_rect();
+
+        std::println("✅ ALL TESTS PASSED!");
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::println(stderr, "\n❌ TEST FAILED: {}", e.what());
+        return 1;
+    }
+}
@@ -0,0 +1,185 @@
+// tests/idle_wakeup_test.cpp - An idle application must block, not poll
+#include "frqs-widget.hpp"
+#include "platform/event_loop_backend.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <print>
+#include <thread>
+
+using namespace frqs;
+using namespace std::chrono;
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        std::println(stderr, "Assertion failed: {}", #cond); \
+        std::terminate(); \
+    }
+
+#define ASSERT_EQ(a, b) \
+    if ((a) != (b)) { \
+        std::println(stderr, "Assertion failed: {} != {}", #a, #b); \
+        std::println(stderr, "  Expected: {}", b); \
+        std::println(stderr, "  Got: {}", a); \
+        std::terminate(); \
+    }
+
+// ============================================================================
+// HEADLESS HARNESS
+// ============================================================================
+
+namespace {
+    platform::HeadlessEventLoopBackend* g_backend = nullptr;
+
+    /**
+     * @brief Runs the loop on this thread until `stopper` (on another thread) quits it.
+     */
+    template <typename Stopper>
+    core::MainLoopStats runUntil(Stopper&& stopper) {
+        auto& app = core::Application::instance();
+        app.resetLoopStats();
+        std::thread worker(std::forward<Stopper>(stopper));
+        app.run();
+        worker.join();
+        return app.getLoopStats();
+    }
+}
+
+void installHeadlessBackend() {
+    auto& app = core::Application::instance();
+    auto backend = std::make_unique<platform::HeadlessEventLoopBackend>();
+    g_backend = backend.get();
+    app.setEventLoopBackend(std::move(backend));
+    app.setQuitOnLastWindowClosed(false);   // No windows in a headless run
+    app.setTargetFps(60);
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void test_idle_loop_sleeps(seconds idle) {
+    std::println("TEST: Idle loop for {} s", idle.count());
+
+    uint64_t waitsBefore = g_backend->getWaitCount();
+    auto stats = runUntil([idle] {
+        std::this_thread::sleep_for(idle);
+        core::Application::instance().quit();
+    });
+    uint64_t waits = g_backend->getWaitCount() - waitsBefore;
+
+    // One pass on start, one after quit() wakes it; a polling loop at 60 fps
+    // would have run 60 passes per second.
+    ASSERT_TRUE(stats.iterations <= 2);
+    ASSERT_EQ(stats.frameWaits, uint64_t{0});
+    ASSERT_TRUE(waits <= 1);
+    std::println("  ✓ {} loop passes, {} backend waits (polling would take {})\n",
+                 stats.iterations, waits, idle.count() * 60);
+}
+
+void test_task_wakes_idle_loop() {
+    std::println("TEST: A posted task wakes the idle loop");
+
+    std::atomic<int64_t> latencyUs{-1};
+    auto stats = runUntil([&] {
+        std::this_thread::sleep_for(milliseconds(200));
+        auto postedAt = steady_clock::now();
+        core::Application::instance().postToUiThread([&, postedAt] {
+            latencyUs = duration_cast<microseconds>(steady_clock::now() - postedAt).count();
+            core::Application::instance().quit();
+        });
+    });
+
+    ASSERT_TRUE(latencyUs >= 0);
+    ASSERT_TRUE(latencyUs < 100'000);
+    ASSERT_TRUE(stats.iterations <= 3);
+    std::println("  ✓ Ran {} us after posting, {} loop passes\n", latencyUs.load(), stats.iterations);
+}
+
+void test_message_wakes_idle_loop() {
+    std::println("TEST: A native message wakes the idle loop");
+
+    std::atomic<bool> dispatched{false};
+    auto stats = runUntil([&] {
+        std::this_thread::sleep_for(milliseconds(200));
+        g_backend->postMessage([&] { dispatched = true; });
+        std::this_thread::sleep_for(milliseconds(200));
+        core::Application::instance().quit();
+    });
+
+    ASSERT_TRUE(dispatched);
+    ASSERT_TRUE(stats.iterations <= 3);
+    std::println("  ✓ Dispatched, {} loop passes\n", stats.iterations);
+}
+
+void test_timers_wake_only_when_due() {
+    std::println("TEST: Timers wake the idle loop once per firing");
+
+    constexpr int FIRINGS = 10;
+    auto& app = core::Application::instance();
+    int fired = 0;
+    auto start = steady_clock::now();
+    core::TimerId timer = app.getTimers().schedulePeriodic(milliseconds(100), [&] {
+        if (++fired == FIRINGS) {
+            core::Application::instance().quit();
+        }
+    });
+
+    auto stats = runUntil([] {});
+    auto elapsed = steady_clock::now() - start;
+    app.getTimers().cancel(timer);
+
+    ASSERT_EQ(fired, FIRINGS);
+    ASSERT_TRUE(elapsed >= milliseconds(100 * FIRINGS));
+    // A timer moving down a wheel level may cost one extra pass per firing.
+    ASSERT_TRUE(stats.iterations <= 2 * FIRINGS + 2);
+    ASSERT_EQ(stats.frameWaits, uint64_t{0});
+    std::println("  ✓ {} firings in {} ms, {} loop passes\n",
+                 fired, duration_cast<milliseconds>(elapsed).count(), stats.iterations);
+}
+
+void test_animation_frame_then_idle() {
+    std::println("TEST: A requested animation frame is paced, then the loop idles");
+
+    auto stats = runUntil([] {
+        std::this_thread::sleep_for(milliseconds(100));
+        core::Application::instance().postToUiThread([] {
+            core::Application::instance().requestAnimationFrame();
+        });
+        std::this_thread::sleep_for(milliseconds(500));
+        core::Application::instance().quit();
+    });
+
+    // Start, the task's pass, the requested frame, and the pass after quit().
+    ASSERT_EQ(stats.frameWaits, uint64_t{1});
+    ASSERT_TRUE(stats.iterations <= 4);
+    std::println("  ✓ {} paced wait, {} idle waits, {} loop passes\n",
+                 stats.frameWaits, stats.idleWaits, stats.iterations);
+}
+
+// ============================================================================
+// MAIN TEST RUNNER
+// ============================================================================
+
+int main(int argc, char** argv) {
+    try {
+        std::println("=== FRQS-Widget Idle Wake-up Tests ===\n");
+
+        // The idle phase lasts a minute; pass a shorter time (in seconds) for quick runs.
+        seconds idle(argc > 1 ? std::atoi(argv[1]) : 60);
+
+        installHeadlessBackend();
+        test_idle_loop_sleeps(idle);
+        test_task_wakes_idle_loop();
+        test_message_wakes_idle_loop();
+        test_timers_wake_only_when_due();
+        test_animation_frame_then_idle();
+
+        std::println("✅ ALL TESTS PASSED!");
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::println(stderr, "\n❌ TEST FAILED: {}", e.what());
+        return 1;
+    }
+}
@@ -0,0 +1,206 @@
+// tests/invalidation_test.cpp - Widget repaint requests through the window's sink
+#include "frqs-widget.hpp"
+#include "widget/internal.hpp"
+#include "widget/invalidation_sink.hpp"
+#include <algorithm>
+#include <memory>
+#include <print>
+#include <vector>
+
+using namespace frqs;
+using namespace frqs::widget;
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        std::println(stderr, "Assertion failed: {}", #cond); \
+        std::terminate(); \
+    }
+
+#define ASSERT_EQ(a, b) \
+    if ((a) != (b)) { \
+        std::println(stderr, "Assertion failed: {} != {}", #a, #b); \
+        std::println(stderr, "  Expected: {}", b); \
+        std::println(stderr, "  Got: {}", a); \
+        std::terminate(); \
+    }
+
+using RectI = Rect<int32_t, uint32_t>;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/**
+ * @brief Records what widgets ask of their window; `flush()` ends a frame.
+ */
+class RecordingSink final : public InvalidationSink {
+public:
+    std::vector<RectI> rects;
+    uint64_t generation = 0;
+    int treeChanges = 0;
+
+    void invalidateRect(const RectI& rect) noexcept override { rects.push_back(rect); }
+    void invalidateAll() noexcept override {}
+    uint64_t getGeneration() const noexcept override { return generation; }
+    void requestFocus(IWidget*) override {}
+    void releaseFocus(IWidget*) override {}
+    void requestLayout(Widget*) override {}
+    void cancelLayout(Widget*) noexcept override {}
+    void noteTreeChanged() noexcept override { ++treeChanges; }
+
+    /** @brief Hands the frame's requests to the OS, as the window does once per loop pass. */
+    void flush() {
+        rects.clear();
+        ++generation;
+    }
+
+    [[nodiscard]] bool contains(const RectI& rect) const {
+        return std::find(rects.begin(), rects.end(), rect) != rects.end();
+    }
+};
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void test_repeats_dropped_within_a_generation() {
+    std::println("TEST: Exact repeats are dropped until the sink's generation advances");
+
+    RecordingSink sink;
+    auto widget = std::make_shared<Widget>();
+    widget->setRect(RectI(10, 10, 100u, 40u));
+    internal::setWidgetInvalidationSink(widget.get(), &sink);
+    sink.flush();
+
+    widget->invalidate();
+    widget->invalidate();
+    widget->invalidate();
+    ASSERT_EQ(sink.rects.size(), size_t{1});
+    ASSERT_TRUE(sink.rects[0] == RectI(10, 10, 100u, 40u));
+
+    // Only the last request is remembered: a different rect passes through.
+    widget->invalidateRect(RectI(12, 12, 5u, 5u));
+    widget->invalidateRect(RectI(12, 12, 5u, 5u));
+    widget->invalidate();
+    ASSERT_EQ(sink.rects.size(), size_t{3});
+
+    // Next frame: the same request is new again.
+    sink.flush();
+    widget->invalidate();
+    ASSERT_EQ(sink.rects.size(), size_t{1});
+
+    // Empty areas never reach the sink.
+    widget->invalidateRect(RectI(0, 0, 0u, 10u));
+    ASSERT_EQ(sink.rects.size(), size_t{1});
+
+    internal::setWidgetInvalidationSink(widget.get(), nullptr);
+    std::println("  ✓ One request per distinct rect per frame\n");
+}
+
+void test_set_rect_damages_old_and_new() {
+    std::println("TEST: Moving a widget damages the area it left and the one it entered");
+
+    RecordingSink sink;
+    auto widget = std::make_shared<Widget>();
+    const RectI before(0, 0, 50u, 50u);
+    const RectI after(200, 100, 50u, 50u);
+    widget->setRect(before);
+    internal::setWidgetInvalidationSink(widget.get(), &sink);
+    sink.flush();
+
+    widget->setRect(after);
+    ASSERT_EQ(sink.rects.size(), size_t{2});
+    ASSERT_TRUE(sink.contains(before));
+    ASSERT_TRUE(sink.contains(after));
+
+    // Same rect again: nothing to repaint.
+    widget->setRect(after);
+    ASSERT_EQ(sink.rects.size(), size_t{2});
+
+    internal::setWidgetInvalidationSink(widget.get(), nullptr);
+    std::println("  ✓ Both areas queued\n");
+}
+
+void test_detached_widgets_stay_silent() {
+    std::println("TEST: Detached widgets send nothing; re-attaching forgets the last request");
+
+    RecordingSink sink;
+    auto root = std::make_shared<Container>();
+    auto child = std::make_shared<Widget>();
+    child->setRect(RectI(5, 5, 20u, 20u));
+
+    child->invalidate();                                    // Not attached yet
+    root->addChild(child);
+    internal::setWidgetInvalidationSink(root.get(), &sink);
+    sink.flush();
+
+    child->invalidate();
+    ASSERT_EQ(sink.rects.size(), size_t{1});
+
+    // Leaving the tree detaches the subtree from the sink.
+    root->removeChild(child.get());
+    sink.rects.clear();
+    child->invalidate();
+    ASSERT_TRUE(sink.rects.empty());
+
+    // Back in the same generation: the remembered request must not swallow this one.
+    root->addChild(child);
+    sink.rects.clear();
+    child->invalidate();
+    ASSERT_EQ(sink.rects.size(), size_t{1});
+    ASSERT_TRUE(sink.rects[0] == RectI(5, 5, 20u, 20u));
+
+    internal::setWidgetInvalidationSink(root.get(), nullptr);
+    std::println("  ✓ No stale dedupe across attach\n");
+}
+
+void test_tree_changes_never_deduped() {
+    std::println("TEST: Hiding, moving and reparenting report a tree change even when the repaint is deduped");
+
+    RecordingSink sink;
+    auto root = std::make_shared<Container>();
+    auto child = std::make_shared<Widget>();
+    child->setRect(RectI(5, 5, 20u, 20u));
+    root->addChild(child);
+    internal::setWidgetInvalidationSink(root.get(), &sink);
+    sink.flush();
+
+    // The child's area is already queued: hiding it adds no repaint, but hover must re-resolve.
+    child->invalidate();
+    child->setVisible(false);
+    ASSERT_EQ(sink.rects.size(), size_t{1});
+    ASSERT_EQ(sink.treeChanges, 1);
+
+    child->setVisible(true);
+    child->setRect(RectI(50, 5, 20u, 20u));
+    ASSERT_EQ(sink.treeChanges, 3);
+
+    root->removeChild(child.get());
+    root->addChild(child);
+    ASSERT_EQ(sink.treeChanges, 5);
+
+    internal::setWidgetInvalidationSink(root.get(), nullptr);
+    std::println("  ✓ {} tree changes reported\n", sink.treeChanges);
+}
+
+// ============================================================================
+// MAIN TEST RUNNER
+// ============================================================================
+
+int main() {
+    try {
+        std::println("=== FRQS-Widget Invalidation Tests ===\n");
+
+        test_repeats_dropped_within_a_generation();
+        test_set_rect_damages_old_and_new();
+        test_detached_widgets_stay_silent();
+        test_tree_changes_never_deduped();
+
+        std::println("✅ ALL TESTS PASSED!");
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::println(stderr, "\n❌ TEST FAILED: {}", e.what());
+        return 1;
+    }
+}
@@ -0,0 +1,147 @@
+// tests/latency_monitor_test.cpp - Input-to-present latency histograms and budget
+#include "frqs-widget.hpp"
+#include "core/latency_monitor.hpp"
+#include <print>
+#include <vector>
+
+using namespace frqs;
+using namespace std::chrono;
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        std::println(stderr, "Assertion failed: {}", #cond); \
+        std::terminate(); \
+    }
+
+#define ASSERT_EQ(a, b) \
+    if ((a) != (b)) { \
+        std::println(stderr, "Assertion failed: {} != {}", #a, #b); \
+        std::println(stderr, "  Expected: {}", b); \
+        std::println(stderr, "  Got: {}", a); \
+        std::terminate(); \
+    }
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void test_bucket_bounds() {
+    std::println("TEST: Every sample lands in the bucket whose range contains it");
+
+    const std::vector<nanoseconds> samples = {
+        nanoseconds(0), nanoseconds(999), microseconds(1), microseconds(3), microseconds(5),
+        microseconds(7), microseconds(100), microseconds(1023), milliseconds(1),
+        milliseconds(16), milliseconds(17), milliseconds(250), seconds(3)
+    };
+
+    for (auto sample : samples) {
+        core::LatencyHistogram histogram;
+        histogram.record(sample);
+
+        const auto& buckets = histogram.getBuckets();
+        size_t bucket = 0;
+        while (buckets[bucket] == 0) ++bucket;
+
+        ASSERT_TRUE(sample < core::LatencyHistogram::getBucketUpperBound(bucket));
+        if (sample < microseconds(1)) {
+            ASSERT_EQ(bucket, size_t{0});   // Sub-microsecond samples share the first bucket
+            continue;
+        }
+        if (bucket > 0) {
+            ASSERT_TRUE(sample >= core::LatencyHistogram::getBucketUpperBound(bucket - 1));
+        }
+        // A quarter-octave wide at most.
+        ASSERT_TRUE(core::LatencyHistogram::getBucketUpperBound(bucket) <= sample * 5 / 4 + microseconds(1));
+    }
+
+    core::LatencyHistogram histogram;
+    histogram.record(hours(1));     // Past the last octave: clamped, not lost
+    ASSERT_EQ(histogram.getBuckets()[core::LatencyHistogram::BUCKET_COUNT - 1], uint64_t{1});
+    std::println("  ✓ {} samples bucketed\n", samples.size());
+}
+
+void test_percentiles() {
+    std::println("TEST: Percentiles, mean and extremes");
+
+    core::LatencyHistogram histogram;
+    for (int i = 0; i < 900; ++i) histogram.record(milliseconds(1));
+    for (int i = 0; i < 90; ++i) histogram.record(milliseconds(10));
+    for (int i = 0; i < 10; ++i) histogram.record(milliseconds(100));
+
+    ASSERT_EQ(histogram.getCount(), uint64_t{1000});
+    ASSERT_TRUE(histogram.getMin() == milliseconds(1));
+    ASSERT_TRUE(histogram.getMax() == milliseconds(100));
+    ASSERT_TRUE(histogram.getMean() == microseconds(2800));
+
+    auto p50 = histogram.getPercentile(50);
+    auto p99 = histogram.getPercentile(99);
+    ASSERT_TRUE(p50 >= milliseconds(1) && p50 <= microseconds(1250));
+    ASSERT_TRUE(p99 >= milliseconds(10) && p99 <= microseconds(12500));
+    ASSERT_TRUE(histogram.getPercentile(100) == milliseconds(100));   // Capped at the max
+
+    histogram.reset();
+    ASSERT_EQ(histogram.getCount(), uint64_t{0});
+    ASSERT_TRUE(histogram.getPercentile(50) == nanoseconds(0));
+    std::println("  ✓ p50 {} us, p99 {} us\n",
+                 duration_cast<microseconds>(p50).count(), duration_cast<microseconds>(p99).count());
+}
+
+void test_budget_callback() {
+    std::println("TEST: The budget callback fires once per over-budget event type");
+
+    core::LatencyMonitor monitor;
+    std::vector<core::LatencySample> reported;
+    monitor.setBudget(milliseconds(16), [&](const core::LatencySample& sample) {
+        reported.push_back(sample);
+    });
+
+    auto at = [](milliseconds t) { return static_cast<uint64_t>(nanoseconds(seconds(1) + t).count()); };
+    constexpr size_t MOVE = event::eventIndex<event::MouseMoveEvent>;
+    constexpr size_t KEY = event::eventIndex<event::KeyEvent>;
+
+    monitor.notePending(MOVE, at(milliseconds(5)));
+    monitor.notePending(MOVE, at(milliseconds(0)));     // The older input is what the user waited on
+    monitor.notePending(MOVE, at(milliseconds(8)));
+    monitor.notePending(KEY, at(milliseconds(10)));
+    ASSERT_TRUE(monitor.hasPending());
+
+    monitor.notePresented(at(milliseconds(20)));
+    ASSERT_TRUE(!monitor.hasPending());
+
+    ASSERT_EQ(reported.size(), size_t{1});
+    ASSERT_EQ(reported[0].eventIndex, MOVE);
+    ASSERT_TRUE(reported[0].latency == milliseconds(20));
+    ASSERT_EQ(monitor.getOverBudgetCount(), uint64_t{1});
+    ASSERT_EQ(monitor.getHistogram<event::MouseMoveEvent>().getCount(), uint64_t{1});
+    ASSERT_TRUE(monitor.getHistogram<event::KeyEvent>().getMax() == milliseconds(10));
+
+    // Nothing pending: a present records nothing.
+    monitor.notePresented(at(milliseconds(40)));
+    ASSERT_EQ(monitor.getHistogram<event::MouseMoveEvent>().getCount(), uint64_t{1});
+
+    monitor.reset();
+    ASSERT_EQ(monitor.getOverBudgetCount(), uint64_t{0});
+    ASSERT_EQ(monitor.getHistogram<event::KeyEvent>().getCount(), uint64_t{0});
+    std::println("  ✓ One report, {} ms\n", duration_cast<milliseconds>(reported[0].latency).count());
+}
+
+// ============================================================================
+// MAIN TEST RUNNER
+// ============================================================================
+
+int main() {
+    try {
+        std::println("=== FRQS-Widget Latency Monitor Tests ===\n");
+
+        test_bucket_bounds();
+        test_percentiles();
+        test_budget_callback();
+
+        std::println("✅ ALL TESTS PASSED!");
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::println(stderr, "\n❌ TEST FAILED: {}", e.what());
+        return 1;
+    }
+}
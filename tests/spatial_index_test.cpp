@@ -0,0 +1,196 @@
+// tests/spatial_index_test.cpp - Grid-indexed hit testing against a linear scan
+#include "frqs-widget.hpp"
+#include "widget/spatial_index.hpp"
+#include <memory>
+#include <print>
+#include <random>
+#include <vector>
+
+using namespace frqs;
+using namespace frqs::widget;
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        std::println(stderr, "Assertion failed: {}", #cond); \
+        std::terminate(); \
+    }
+
+#define ASSERT_EQ(a, b) \
+    if ((a) != (b)) { \
+        std::println(stderr, "Assertion failed: {} != {}", #a, #b); \
+        std::println(stderr, "  Expected: {}", b); \
+        std::println(stderr, "  Got: {}", a); \
+        std::terminate(); \
+    }
+
+using RectI = Rect<int32_t, uint32_t>;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+constexpr int32_t EXTENT = 1000;
+constexpr size_t CHILDREN = 600;
+
+/**
+ * @brief Gets a child rect: mostly small, some spanning much of the parent, a few outside it.
+ */
+RectI randomRect(std::mt19937& rng) {
+    std::uniform_int_distribution<int32_t> kind(0, 19);
+    std::uniform_int_distribution<int32_t> pos(-50, EXTENT);
+    std::uniform_int_distribution<uint32_t> small(1, 60);
+    std::uniform_int_distribution<uint32_t> large(300, 900);
+
+    switch (kind(rng)) {
+        case 0:  return RectI(pos(rng), pos(rng), large(rng), large(rng));  // Overflow list
+        case 1:  return RectI(EXTENT + 10, pos(rng), small(rng), small(rng));  // Off the grid
+        default: return RectI(pos(rng), pos(rng), small(rng), small(rng));
+    }
+}
+
+/**
+ * @brief The unindexed hit test: children in reverse order, then the parent itself.
+ */
+IWidget* linearHitTest(Widget& parent, const Point<int32_t>& point) {
+    auto rect = parent.getRect();
+    if (point.x < rect.x || point.x >= static_cast<int32_t>(rect.getRight()) ||
+        point.y < rect.y || point.y >= static_cast<int32_t>(rect.getBottom())) {
+        return nullptr;
+    }
+    const auto& children = parent.getChildren();
+    for (auto it = children.rbegin(); it != children.rend(); ++it) {
+        if (auto* hit = (*it)->hitTest(point)) return hit;
+    }
+    return &parent;
+}
+
+/**
+ * @brief Compares the parent's (indexed) hit test with the linear scan over a
+ *        lattice of points covering the parent and its edges.
+ * @return The number of points where they disagree.
+ */
+size_t compareLattice(Widget& parent) {
+    size_t mismatches = 0;
+    for (int32_t y = -7; y < EXTENT + 7; y += 7) {
+        for (int32_t x = -7; x < EXTENT + 7; x += 7) {
+            Point<int32_t> point(x, y);
+            mismatches += parent.hitTest(point) == linearHitTest(parent, point) ? 0 : 1;
+        }
+    }
+    return mismatches;
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void test_grid_matches_linear_scan() {
+    std::println("TEST: The indexed hit test returns what the reverse scan returns");
+
+    std::mt19937 rng(12345);
+    auto parent = std::make_shared<Widget>();
+    parent->setRect(RectI(0, 0, static_cast<uint32_t>(EXTENT), static_cast<uint32_t>(EXTENT)));
+    parent->setHitIndexThreshold(16);
+    for (size_t i = 0; i < CHILDREN; ++i) {
+        auto child = std::make_shared<Widget>();
+        child->setRect(randomRect(rng));
+        parent->addChild(child);
+    }
+
+    ASSERT_EQ(compareLattice(*parent), size_t{0});
+
+    // Hidden children stay indexed but are never hit.
+    const auto& children = parent->getChildren();
+    for (size_t i = 0; i < children.size(); i += 5) {
+        children[i]->setVisible(false);
+    }
+    ASSERT_EQ(compareLattice(*parent), size_t{0});
+    std::println("  ✓ {} children, lattice agrees\n", children.size());
+}
+
+void test_incremental_update_after_set_rect() {
+    std::println("TEST: Moved children are found at their new place without a rebuild");
+
+    std::mt19937 rng(777);
+    auto parent = std::make_shared<Widget>();
+    parent->setRect(RectI(0, 0, static_cast<uint32_t>(EXTENT), static_cast<uint32_t>(EXTENT)));
+    parent->setHitIndexThreshold(16);
+    for (size_t i = 0; i < CHILDREN; ++i) {
+        auto child = std::make_shared<Widget>();
+        child->setRect(randomRect(rng));
+        parent->addChild(child);
+    }
+    (void)parent->hitTest(Point<int32_t>(1, 1));    // Builds the index
+
+    // Move a third of them, into and out of the overflow and off-grid lists too.
+    const auto& children = parent->getChildren();
+    for (size_t i = 0; i < children.size(); i += 3) {
+        children[i]->setRect(randomRect(rng));
+    }
+    ASSERT_EQ(compareLattice(*parent), size_t{0});
+
+    // A child moved into a corner nobody else covers is hit there.
+    auto& mover = children[children.size() / 2];
+    mover->setRect(RectI(EXTENT - 4, EXTENT - 4, 4u, 4u));
+    for (const auto& other : children) {
+        auto rect = other->getRect();
+        if (other != mover && static_cast<int32_t>(rect.getRight()) > EXTENT - 4 &&
+            static_cast<int32_t>(rect.getBottom()) > EXTENT - 4) {
+            other->setRect(RectI(0, 0, 1u, 1u));
+        }
+    }
+    ASSERT_TRUE(parent->hitTest(Point<int32_t>(EXTENT - 2, EXTENT - 2)) == mover.get());
+    ASSERT_EQ(compareLattice(*parent), size_t{0});
+    std::println("  ✓ Index kept in step with {} moves\n", children.size() / 3 + 1);
+}
+
+void test_grid_update_contract() {
+    std::println("TEST: SpatialGrid::update reports a child not found where expected");
+
+    std::vector<std::shared_ptr<IWidget>> children;
+    for (int i = 0; i < 40; ++i) {
+        auto child = std::make_shared<Widget>();
+        child->setRect(RectI(i * 20, i * 20, 15u, 15u));
+        children.push_back(child);
+    }
+
+    SpatialGrid grid;
+    const RectI bounds(0, 0, 800u, 800u);
+    grid.build(bounds, children, [](IWidget*) { return true; });
+    ASSERT_EQ(grid.size(), children.size());
+    ASSERT_TRUE(grid.getCellCount() > 1);
+    ASSERT_TRUE(grid.hitTest(Point<int32_t>(105, 105)) == children[5].get());
+
+    // Moved: the grid follows when told where the child was.
+    const RectI oldRect = children[5]->getRect();
+    children[5]->setRect(RectI(700, 20, 15u, 15u));
+    ASSERT_TRUE(grid.update(children[5].get(), oldRect, children[5]->getRect()));
+    ASSERT_TRUE(grid.hitTest(Point<int32_t>(705, 25)) == children[5].get());
+    ASSERT_TRUE(grid.hitTest(Point<int32_t>(105, 105)) == nullptr);
+
+    // Told the wrong old rect: not found, the caller must rebuild.
+    ASSERT_TRUE(!grid.update(children[6].get(), RectI(500, 0, 15u, 15u), RectI(0, 700, 15u, 15u)));
+    ASSERT_EQ(grid.size(), children.size());
+    std::println("  ✓ {} cells\n", grid.getCellCount());
+}
+
+// ============================================================================
+// MAIN TEST RUNNER
+// ============================================================================
+
+int main() {
+    try {
+        std::println("=== FRQS-Widget Spatial Index Tests ===\n");
+
+        test_grid_matches_linear_scan();
+        test_incremental_update_after_set_rect();
+        test_grid_update_contract();
+
+        std::println("✅ ALL TESTS PASSED!");
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::println(stderr, "\n❌ TEST FAILED: {}", e.what());
+        return 1;
+    }
+}
@@ -0,0 +1,336 @@
+// tests/task_queue_test.cpp - MPSC queue, wake signal, UniqueTask and ThreadPool
+#include "frqs-widget.hpp"
+#include "platform/mpsc_queue.hpp"
+#include "platform/thread_pool.hpp"
+#include "platform/unique_task.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <print>
+#include <thread>
+#include <vector>
+
+using namespace frqs;
+using namespace std::chrono;
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        std::println(stderr, "Assertion failed: {}", #cond); \
+        std::terminate(); \
+    }
+
+#define ASSERT_EQ(a, b) \
+    if ((a) != (b)) { \
+        std::println(stderr, "Assertion failed: {} != {}", #a, #b); \
+        std::println(stderr, "  Expected: {}", b); \
+        std::println(stderr, "  Got: {}", a); \
+        std::terminate(); \
+    }
+
+// ============================================================================
+// MPSC QUEUE
+// ============================================================================
+
+/**
+ * @brief One queued item: who pushed it and its position in that producer's sequence.
+ */
+struct Item {
+    int producer;
+    int sequence;
+};
+
+void test_multi_producer_order() {
+    std::println("TEST: Many producers, one consumer: nothing lost, per-producer order kept");
+
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 20000;
+    platform::MpscQueue<Item> queue;
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&queue, p] {
+            for (int i = 0; i < PER_PRODUCER; ++i) {
+                queue.push(Item{p, i});
+            }
+        });
+    }
+
+    std::array<int, PRODUCERS> next{};
+    bool ordered = true;
+    int received = 0;
+    while (received < PRODUCERS * PER_PRODUCER) {
+        received += static_cast<int>(queue.processAll([&](Item&& item) {
+            ordered = ordered && item.sequence == next[item.producer];
+            next[item.producer] = item.sequence + 1;
+        }));
+    }
+    for (auto& producer : producers) producer.join();
+
+    ASSERT_TRUE(ordered);
+    for (int p = 0; p < PRODUCERS; ++p) {
+        ASSERT_EQ(next[p], PER_PRODUCER);
+    }
+    ASSERT_TRUE(queue.isEmpty());
+    std::println("  ✓ {} items in order\n", received);
+}
+
+/**
+ * @brief An intrusive node tagged with its producer and sequence number.
+ */
+struct TaggedNode : platform::MpscHook {
+    int producer = 0;
+    int sequence = 0;
+};
+
+void test_intrusive_drain_never_sticks() {
+    std::println("TEST: Draining an intrusive queue under contention finds every pushed node");
+
+    constexpr int PRODUCERS = 8;
+    constexpr int PER_PRODUCER = 10000;
+    platform::IntrusiveMpscQueue queue;
+    std::vector<std::unique_ptr<TaggedNode[]>> nodes;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        nodes.push_back(std::make_unique<TaggedNode[]>(PER_PRODUCER));
+    }
+
+    std::atomic<int> finished{0};
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&, p] {
+            for (int i = 0; i < PER_PRODUCER; ++i) {
+                nodes[p][i].producer = p;
+                nodes[p][i].sequence = i;
+                queue.push(&nodes[p][i]);
+                std::this_thread::yield();  // Keeps the queue near empty, where pop() re-pushes the stub
+            }
+            finished.fetch_add(1);
+        });
+    }
+
+    std::array<int, PRODUCERS> next{};
+    bool ordered = true;
+    int received = 0;
+    auto consume = [&](platform::MpscHook* hook) {
+        auto* node = static_cast<TaggedNode*>(hook);
+        ordered = ordered && node->sequence == next[node->producer];
+        next[node->producer] = node->sequence + 1;
+        ++received;
+    };
+    while (finished.load() < PRODUCERS) {
+        queue.drain(consume);
+    }
+    for (auto& producer : producers) producer.join();
+
+    // Every push is complete: a few drains must empty the queue, whatever state it was left in.
+    for (int attempt = 0; attempt < 4 && received < PRODUCERS * PER_PRODUCER; ++attempt) {
+        queue.drain(consume);
+    }
+
+    ASSERT_EQ(received, PRODUCERS * PER_PRODUCER);
+    ASSERT_TRUE(ordered);
+    ASSERT_TRUE(queue.isEmpty());
+    ASSERT_TRUE(queue.pop() == nullptr);
+    std::println("  ✓ {} nodes drained\n", received);
+}
+
+void test_bounded_rejection() {
+    std::println("TEST: A bounded queue rejects pushes beyond its capacity");
+
+    platform::MpscQueue<int> queue(4);
+    int accepted = 0;
+    for (int i = 0; i < 6; ++i) {
+        accepted += queue.push(int{i}) ? 1 : 0;
+    }
+    ASSERT_EQ(accepted, 4);
+    ASSERT_EQ(queue.size(), size_t{4});
+    ASSERT_EQ(queue.getRejectedCount(), uint64_t{2});
+
+    std::vector<int> drained;
+    queue.processAll([&](int&& value) { drained.push_back(value); });
+    ASSERT_TRUE((drained == std::vector<int>{0, 1, 2, 3}));   // The oldest ones were kept
+    ASSERT_EQ(queue.size(), size_t{0});
+
+    ASSERT_TRUE(queue.push(int{7}));     // Room again after the drain
+    ASSERT_EQ(queue.tryPop().value_or(-1), 7);
+    std::println("  ✓ 2 rejected, capacity restored after drain\n");
+}
+
+void test_wake_signal() {
+    std::println("TEST: The consumer sleeps until a push wakes it");
+
+    platform::MpscQueue<int> queue;
+
+    // Nothing pushed: the wait times out.
+    auto start = steady_clock::now();
+    ASSERT_TRUE(!queue.waitFor(milliseconds(20)));
+    ASSERT_TRUE(steady_clock::now() - start >= milliseconds(20));
+
+    // Already pending: returns at once.
+    queue.push(int{1});
+    ASSERT_TRUE(queue.waitFor(seconds(5)));
+    (void)queue.tryPop();
+
+    // Pushed while sleeping: woken long before the timeout.
+    std::atomic<int> wakeHandlerCalls{0};
+    queue.getWakeSignal().setWakeHandler([&] { wakeHandlerCalls.fetch_add(1); });
+    std::thread producer([&] {
+        std::this_thread::sleep_for(milliseconds(30));
+        queue.push(int{2});
+    });
+    start = steady_clock::now();
+    ASSERT_TRUE(queue.waitFor(seconds(5)));
+    auto waited = steady_clock::now() - start;
+    producer.join();
+
+    ASSERT_TRUE(waited < seconds(2));
+    ASSERT_EQ(queue.tryPop().value_or(-1), 2);
+    ASSERT_TRUE(wakeHandlerCalls.load() <= 1);
+    std::println("  ✓ Woken after {} ms\n", duration_cast<milliseconds>(waited).count());
+}
+
+// ============================================================================
+// UNIQUE TASK
+// ============================================================================
+
+void test_unique_task_move_only_capture() {
+    std::println("TEST: UniqueTask holds move-only captures and runs them once moved");
+
+    auto value = std::make_unique<int>(41);
+    int seen = 0;
+    platform::UniqueTask task([owned = std::move(value), &seen] { seen = *owned + 1; });
+    ASSERT_TRUE(static_cast<bool>(task));
+
+    platform::UniqueTask moved = std::move(task);
+    ASSERT_TRUE(!task);
+    moved();
+    ASSERT_EQ(seen, 42);
+
+    // A queue of tasks, as the UI scheduler keeps them.
+    platform::MpscQueue<platform::UniqueTask> queue;
+    queue.push(platform::UniqueTask([owned = std::make_unique<int>(7), &seen] { seen = *owned; }));
+    queue.processAll([](platform::UniqueTask&& queued) { queued(); });
+    ASSERT_EQ(seen, 7);
+    std::println("  ✓ unique_ptr capture ran\n");
+}
+
+void test_unique_task_spill_counters() {
+    std::println("TEST: Only callables too large for the inline buffer spill to the heap");
+
+    auto before = platform::getTaskSpillStats();
+
+    int counter = 0;
+    auto small = [&counter] { ++counter; };
+    static_assert(platform::UniqueTask::fitsInline<decltype(small)>);
+    platform::UniqueTask inlineTask(small);
+    inlineTask();
+    ASSERT_EQ(platform::getTaskSpillStats().spills, before.spills);
+
+    std::array<char, 200> payload{};
+    payload[199] = 1;
+    auto large = [payload, &counter] { counter += payload[199]; };
+    static_assert(!platform::UniqueTask::fitsInline<decltype(large)>);
+    platform::UniqueTask spilledTask(large);
+    platform::UniqueTask movedTask = std::move(spilledTask);   // Moves the pointer only
+    movedTask();
+
+    auto after = platform::getTaskSpillStats();
+    ASSERT_EQ(counter, 2);
+    ASSERT_EQ(after.spills, before.spills + 1);
+    ASSERT_TRUE(after.spilledBytes >= before.spilledBytes + sizeof(large));
+    ASSERT_TRUE(after.largestSpill >= sizeof(large));
+    std::println("  ✓ 1 spill of {} bytes\n", sizeof(large));
+}
+
+// ============================================================================
+// THREAD POOL
+// ============================================================================
+
+void test_parallel_reduce_uneven_chunks() {
+    std::println("TEST: parallelReduce over chunks that do not divide the range");
+
+    platform::ThreadPool pool(3);
+
+    // 1000 indices in chunks of 7: the last chunk holds 6.
+    uint64_t sum = pool.parallelReduce(size_t{0}, size_t{1000}, uint64_t{0},
+        [](size_t begin, size_t end) {
+            uint64_t partial = 0;
+            for (size_t i = begin; i < end; ++i) partial += i;
+            return partial;
+        },
+        [](uint64_t a, uint64_t b) { return a + b; }, 7);
+    ASSERT_EQ(sum, uint64_t{999 * 1000 / 2});
+
+    // A non-commutative combine sees the chunks left to right.
+    auto indices = pool.parallelReduce(size_t{3}, size_t{103}, std::vector<size_t>{},
+        [](size_t begin, size_t end) {
+            std::vector<size_t> chunk;
+            for (size_t i = begin; i < end; ++i) chunk.push_back(i);
+            return chunk;
+        },
+        [](std::vector<size_t> a, std::vector<size_t> b) {
+            a.insert(a.end(), b.begin(), b.end());
+            return a;
+        }, 9);
+    ASSERT_EQ(indices.size(), size_t{100});
+    bool inOrder = true;
+    for (size_t i = 0; i < indices.size(); ++i) {
+        inOrder = inOrder && indices[i] == i + 3;
+    }
+    ASSERT_TRUE(inOrder);
+
+    // Empty range: the identity.
+    ASSERT_EQ(pool.parallelReduce(size_t{5}, size_t{5}, 17, [](size_t, size_t) { return 0; },
+                                  [](int a, int b) { return a + b; }), 17);
+    std::println("  ✓ Sum {} and ordered combine\n", sum);
+}
+
+void test_shutdown_runs_queued_work() {
+    std::println("TEST: Destroying the pool runs the work still queued");
+
+    constexpr int TASKS = 2000;
+    std::atomic<int> ran{0};
+    {
+        platform::ThreadPool pool(2);
+        // Keep both workers busy so most tasks are still queued at shutdown.
+        for (int i = 0; i < 2; ++i) {
+            pool.submit([&ran] {
+                std::this_thread::sleep_for(milliseconds(20));
+                ran.fetch_add(1);
+            });
+        }
+        for (int i = 0; i < TASKS - 2; ++i) {
+            pool.submit([&ran, owned = std::make_unique<int>(1)] { ran.fetch_add(*owned); },
+                        static_cast<size_t>(i));
+        }
+        ASSERT_TRUE(ran.load() < TASKS);
+    }
+    ASSERT_EQ(ran.load(), TASKS);
+    std::println("  ✓ All {} tasks ran before the workers joined\n", TASKS);
+}
+
+// ============================================================================
+// MAIN TEST RUNNER
+// ============================================================================
+
+int main() {
+    try {
+        std::println("=== FRQS-Widget Task Queue Tests ===\n");
+
+        test_multi_producer_order();
+        test_intrusive_drain_never_sticks();
+        test_bounded_rejection();
+        test_wake_signal();
+        test_unique_task_move_only_capture();
+        test_unique_task_spill_counters();
+        test_parallel_reduce_uneven_chunks();
+        test_shutdown_runs_queued_work();
+
+        std::println("✅ ALL TESTS PASSED!");
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::println(stderr, "\n❌ TEST FAILED: {}", e.what());
+        return 1;
+    }
+}
@@ -0,0 +1,289 @@
+// tests/timer_wheel_test.cpp - Timer wheel, debouncer and throttler on an injected clock
+#include "frqs-widget.hpp"
+#include "core/timer_wheel.hpp"
+#include <print>
+#include <string>
+#include <vector>
+
+using namespace frqs;
+using namespace std::chrono;
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        std::println(stderr, "Assertion failed: {}", #cond); \
+        std::terminate(); \
+    }
+
+#define ASSERT_EQ(a, b) \
+    if ((a) != (b)) { \
+        std::println(stderr, "Assertion failed: {} != {}", #a, #b); \
+        std::println(stderr, "  Expected: {}", b); \
+        std::println(stderr, "  Got: {}", a); \
+        std::terminate(); \
+    }
+
+using Clock = core::TimerWheel::Clock;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+/** @brief Tick 0 of every wheel here; nothing reads the real clock. */
+const Clock::time_point START = Clock::time_point(seconds(1000));
+
+/** @brief Gets the time `ms` milliseconds after START. */
+Clock::time_point at(int64_t ms) {
+    return START + milliseconds(ms);
+}
+
+/** @brief Gets how far `time` is past START, in milliseconds. */
+int64_t msOf(Clock::time_point time) {
+    return duration_cast<milliseconds>(time - START).count();
+}
+
+// ============================================================================
+// TIMER WHEEL
+// ============================================================================
+
+void test_one_shot_never_early() {
+    std::println("TEST: A one-shot timer fires at its deadline, never before");
+
+    core::TimerWheel wheel(START);
+    int fired = 0;
+    core::TimerId id = wheel.scheduleAt(at(10), [&] { ++fired; });
+    wheel.scheduleAt(at(20) + microseconds(500), [&] { fired += 10; });   // Rounds up to 21 ms
+    ASSERT_EQ(wheel.size(), size_t{2});
+
+    ASSERT_EQ(wheel.advance(at(9)), size_t{0});
+    ASSERT_TRUE(wheel.isPending(id));
+    ASSERT_EQ(wheel.advance(at(10)), size_t{1});
+    ASSERT_EQ(fired, 1);
+    ASSERT_TRUE(!wheel.isPending(id));
+
+    ASSERT_EQ(wheel.advance(at(20) + microseconds(900)), size_t{0});
+    ASSERT_EQ(wheel.advance(at(21)), size_t{1});
+    ASSERT_EQ(fired, 11);
+    ASSERT_TRUE(wheel.empty());
+
+    // A deadline already passed runs on the next tick.
+    wheel.scheduleAt(at(5), [&] { ++fired; });
+    ASSERT_EQ(wheel.advance(at(21)), size_t{0});
+    ASSERT_EQ(wheel.advance(at(22)), size_t{1});
+    std::println("  ✓ Fired on time\n");
+}
+
+void test_deadline_order() {
+    std::println("TEST: Timers due in one advance run in deadline order");
+
+    core::TimerWheel wheel(START);
+    std::vector<int> order;
+    for (int ms : {70, 3, 500, 64, 65, 4000, 1}) {
+        wheel.scheduleAt(at(ms), [&order, ms] { order.push_back(ms); });
+    }
+
+    ASSERT_EQ(wheel.advance(at(5000)), size_t{7});
+    ASSERT_TRUE((order == std::vector<int>{1, 3, 64, 65, 70, 500, 4000}));
+    std::println("  ✓ {} timers in order\n", order.size());
+}
+
+void test_periodic_skips_missed_periods() {
+    std::println("TEST: A periodic timer skips missed periods and keeps its phase");
+
+    core::TimerWheel wheel(START);
+    int fired = 0;
+    core::TimerId id = wheel.schedulePeriodicAt(at(10), milliseconds(10), [&] { ++fired; });
+
+    ASSERT_EQ(wheel.advance(at(10)), size_t{1});
+    ASSERT_EQ(wheel.advance(at(20)), size_t{1});
+    ASSERT_TRUE(wheel.isPending(id));
+
+    // The loop stalls for five periods: one catch-up run, not five.
+    ASSERT_EQ(wheel.advance(at(75)), size_t{1});
+    ASSERT_EQ(fired, 3);
+    ASSERT_EQ(msOf(*wheel.getNextDeadline()), int64_t{80});
+
+    ASSERT_EQ(wheel.advance(at(80)), size_t{1});
+    ASSERT_TRUE(wheel.cancel(id));
+    ASSERT_TRUE(!wheel.cancel(id));
+    ASSERT_EQ(wheel.advance(at(200)), size_t{0});
+    ASSERT_EQ(fired, 4);
+    ASSERT_TRUE(wheel.empty());
+    std::println("  ✓ Next run stays on the 10 ms grid\n");
+}
+
+void test_periodic_cancels_itself() {
+    std::println("TEST: A periodic task may cancel its own timer");
+
+    core::TimerWheel wheel(START);
+    int fired = 0;
+    core::TimerId id = core::INVALID_TIMER;
+    id = wheel.schedulePeriodicAt(at(5), milliseconds(5), [&] {
+        if (++fired == 3) {
+            ASSERT_TRUE(wheel.isPending(id));   // Still armed while its task runs
+            ASSERT_TRUE(wheel.cancel(id));
+        }
+    });
+
+    for (int64_t ms : {5, 10, 15}) {
+        ASSERT_EQ(wheel.advance(at(ms)), size_t{1});
+    }
+    ASSERT_TRUE(!wheel.isPending(id));
+    ASSERT_EQ(wheel.advance(at(100)), size_t{0});
+    ASSERT_TRUE(wheel.empty());
+    ASSERT_TRUE(!wheel.getNextDeadline());
+    std::println("  ✓ Stopped after {} runs\n", fired);
+}
+
+void test_cancel_and_reschedule() {
+    std::println("TEST: Cancelled timers never run; rescheduled ones move");
+
+    core::TimerWheel wheel(START);
+    std::vector<std::string> ran;
+    core::TimerId cancelled = wheel.scheduleAt(at(10), [&] { ran.push_back("cancelled"); });
+    core::TimerId moved = wheel.scheduleAt(at(10), [&] { ran.push_back("moved"); });
+    core::TimerId early = wheel.scheduleAt(at(500), [&] { ran.push_back("early"); });
+
+    ASSERT_TRUE(wheel.cancel(cancelled));
+    ASSERT_TRUE(!wheel.isPending(cancelled));
+    ASSERT_TRUE(wheel.reschedule(moved, at(300)));      // Down to a higher level
+    ASSERT_TRUE(wheel.reschedule(early, at(20)));       // And back down
+    ASSERT_EQ(wheel.size(), size_t{2});
+
+    ASSERT_EQ(wheel.advance(at(20)), size_t{1});
+    ASSERT_EQ(wheel.advance(at(299)), size_t{0});
+    ASSERT_EQ(wheel.advance(at(300)), size_t{1});
+    ASSERT_TRUE((ran == std::vector<std::string>{"early", "moved"}));
+
+    // Stale ids are harmless, even once their node is reused.
+    ASSERT_TRUE(!wheel.reschedule(moved, at(400)));
+    ASSERT_TRUE(!wheel.cancel(cancelled));
+    core::TimerId reused = wheel.scheduleAt(at(400), [] {});
+    ASSERT_TRUE(!wheel.isPending(moved));
+    ASSERT_TRUE(wheel.isPending(reused));
+    std::println("  ✓ Cancel and reschedule respected\n");
+}
+
+void test_cascade_across_levels() {
+    std::println("TEST: Far timers move down the levels and fire exactly on time");
+
+    core::TimerWheel wheel(START);
+    // Level 0, 1, 2, 3, and past one turn of the top level (about 4.6 hours).
+    const std::vector<int64_t> deadlines = {
+        7, 200, 5'000, 300'007, 18'000'000
+    };
+    std::vector<int64_t> firedAt;
+    Clock::time_point current = START;
+    for (int64_t ms : deadlines) {
+        wheel.scheduleAt(at(ms), [&] { firedAt.push_back(msOf(current)); });
+    }
+
+    // Drive it like the loop: sleep until the next deadline, then advance.
+    size_t wakeups = 0;
+    while (!wheel.empty()) {
+        current = *wheel.getNextDeadline();
+        ASSERT_TRUE(current > START);
+        wheel.advance(current);
+        ++wakeups;
+    }
+
+    ASSERT_TRUE(firedAt == deadlines);
+    // A far timer costs one wakeup per level it moves down, not one per tick.
+    ASSERT_TRUE(wakeups <= deadlines.size() * core::TimerWheel::LEVELS + 2);
+    std::println("  ✓ {} timers, {} wakeups\n", firedAt.size(), wakeups);
+}
+
+// ============================================================================
+// DEBOUNCE / THROTTLE
+// ============================================================================
+
+void test_debouncer() {
+    std::println("TEST: The debouncer runs the latest task once triggers pause");
+
+    core::TimerWheel wheel(START);
+    core::Debouncer debouncer(wheel, milliseconds(50));
+    std::vector<std::string> ran;
+
+    debouncer.trigger([&] { ran.push_back("a"); }, at(0));
+    debouncer.trigger([&] { ran.push_back("b"); }, at(30));     // Restarts the delay
+    ASSERT_TRUE(debouncer.isPending());
+
+    ASSERT_EQ(wheel.advance(at(79)), size_t{0});
+    ASSERT_EQ(wheel.advance(at(80)), size_t{1});
+    ASSERT_TRUE((ran == std::vector<std::string>{"b"}));
+    ASSERT_TRUE(!debouncer.isPending());
+
+    // A new burst after it fired starts over.
+    debouncer.trigger([&] { ran.push_back("c"); }, at(100));
+    ASSERT_EQ(wheel.advance(at(150)), size_t{1});
+    ASSERT_TRUE((ran == std::vector<std::string>{"b", "c"}));
+
+    // Cancelled: nothing runs.
+    debouncer.trigger([&] { ran.push_back("d"); }, at(200));
+    debouncer.cancel();
+    ASSERT_EQ(wheel.advance(at(1000)), size_t{0});
+    ASSERT_EQ(ran.size(), size_t{2});
+    ASSERT_TRUE(wheel.empty());
+    std::println("  ✓ One run per burst\n");
+}
+
+void test_throttler() {
+    std::println("TEST: The throttler runs at most once per interval, keeping the last trigger");
+
+    core::TimerWheel wheel(START);
+    core::Throttler throttler(wheel, milliseconds(100));
+    std::vector<std::string> ran;
+
+    throttler.trigger([&] { ran.push_back("a"); }, at(0));      // Leading edge: at once
+    ASSERT_TRUE((ran == std::vector<std::string>{"a"}));
+    ASSERT_TRUE(!throttler.isPending());
+
+    throttler.trigger([&] { ran.push_back("b"); }, at(20));
+    throttler.trigger([&] { ran.push_back("c"); }, at(50));     // Replaces "b"
+    ASSERT_TRUE(throttler.isPending());
+    ASSERT_EQ(wheel.advance(at(99)), size_t{0});
+    ASSERT_EQ(wheel.advance(at(100)), size_t{1});               // Trailing run at the interval's end
+    ASSERT_TRUE((ran == std::vector<std::string>{"a", "c"}));
+
+    // The trailing run starts the next interval.
+    throttler.trigger([&] { ran.push_back("d"); }, at(150));
+    ASSERT_EQ(ran.size(), size_t{2});
+    ASSERT_EQ(wheel.advance(at(199)), size_t{0});
+    ASSERT_EQ(wheel.advance(at(200)), size_t{1});
+    ASSERT_TRUE((ran == std::vector<std::string>{"a", "c", "d"}));
+
+    // Quiet for a full interval: the next trigger runs at once again.
+    throttler.trigger([&] { ran.push_back("e"); }, at(350));
+    ASSERT_EQ(ran.size(), size_t{4});
+
+    throttler.trigger([&] { ran.push_back("f"); }, at(360));
+    throttler.cancel();
+    ASSERT_EQ(wheel.advance(at(1000)), size_t{0});
+    ASSERT_TRUE((ran == std::vector<std::string>{"a", "c", "d", "e"}));
+    std::println("  ✓ {} runs for 6 triggers\n", ran.size());
+}
+
+// ============================================================================
+// MAIN TEST RUNNER
+// ============================================================================
+
+int main() {
+    try {
+        std::println("=== FRQS-Widget Timer Wheel Tests ===\n");
+
+        test_one_shot_never_early();
+        test_deadline_order();
+        test_periodic_skips_missed_periods();
+        test_periodic_cancels_itself();
+        test_cancel_and_reschedule();
+        test_cascade_across_levels();
+        test_debouncer();
+        test_throttler();
+
+        std::println("✅ ALL TESTS PASSED!");
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::println(stderr, "\n❌ TEST FAILED: {}", e.what());
+        return 1;
+    }
+}
@@ -0,0 +1,201 @@
+// tests/ui_task_scheduler_test.cpp - Priority lanes under a per-frame budget
+#include "frqs-widget.hpp"
+#include "core/ui_task_scheduler.hpp"
+#include <functional>
+#include <print>
+#include <vector>
+
+using namespace frqs;
+using namespace std::chrono;
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        std::println(stderr, "Assertion failed: {}", #cond); \
+        std::terminate(); \
+    }
+
+#define ASSERT_EQ(a, b) \
+    if ((a) != (b)) { \
+        std::println(stderr, "Assertion failed: {} != {}", #a, #b); \
+        std::println(stderr, "  Expected: {}", b); \
+        std::println(stderr, "  Got: {}", a); \
+        std::terminate(); \
+    }
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+constexpr auto BUDGET = milliseconds(2);
+constexpr auto TASK_COST = microseconds(200);
+
+/** @brief The most budgeted tasks of TASK_COST one frame can start. */
+constexpr uint64_t MAX_PER_FRAME = BUDGET / TASK_COST + 1;
+
+/** @brief Busy-waits, so a task costs at least `duration` of frame time. */
+void spinFor(steady_clock::duration duration) {
+    auto until = steady_clock::now() + duration;
+    while (steady_clock::now() < until) {}
+}
+
+/** @brief Floods a lane with `count` tasks of TASK_COST that log their index. */
+void flood(core::UiTaskScheduler& scheduler, core::TaskLane lane, int count, std::vector<int>& log) {
+    for (int i = 0; i < count; ++i) {
+        scheduler.post([&log, i] {
+            spinFor(TASK_COST);
+            log.push_back(i);
+        }, lane);
+    }
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void test_flood_is_budgeted_and_carried() {
+    std::println("TEST: A flooded normal lane runs within the budget and carries the rest");
+
+    core::UiTaskScheduler scheduler;
+    scheduler.setFrameBudget(BUDGET);
+    constexpr int TASKS = 200;
+    std::vector<int> normal;
+    flood(scheduler, core::TaskLane::Normal, TASKS, normal);
+
+    size_t ran = scheduler.runFrame();
+    auto stats = scheduler.getLaneStats(core::TaskLane::Normal);
+    ASSERT_TRUE(ran >= 1);
+    ASSERT_TRUE(stats.executed <= MAX_PER_FRAME);
+    ASSERT_EQ(stats.depth, TASKS - static_cast<size_t>(stats.executed));
+    ASSERT_EQ(stats.maxDepth, size_t{TASKS});
+    ASSERT_EQ(stats.carriedFrames, uint64_t{1});
+    ASSERT_TRUE(scheduler.hasPending());
+    ASSERT_TRUE(!scheduler.hasNewTasks());     // Leftovers do not wake the loop
+
+    // Later frames pick up where the last one stopped, in posting order.
+    size_t frames = 1;
+    while (scheduler.hasPending()) {
+        scheduler.runFrame();
+        ++frames;
+    }
+    ASSERT_EQ(normal.size(), size_t{TASKS});
+    bool inOrder = true;
+    for (int i = 0; i < TASKS; ++i) {
+        inOrder = inOrder && normal[i] == i;
+    }
+    ASSERT_TRUE(inOrder);
+    ASSERT_TRUE(frames >= TASKS / MAX_PER_FRAME);
+    ASSERT_EQ(scheduler.getLaneStats(core::TaskLane::Normal).depth, size_t{0});
+    std::println("  ✓ {} tasks over {} frames\n", TASKS, frames);
+}
+
+void test_critical_always_runs() {
+    std::println("TEST: Critical tasks run in full however the lanes are flooded");
+
+    core::UiTaskScheduler scheduler;
+    scheduler.setFrameBudget(BUDGET);
+    std::vector<int> normal;
+    flood(scheduler, core::TaskLane::Normal, 100, normal);
+
+    // Together they cost twice the budget; all of them still run.
+    constexpr int CRITICAL = 20;
+    int critical = 0;
+    for (int i = 0; i < CRITICAL; ++i) {
+        scheduler.post([&critical] {
+            spinFor(TASK_COST);
+            ++critical;
+        }, core::TaskLane::Critical);
+    }
+
+    scheduler.runFrame();
+    ASSERT_EQ(critical, CRITICAL);
+    auto stats = scheduler.getLaneStats(core::TaskLane::Critical);
+    ASSERT_EQ(stats.executed, uint64_t{CRITICAL});
+    ASSERT_EQ(stats.carriedFrames, uint64_t{0});
+    ASSERT_EQ(scheduler.getWaitHistogram(core::TaskLane::Critical).getCount(), uint64_t{CRITICAL});
+
+    // The critical work used up the budget: normal gets its guaranteed minimum only.
+    ASSERT_EQ(normal.size(), size_t{1});
+    ASSERT_EQ(scheduler.getLaneStats(core::TaskLane::Normal).guaranteedRuns, uint64_t{1});
+
+    // A critical task posted into a flooded frame runs on the very next one.
+    scheduler.post([&critical] { ++critical; }, core::TaskLane::Critical);
+    ASSERT_TRUE(scheduler.hasNewTasks());
+    scheduler.runFrame();
+    ASSERT_EQ(critical, CRITICAL + 1);
+    std::println("  ✓ {} critical tasks past the budget\n", critical);
+}
+
+void test_idle_lane_makes_progress() {
+    std::println("TEST: The idle lane progresses behind a flood through minTasksPerLane");
+
+    constexpr int FRAMES = 5;
+    core::UiTaskScheduler scheduler;
+    scheduler.setFrameBudget(BUDGET);
+    std::vector<int> normal;
+    std::vector<int> idle;
+    flood(scheduler, core::TaskLane::Normal, 500, normal);
+    flood(scheduler, core::TaskLane::Idle, 10, idle);
+
+    for (int i = 0; i < FRAMES; ++i) {
+        scheduler.runFrame();
+    }
+    auto stats = scheduler.getLaneStats(core::TaskLane::Idle);
+    ASSERT_EQ(idle.size(), size_t{FRAMES});      // One per frame, in order
+    ASSERT_EQ(idle.back(), FRAMES - 1);
+    ASSERT_EQ(stats.guaranteedRuns, uint64_t{FRAMES});
+    ASSERT_EQ(stats.carriedFrames, uint64_t{FRAMES});
+
+    // A larger minimum speeds it up; 0 lets the flood starve it.
+    scheduler.setMinTasksPerLane(3);
+    scheduler.runFrame();
+    ASSERT_EQ(idle.size(), size_t{FRAMES + 3});
+
+    scheduler.setMinTasksPerLane(0);
+    scheduler.runFrame();
+    scheduler.runFrame();
+    ASSERT_EQ(idle.size(), size_t{FRAMES + 3});
+    ASSERT_TRUE(normal.size() < 500);
+    std::println("  ✓ {} idle tasks ran behind {} normal ones\n", idle.size(), normal.size());
+}
+
+void test_reposting_task_is_bounded() {
+    std::println("TEST: A task that reposts itself runs once per frame");
+
+    core::UiTaskScheduler scheduler;
+    scheduler.setFrameBudget(milliseconds(50));
+    int runs = 0;
+    std::function<void()> again = [&] {
+        ++runs;
+        scheduler.post(again);
+    };
+    scheduler.post(again);
+
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(scheduler.runFrame(), size_t{1});
+    }
+    ASSERT_EQ(runs, 3);
+    ASSERT_TRUE(scheduler.hasPending());
+    std::println("  ✓ No frame spun on it\n");
+}
+
+// ============================================================================
+// MAIN TEST RUNNER
+// ============================================================================
+
+int main() {
+    try {
+        std::println("=== FRQS-Widget UI Task Scheduler Tests ===\n");
+
+        test_flood_is_budgeted_and_carried();
+        test_critical_always_runs();
+        test_idle_lane_makes_progress();
+        test_reposting_task_is_bounded();
+
+        std::println("✅ ALL TESTS PASSED!");
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::println(stderr, "\n❌ TEST FAILED: {}", e.what());
+        return 1;
+    }
+}
@@ -0,0 +1,173 @@
+// tests/update_channel_test.cpp - Latest-value-wins channels from workers to the UI
+#include "frqs-widget.hpp"
+#include "platform/event_loop_backend.hpp"
+#include "platform/update_channel.hpp"
+#include <memory>
+#include <print>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace frqs;
+
+#define ASSERT_TRUE(cond) \
+    if (!(cond)) { \
+        std::println(stderr, "Assertion failed: {}", #cond); \
+        std::terminate(); \
+    }
+
+#define ASSERT_EQ(a, b) \
+    if ((a) != (b)) { \
+        std::println(stderr, "Assertion failed: {} != {}", #a, #b); \
+        std::println(stderr, "  Expected: {}", b); \
+        std::println(stderr, "  Got: {}", a); \
+        std::terminate(); \
+    }
+
+using Channel = platform::UpdateChannel<std::string, int>;
+using Delivery = std::pair<std::string, int>;
+
+// ============================================================================
+// TESTS
+// ============================================================================
+
+void test_supersede_counting() {
+    std::println("TEST: Newer values overwrite pending ones and are counted as superseded");
+
+    Channel channel;
+    channel.publish("a", 1);
+    channel.publish("a", 2);
+    channel.publish("b", 10);
+    channel.publish("a", 3);
+
+    auto stats = channel.getStats();
+    ASSERT_EQ(stats.published, uint64_t{4});
+    ASSERT_EQ(stats.superseded, uint64_t{2});
+    ASSERT_EQ(stats.maxPending, size_t{2});
+    ASSERT_EQ(channel.getPendingCount(), size_t{2});
+
+    std::vector<Delivery> seen;
+    ASSERT_EQ(channel.consume([&](const std::string& key, int&& value) { seen.emplace_back(key, value); }),
+              size_t{2});
+    ASSERT_TRUE((seen == std::vector<Delivery>{{"a", 3}, {"b", 10}}));
+
+    stats = channel.getStats();
+    ASSERT_EQ(stats.delivered, uint64_t{2});
+    ASSERT_EQ(stats.frames, uint64_t{1});
+    ASSERT_EQ(stats.published, stats.delivered + stats.superseded);
+
+    // Nothing pending: an empty consume is not a frame.
+    ASSERT_EQ(channel.consume([](const std::string&, int&&) {}), size_t{0});
+    ASSERT_EQ(channel.getStats().frames, uint64_t{1});
+    std::println("  ✓ 4 published, 2 superseded, 2 delivered\n");
+}
+
+void test_delivery_order() {
+    std::println("TEST: Keys are delivered in the order they first became pending");
+
+    std::vector<Delivery> seen;
+    Channel channel([&](const std::string& key, int&& value) { seen.emplace_back(key, value); });
+
+    channel.publish("c", 1);
+    channel.publish("a", 1);
+    channel.publish("b", 1);
+    channel.publish("c", 2);    // Updates in place; "c" stays first
+    ASSERT_EQ(channel.deliverPending(), size_t{3});
+    ASSERT_TRUE((seen == std::vector<Delivery>{{"c", 2}, {"a", 1}, {"b", 1}}));
+
+    // Values published from the handler wait for the next consume.
+    seen.clear();
+    channel.publish("x", 1);
+    channel.consume([&](const std::string& key, int&& value) {
+        seen.emplace_back(key, value);
+        channel.publish("y", value + 1);
+    });
+    ASSERT_TRUE((seen == std::vector<Delivery>{{"x", 1}}));
+    ASSERT_EQ(channel.getPendingCount(), size_t{1});
+    ASSERT_EQ(channel.deliverPending(), size_t{1});
+    ASSERT_TRUE((seen.back() == Delivery{"y", 2}));
+    std::println("  ✓ First-pending order kept\n");
+}
+
+void test_pending_callback_once_per_consume() {
+    std::println("TEST: The pending callback runs once per idle-to-pending transition");
+
+    Channel channel;
+    int rung = 0;
+    channel.setPendingCallback([&] { ++rung; });
+
+    channel.publish("a", 1);
+    channel.publish("b", 1);
+    channel.publish("a", 2);
+    ASSERT_EQ(rung, 1);
+
+    channel.consume([](const std::string&, int&&) {});
+    channel.publish("a", 3);
+    ASSERT_EQ(rung, 2);
+
+    channel.setPendingCallback({});
+    channel.consume([](const std::string&, int&&) {});
+    channel.publish("a", 4);
+    ASSERT_EQ(rung, 2);
+    std::println("  ✓ Rung {} times\n", rung);
+}
+
+void test_application_attach_and_detach() {
+    std::println("TEST: An attached channel wakes the loop; a detached one no longer does");
+
+    auto& app = core::Application::instance();
+    auto& scheduler = app.getTaskScheduler();
+    std::vector<Delivery> seen;
+    auto channel = std::make_shared<Channel>([&](const std::string& key, int&& value) {
+        seen.emplace_back(key, value);
+    });
+    app.attachUpdateChannel(channel);
+
+    // A worker publishes a burst; the UI sees the newest value per key.
+    std::thread worker([&] {
+        for (int i = 1; i <= 1000; ++i) {
+            channel->publish(i % 2 == 0 ? "even" : "odd", i);
+        }
+    });
+    worker.join();
+    ASSERT_TRUE(scheduler.hasNewTasks());
+    app.pollEvents();
+    ASSERT_TRUE((seen == std::vector<Delivery>{{"odd", 999}, {"even", 1000}}));
+
+    // Detached: publishes are kept but no longer post a doorbell to the loop.
+    app.detachUpdateChannel(channel);
+    uint64_t doorbells = scheduler.getLaneStats(core::TaskLane::Critical).posted;
+    channel->publish("odd", 1001);
+    ASSERT_EQ(scheduler.getLaneStats(core::TaskLane::Critical).posted, doorbells);
+    app.pollEvents();
+    ASSERT_EQ(seen.size(), size_t{2});
+    ASSERT_EQ(channel->getPendingCount(), size_t{1});
+    std::println("  ✓ Delivered while attached, silent once detached\n");
+}
+
+// ============================================================================
+// MAIN TEST RUNNER
+// ============================================================================
+
+int main() {
+    try {
+        std::println("=== FRQS-Widget Update Channel Tests ===\n");
+
+        auto& app = core::Application::instance();
+        app.setEventLoopBackend(std::make_unique<platform::HeadlessEventLoopBackend>());
+        app.setQuitOnLastWindowClosed(false);   // No windows in a headless run
+
+        test_supersede_counting();
+        test_delivery_order();
+        test_pending_callback_once_per_consume();
+        test_application_attach_and_detach();
+
+        std::println("✅ ALL TESTS PASSED!");
+        return 0;
+
+    } catch (const std::exception& e) {
+        std::println(stderr, "\n❌ TEST FAILED: {}", e.what());
+        return 1;
+    }
+}
@@ -236,6 +236,47 @@ TEST(multiple_windows) {
     }
 }
 
+TEST(auto_damage_ignores_over_invalidation) {
+    auto& app = Application::instance();
+
+    WindowParams params;
+    params.size = widget::Size(400u, 300u);
+    params.visible = true;
+
+    auto window = app.createWindow(params);
+    window->setFrameRatePolicy(core::FrameRatePolicy{.focusedFps = 0, .backgroundFps = 0});
+    window->setAutoDamage(true);
+
+    auto root = std::make_shared<widget::Container>();
+    auto swatch = std::make_shared<widget::Widget>();
+    swatch->setRect(widget::Rect(10, 10, 20u, 20u));
+    swatch->setBackgroundColor(widget::Color(200, 0, 0));
+    root->addChild(swatch);
+    window->setRootWidget(root);
+
+    auto frame = [&] {
+        if (window->paint(std::chrono::steady_clock::now())) {
+            window->present();
+        }
+    };
+    frame();    // First frame: no baseline, drawn in full
+    window->resetFrameStats();
+
+    // The root asks for the whole window, but only the swatch's drawing changed.
+    root->invalidate();
+    swatch->setBackgroundColor(widget::Color(0, 0, 200));
+    frame();
+    ASSERT_EQ(window->getFrameStats().presented, 1u);
+    ASSERT_TRUE(window->getFrameStats().damagedArea <= 2u * 20u * 20u);
+
+    // Nothing changed at all: a full invalidation draws nothing.
+    root->invalidate();
+    frame();
+    ASSERT_EQ(window->getFrameStats().presented, 1u);
+
+    window->close();
+}
+
 // ============================================================================
 // MAIN
 // ============================================================================